@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics.hpp>
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// Run a benchmark and return the best time of a few runs
+///
+////////////////////////////////////////////////////////////
+template <typename F>
+sf::Time measure(F&& function)
+{
+    sf::Time best = sf::Time::Zero;
+
+    for (int run = 0; run < 5; ++run)
+    {
+        const sf::Clock clock;
+        function();
+        const sf::Time elapsed = clock.getElapsedTime();
+
+        if ((run == 0) || (elapsed < best))
+            best = elapsed;
+    }
+
+    return best;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Print the result of a benchmark
+///
+////////////////////////////////////////////////////////////
+void print(const char* name, sf::Time time, std::size_t pointCount, int iterations)
+{
+    const double nanoseconds = static_cast<double>(time.asMicroseconds()) * 1000.0;
+    std::cout << "  " << name << ": " << time.asMilliseconds() << " ms ("
+              << nanoseconds / static_cast<double>(pointCount * static_cast<std::size_t>(iterations)) << " ns per point)"
+              << std::endl;
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Entry point of application
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    constexpr std::size_t pointCount = 100'000;
+    constexpr int         iterations = 100;
+
+    // Generate random points and a transform that rotates and translates them
+    // (the vertices are transformed repeatedly in place, so don't scale them)
+    std::mt19937                          rng(42);
+    std::uniform_real_distribution<float> distribution(-1000.f, 1000.f);
+
+    std::vector<sf::Vector2f> points(pointCount);
+    for (auto& point : points)
+        point = {distribution(rng), distribution(rng)};
+
+    std::vector<sf::Vertex> vertices(pointCount);
+    for (std::size_t i = 0; i < pointCount; ++i)
+        vertices[i].position = points[i];
+
+    sf::Transform transform;
+    transform.translate({100.f, 50.f}).rotate(sf::degrees(30.f));
+
+    std::vector<sf::Vector2f> transformedPoints(pointCount);
+    float                     checksum = 0.f;
+
+    std::cout << "Transforming " << pointCount << " points " << iterations << " times" << '\n' << std::endl;
+
+    // Points: one by one with transformPoint
+    const sf::Time scalarPointsTime = measure(
+        [&]
+        {
+            for (int i = 0; i < iterations; ++i)
+                for (std::size_t j = 0; j < pointCount; ++j)
+                    transformedPoints[j] = transform.transformPoint(points[j]);
+
+            checksum += transformedPoints.back().x;
+        });
+
+    // Points: all at once with transformPoints
+    const sf::Time batchPointsTime = measure(
+        [&]
+        {
+            for (int i = 0; i < iterations; ++i)
+                transform.transformPoints(points.data(), transformedPoints.data(), pointCount);
+
+            checksum += transformedPoints.back().x;
+        });
+
+    // Vertices: one by one with transformPoint
+    const sf::Time scalarVerticesTime = measure(
+        [&]
+        {
+            for (int i = 0; i < iterations; ++i)
+                for (auto& vertex : vertices)
+                    vertex.position = transform.transformPoint(vertex.position);
+
+            checksum += vertices.back().position.x;
+        });
+
+    // Vertices: all at once with transformPoints
+    const sf::Time batchVerticesTime = measure(
+        [&]
+        {
+            for (int i = 0; i < iterations; ++i)
+                transform.transformPoints(vertices.data(), vertices.size());
+
+            checksum += vertices.back().position.x;
+        });
+
+    std::cout << "sf::Vector2f" << '\n';
+    print("transformPoint ", scalarPointsTime, pointCount, iterations);
+    print("transformPoints", batchPointsTime, pointCount, iterations);
+    std::cout << '\n' << "sf::Vertex" << '\n';
+    print("transformPoint ", scalarVerticesTime, pointCount, iterations);
+    print("transformPoints", batchVerticesTime, pointCount, iterations);
+
+    // Print the checksum so that the compiler can't optimize the work away
+    std::cout << '\n' << "Checksum: " << checksum << std::endl;
+
+    // Wait until the user presses 'enter' key
+    std::cout << "Press enter to exit..." << std::endl;
+    std::cin.ignore(10000, '\n');
+}
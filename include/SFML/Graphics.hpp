@@ -32,25 +32,37 @@
 #include <SFML/Graphics/CircleShape.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
+#include <SFML/Graphics/DrawList.hpp>
 #include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Fence.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/FrameRecorder.hpp>
 #include <SFML/Graphics/Glyph.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageRequest.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/InstanceBuffer.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderQueue.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/ShaderRequest.hpp>
 #include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/ShapeBatch.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/TextLayout.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureAtlas.hpp>
 #include <SFML/Graphics/Transform.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
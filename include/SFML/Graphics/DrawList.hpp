@@ -0,0 +1,244 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+class VertexBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief List of draw commands recorded without an OpenGL context
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API DrawList
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Record primitives defined by an array of vertices
+    ///
+    /// The vertices are copied into the list and transformed
+    /// by the transform of \a states right away, so that this
+    /// work is done by the recording thread.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const Vertex*       vertices,
+                std::size_t         vertexCount,
+                PrimitiveType       type,
+                const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record indexed primitives defined by an array of vertices
+    ///
+    /// The vertices and indices are copied into the list, and the
+    /// vertices are transformed by the transform of \a states
+    /// right away. All indices must be lower than \a vertexCount.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const Vertex*        vertices,
+                std::size_t          vertexCount,
+                const std::uint16_t* indices,
+                std::size_t          indexCount,
+                PrimitiveType        type,
+                const RenderStates&  states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record primitives defined by a vertex buffer
+    ///
+    /// Only a reference to the vertex buffer is recorded, it
+    /// must stay alive until the list is drawn.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const VertexBuffer& vertexBuffer, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record primitives defined by a range of a vertex buffer
+    ///
+    /// Only a reference to the vertex buffer is recorded, it
+    /// must stay alive until the list is drawn.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param firstVertex  Index of the first vertex to render
+    /// \param vertexCount  Number of vertices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const VertexBuffer& vertexBuffer,
+                std::size_t         firstVertex,
+                std::size_t         vertexCount,
+                const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append the commands of another list to this list
+    ///
+    /// \param drawList List whose commands to append
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const DrawList& drawList);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the recorded commands
+    ///
+    /// The memory used by the list is kept, so that it can be
+    /// recorded again every frame without new allocations.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the list contains no command
+    ///
+    /// \return `true` if the list is empty, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEmpty() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the number of recorded commands
+    ///
+    /// Consecutive vertex arrays sharing the same render states
+    /// and primitive type are merged into a single command.
+    ///
+    /// \return Number of commands in the list
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCommandCount() const;
+
+private:
+    friend class RenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recorded draw command
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Command
+    {
+        PrimitiveType       type{};         //!< Type of primitives to draw
+        RenderStates        states;         //!< Render states to use for drawing
+        const VertexBuffer* vertexBuffer{}; //!< Vertex buffer to draw, or a null pointer to draw recorded vertices
+        std::size_t         firstVertex{};  //!< Index of the first vertex, in the vertex buffer or the recorded vertices
+        std::size_t         vertexCount{};  //!< Number of vertices to draw
+        std::size_t         firstIndex{};   //!< Index of the first recorded index
+        std::size_t         indexCount{};   //!< Number of indices to draw, 0 for non-indexed draws
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy vertices into the list and transform them
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param transform   Transform to apply to the vertices
+    ///
+    /// \return Index of the first copied vertex
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t appendVertices(const Vertex* vertices, std::size_t vertexCount, const Transform& transform);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Command>       m_commands; //!< Recorded commands
+    std::vector<Vertex>        m_vertices; //!< Vertices of all the recorded vertex arrays
+    std::vector<std::uint16_t> m_indices;  //!< Indices of all the recorded indexed vertex arrays
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::DrawList
+/// \ingroup graphics
+///
+/// `sf::DrawList` records draw commands so that they can be
+/// submitted later with `sf::RenderTarget::draw`. Recording
+/// doesn't involve OpenGL at all, so a list can be built by
+/// any thread, for example to split the traversal of a large
+/// scene and the generation of its vertices across several
+/// worker threads, while the OpenGL submission stays on the
+/// rendering thread.
+///
+/// A draw list is not thread-safe by itself: each list must
+/// be recorded by a single thread at a time, and must not be
+/// modified while it is being drawn.
+///
+/// Vertex arrays are copied into the list, and are transformed
+/// on the recording thread. Textures, shaders and vertex buffers
+/// are only referenced, they must stay alive and unchanged
+/// until the list is drawn.
+///
+/// Only raw vertices and vertex buffers can be recorded:
+/// `sf::Drawable` objects (sprites, texts, shapes, ...) draw
+/// themselves to an `sf::RenderTarget`, which a draw list is
+/// not, and can't be appended to it. Their geometry has to be
+/// recorded from their vertices instead, or they must be
+/// drawn directly to the target on the rendering thread.
+///
+/// Example:
+/// \code
+/// std::vector<sf::DrawList> lists(chunks.size());
+///
+/// // On worker threads
+/// for (std::size_t i = 0; i < chunks.size(); ++i)
+///     pool.enqueue([&, i] { chunks[i].record(lists[i]); });
+/// pool.wait();
+///
+/// // On the rendering thread
+/// for (const sf::DrawList& list : lists)
+///     window.draw(list);
+/// \endcode
+///
+/// \see `sf::RenderTarget`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Point in the stream of OpenGL commands that can be waited for
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API Fence : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates a fence which is already signaled.
+    ///
+    ////////////////////////////////////////////////////////////
+    Fence() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Insert a fence after the commands issued so far
+    ///
+    /// The fence is signaled once the graphics card has finished
+    /// executing all the OpenGL commands issued before it by the
+    /// active context, or by a temporary context if none is active.
+    ///
+    /// If the system doesn't support sync objects, this function
+    /// waits for all the pending commands to finish and returns
+    /// a fence which is already signaled.
+    ///
+    /// \return New fence
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Fence insert();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the fence is signaled, without blocking
+    ///
+    /// \return `true` if the commands preceding the fence are finished
+    ///
+    /// \see `wait`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSignaled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Block until the fence is signaled or a timeout expires
+    ///
+    /// \param timeout Maximum time to wait
+    ///
+    /// \return `true` if the fence was signaled before the timeout expired
+    ///
+    /// \see `isSignaled`
+    ///
+    ////////////////////////////////////////////////////////////
+    bool wait(Time timeout) const;
+
+private:
+    struct Sync;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::shared_ptr<Sync> m_sync; //!< OpenGL sync object, or a null pointer if the fence is already signaled
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Fence
+/// \ingroup graphics
+///
+/// OpenGL commands are executed asynchronously by the graphics
+/// card, well after the functions that issued them returned.
+/// `sf::Fence` makes it possible to know when a given batch of
+/// commands has been executed, for example to find out when an
+/// asynchronous texture update has completed.
+///
+/// Fences are cheap to copy: all the copies refer to the same
+/// point in the command stream. They can be tested or waited
+/// for from any thread.
+///
+/// Usage example:
+/// \code
+/// const sf::Fence fence = texture.updateAsync(frame.data(), size, {0, 0});
+///
+/// // The frame buffer can be refilled right away
+/// decoder.decodeNextFrame(frame);
+///
+/// // Later, before relying on the texture contents elsewhere
+/// if (!fence.isSignaled())
+///     std::cout << "The upload is still in progress" << std::endl;
+/// \endcode
+///
+/// \see `sf::Texture::updateAsync`
+///
+////////////////////////////////////////////////////////////
@@ -37,6 +37,7 @@
 
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -45,12 +46,13 @@
 #include <cstdint>
 
 
-#ifdef SFML_SYSTEM_ANDROID
 namespace sf::priv
 {
+class SkylinePacker;
+#ifdef SFML_SYSTEM_ANDROID
 class ResourceStream;
-}
 #endif
+} // namespace sf::priv
 
 namespace sf
 {
@@ -72,6 +74,40 @@ public:
         std::string family; //!< The font family
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Range of consecutive Unicode code points
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CodePointRange
+    {
+        char32_t first{}; //!< First code point of the range
+        char32_t last{};  //!< Last code point of the range (included)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Variant of the glyphs to load
+    ///
+    ////////////////////////////////////////////////////////////
+    struct GlyphVariant
+    {
+        bool  bold{};             //!< Load the bold version of the glyphs?
+        float outlineThickness{}; //!< Thickness of outline (when != 0 the glyphs will not be filled)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about the glyph pages of a font
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::size_t   pageCount{};      //!< Number of pages, one per character size used so far
+        std::size_t   glyphCount{};     //!< Number of glyphs stored in the pages
+        std::size_t   textureBytes{};   //!< Memory used by the textures of the pages, in bytes
+        float         occupancy{};      //!< Fraction of the textures' area used by glyphs, in [0, 1]
+        std::uint64_t glyphEvictions{}; //!< Number of glyphs evicted so far to stay within the memory budget
+        std::uint64_t pageEvictions{};  //!< Number of pages evicted so far to stay within the memory budget
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -229,6 +265,11 @@ public:
     /// Be aware that using a negative value for the outline
     /// thickness will cause distorted rendering.
     ///
+    /// If the glyph can't be added to the texture of its page
+    /// (see `setMemoryBudget`), it is returned with an empty
+    /// texture rectangle and loading it is attempted again on
+    /// the next call.
+    ///
     /// \param codePoint        Unicode code point of the character to get
     /// \param characterSize    Reference character size
     /// \param bold             Retrieve the bold version or the regular one?
@@ -239,6 +280,38 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const Glyph& getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the metrics of a glyph without touching its texture
+    ///
+    /// Unlike `getGlyph`, this function never writes to the font's
+    /// textures, and can therefore be called from any thread, even
+    /// one without an active OpenGL context, concurrently with
+    /// other threads and with the rendering.
+    ///
+    /// The returned glyph has a valid advance, bounds and
+    /// position compensation deltas, but an empty texture
+    /// rectangle. If the glyph had not been loaded yet, it is
+    /// rasterized and kept in memory until the first call to
+    /// `getGlyph` uploads it to the texture of its page. The
+    /// pixels waiting to be uploaded are limited to a few
+    /// megabytes: beyond that, only the metrics are kept and
+    /// `getGlyph` rasterizes the glyph again.
+    ///
+    /// \param codePoint        Unicode code point of the character to get
+    /// \param characterSize    Reference character size
+    /// \param bold             Retrieve the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    ///
+    /// \return The metrics of the glyph corresponding to `codePoint` and `characterSize`
+    ///
+    /// \see `getGlyph`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Glyph getGlyphMetrics(char32_t     codePoint,
+                                        unsigned int characterSize,
+                                        bool         bold,
+                                        float        outlineThickness = 0) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Determine if this font has a glyph representing the requested code point
     ///
@@ -358,26 +431,118 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load many glyphs ahead of time
+    ///
+    /// Loading a glyph the first time it is displayed is
+    /// expensive, and showing a new character size or a text
+    /// with many different characters (such as CJK text) can
+    /// stall a frame. This function loads all the requested
+    /// glyphs at once, typically during a loading screen:
+    /// they are rasterized in parallel on \a threadCount
+    /// threads, each using its own copy of the font face, then
+    /// packed into the pages and written to their textures
+    /// with as few texture updates as possible.
+    ///
+    /// Glyphs that are already loaded are skipped, and so are
+    /// glyphs that don't fit within the memory budget: they are
+    /// loaded by `getGlyph` when they are needed. If the font
+    /// was opened from a stream, its face cannot be shared
+    /// with other threads and the glyphs are rasterized on the
+    /// calling thread. Duplicate character sizes are only
+    /// loaded once.
+    ///
+    /// Like `getGlyph`, this function writes to the font's
+    /// textures and must be called from the thread that
+    /// renders the texts.
+    ///
+    /// \param ranges         Ranges of code points to load
+    /// \param characterSizes Character sizes to load the glyphs for
+    /// \param variants       Variants (bold, outline) to load the glyphs for
+    /// \param threadCount    Number of threads rasterizing the glyphs, 0 to use one per hardware thread
+    ///
+    /// \return Number of glyphs that were loaded
+    ///
+    /// \see `getGlyph`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t preloadGlyphs(const std::vector<CodePointRange>& ranges,
+                              const std::vector<unsigned int>&   characterSizes,
+                              const std::vector<GlyphVariant>&   variants    = {{false, 0.f}},
+                              unsigned int                       threadCount = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Limit the memory used by the textures of the pages
+    ///
+    /// Each character size has its own page of glyphs, whose
+    /// texture grows as new glyphs are loaded. With a budget,
+    /// the least recently used pages are released when a page
+    /// needs to grow or a new one is created and the budget
+    /// would be exceeded: their glyphs are evicted and their
+    /// texture shrinks back to its initial size. If the page
+    /// itself can't grow, it is rebuilt with its most recently
+    /// used glyphs only: the other ones are evicted and loaded
+    /// again when requested.
+    ///
+    /// The budget is applied the next time the pages change.
+    /// Textures returned by `getTexture` stay valid objects, but
+    /// evictions change their content and invalidate the texture
+    /// rectangles of the glyphs returned by `getGlyph`. `sf::Text`
+    /// detects it and updates its geometry by itself; geometry
+    /// built or recorded from the glyphs beforehand (such as a
+    /// batch of draws not flushed yet) shows the new content.
+    /// A budget too small for the glyphs displayed in a single
+    /// frame makes the font reload glyphs constantly, and pages
+    /// which were released still use their initial texture.
+    ///
+    /// There is no budget by default.
+    ///
+    /// \param bytes Maximum memory used by the page textures, in bytes, or 0 for no limit
+    ///
+    /// \see `getMemoryBudget`, `getStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMemoryBudget(std::size_t bytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the limit of the memory used by the textures of the pages
+    ///
+    /// \return Maximum memory used by the page textures, in bytes, or 0 for no limit
+    ///
+    /// \see `setMemoryBudget`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get statistics about the glyph pages
+    ///
+    /// \return Page count, memory use, occupancy and evictions of the pages
+    ///
+    /// \see `setMemoryBudget`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
 private:
+    friend class Text;
+    friend class TextLayout;
+
     ////////////////////////////////////////////////////////////
-    /// \brief Structure defining a row of glyphs
+    /// \brief Structure defining a glyph stored in a page
     ///
     ////////////////////////////////////////////////////////////
-    struct Row
+    struct PageGlyph
     {
-        Row(unsigned int rowTop, unsigned int rowHeight) : top(rowTop), height(rowHeight)
-        {
-        }
-
-        unsigned int width{}; //!< Current width of the row
-        unsigned int top;     //!< Y position of the row into the texture
-        unsigned int height;  //!< Height of the row
+        Glyph         glyph;     //!< The glyph, with its texture rectangle in the page
+        std::uint64_t lastUse{}; //!< Value of the use counter the last time the glyph was requested
     };
 
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using GlyphTable = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
+    struct FontHandles;
+    using GlyphTable = std::unordered_map<std::uint64_t, PageGlyph>; //!< Table mapping a codepoint to its glyph
 
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a page of glyphs
@@ -386,11 +551,17 @@ private:
     struct Page
     {
         explicit Page(bool smooth);
-
-        GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
-        Texture          texture;    //!< Texture containing the pixels of the glyphs
-        unsigned int     nextRow{3}; //!< Y position of the next new row in the texture
-        std::vector<Row> rows;       //!< List containing the position of all the existing rows
+        Page(const Page& copy);
+        Page& operator=(const Page& right);
+        Page(Page&&) noexcept;
+        Page& operator=(Page&&) noexcept;
+        ~Page();
+
+        GlyphTable                           glyphs;       //!< Table mapping code points to their corresponding glyph
+        Texture                              texture;      //!< Texture containing the pixels of the glyphs
+        std::unique_ptr<priv::SkylinePacker> packer;       //!< Allocator of the glyph rectangles in the texture
+        std::uint64_t                        lastUse{};    //!< Value of the use counter the last time the page was used
+        std::uint64_t                        generation{}; //!< Incremented each time glyphs are moved or evicted
     };
 
     ////////////////////////////////////////////////////////////
@@ -417,36 +588,113 @@ private:
     /// \param bold             Retrieve the bold version or the regular one?
     /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
     ///
-    /// \return The glyph corresponding to `codePoint` and `characterSize`
+    /// \return The glyph corresponding to `codePoint` and `characterSize`,
+    ///         or `std::nullopt` if it couldn't be added to the texture of its page
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<Glyph> loadGlyph(char32_t     codePoint,
+                                   unsigned int characterSize,
+                                   bool         bold,
+                                   float        outlineThickness) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize a glyph, without uploading it to a texture
+    ///
+    /// The face must be locked by the caller.
+    ///
+    /// \param handles          Font face to rasterize the glyph with
+    /// \param codePoint        Unicode code point of the character to load
+    /// \param characterSize    Reference character size
+    /// \param bold             Retrieve the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    /// \param pixels           Filled with the RGBA pixels of the glyph, padding included
+    ///
+    /// \return The metrics of the glyph, with an empty texture rectangle
+    ///
+    ////////////////////////////////////////////////////////////
+    static Glyph rasterizeGlyph(FontHandles&               handles,
+                                char32_t                   codePoint,
+                                unsigned int               characterSize,
+                                bool                       bold,
+                                float                      outlineThickness,
+                                std::vector<std::uint8_t>& pixels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the pixels of a rasterized glyph to the texture of its page
+    ///
+    /// \param glyph         Glyph returned by `rasterizeGlyph`, its texture rectangle is updated
+    /// \param characterSize Reference character size
+    /// \param pixels        RGBA pixels of the glyph returned by `rasterizeGlyph`
+    ///
+    /// \return `true` on success, `false` if there is no room left for the glyph
     ///
     ////////////////////////////////////////////////////////////
-    Glyph loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
+    [[nodiscard]] bool uploadGlyph(Glyph& glyph, unsigned int characterSize, const std::uint8_t* pixels) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Find a suitable rectangle within the texture for a glyph
     ///
-    /// \param page Page of glyphs to search in
-    /// \param size Width and height of the rectangle
+    /// The texture grows when it is full, as long as it stays
+    /// within the maximum texture size and the memory budget.
+    /// Beyond that, the page is rebuilt with its most recently
+    /// used glyphs only, if \a canRebuild is `true`.
+    ///
+    /// \param page       Page of glyphs to search in
+    /// \param size       Width and height of the rectangle
+    /// \param canRebuild Can glyphs of the page be evicted to make room?
     ///
-    /// \return Found rectangle within the texture
+    /// \return Found rectangle within the texture, or `std::nullopt` if there is no room left
     ///
     ////////////////////////////////////////////////////////////
-    IntRect findGlyphRect(Page& page, Vector2u size) const;
+    std::optional<IntRect> findGlyphRect(Page& page, Vector2u size, bool canRebuild) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the least recently used pages until some memory fits within the budget
+    ///
+    /// \param keep       Page which must not be released
+    /// \param extraBytes Number of bytes about to be allocated
+    ///
+    /// \return `true` if the pages and the extra bytes fit within the budget
+    ///
+    ////////////////////////////////////////////////////////////
+    bool makeRoom(const Page& keep, std::size_t extraBytes) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Repack a page with its most recently used glyphs, and evict the others
+    ///
+    /// \param page Page of glyphs to rebuild
+    ///
+    ////////////////////////////////////////////////////////////
+    void rebuildPage(Page& page) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the generation of the page of a character size
+    ///
+    /// The generation changes each time glyphs of the page are
+    /// moved or evicted, which invalidates the texture rectangles
+    /// previously returned by `getGlyph`.
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \return Generation of the page
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getPageGeneration(unsigned int characterSize) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Make sure that the given size is the current one
     ///
+    /// \param handles       Font face to set the size of
     /// \param characterSize Reference character size
     ///
     /// \return `true` on success, `false` if any error happened
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool setCurrentSize(unsigned int characterSize) const;
+    [[nodiscard]] static bool setCurrentSize(FontHandles& handles, unsigned int characterSize);
 
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    struct FontHandles;
     using PageTable = std::unordered_map<unsigned int, Page>; //!< Table mapping a character size to its page (texture)
 
     ////////////////////////////////////////////////////////////
@@ -457,6 +705,11 @@ private:
     Info                         m_info;           //!< Information about the font
     mutable PageTable            m_pages;          //!< Table containing the glyphs pages by character size
     mutable std::vector<std::uint8_t> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
+    std::size_t                       m_memoryBudget{};   //!< Maximum memory used by the page textures, 0 for no limit
+    mutable std::uint64_t             m_useCounter{};     //!< Counter incremented each time a page is used
+    mutable std::uint64_t             m_glyphEvictions{}; //!< Number of glyphs evicted to stay within the budget
+    mutable std::uint64_t             m_pageEvictions{};  //!< Number of pages evicted to stay within the budget
+    mutable Glyph                     m_uncachedGlyph;    //!< Glyph returned by getGlyph when it couldn't be loaded
 #ifdef SFML_SYSTEM_ANDROID
     std::shared_ptr<priv::ResourceStream> m_stream; //!< Asset file streamer (if loaded from file)
 #endif
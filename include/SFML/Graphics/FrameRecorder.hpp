@@ -0,0 +1,243 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageRequest.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Records the contents of a render target as a raw video stream
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API FrameRecorder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Output formats
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Format
+    {
+        Y4m,  //!< YUV4MPEG2 stream with 4:2:0 planar frames, readable by most video tools
+        I420, //!< Raw 4:2:0 frames with separate Y, U and V planes, without any header
+        Nv12  //!< Raw 4:2:0 frames with a Y plane followed by an interleaved UV plane, without any header
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameRecorder();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Stops the recording if it is still in progress.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~FrameRecorder();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameRecorder(const FrameRecorder&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start recording a render target to a file
+    ///
+    /// Any recording in progress is stopped first. The size of
+    /// the frames is the size of the target when recording starts.
+    ///
+    /// \param target    Render target to record
+    /// \param filename  Path of the file to write
+    /// \param frameRate Frame rate written in the stream header, in frames per second
+    /// \param format    Format of the output
+    ///
+    /// \return `true` if the recording started, `false` if the file couldn't be opened
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool start(RenderTarget&                target,
+                             const std::filesystem::path& filename,
+                             unsigned int                 frameRate = 60,
+                             Format                       format    = Format::Y4m);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start recording a render target to an output stream
+    ///
+    /// Any recording in progress is stopped first. The stream
+    /// is written by a worker thread: it must not be accessed
+    /// until `stop` is called.
+    ///
+    /// \param target    Render target to record
+    /// \param stream    Stream to write the frames to, opened in binary mode
+    /// \param frameRate Frame rate written in the stream header, in frames per second
+    /// \param format    Format of the output
+    ///
+    /// \return `true` if the recording started, `false` if the target is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool start(RenderTarget& target, std::ostream& stream, unsigned int frameRate = 60, Format format = Format::Y4m);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Capture the current contents of the target
+    ///
+    /// Call this function once per frame, after drawing and
+    /// before `display` for a render window. The pixels are
+    /// read back asynchronously, then converted and written by
+    /// a worker thread.
+    ///
+    /// The amount of frames in flight is bounded: if the worker
+    /// thread can't keep up, this function waits for it.
+    ///
+    ////////////////////////////////////////////////////////////
+    void capture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop the recording
+    ///
+    /// All the frames captured so far are written before this
+    /// function returns.
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a recording is in progress
+    ///
+    /// \return `true` if the recorder is recording
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isRecording() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames written since the recording started
+    ///
+    /// \return Number of frames written to the output
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getFrameCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Hand a frame to the worker thread
+    ///
+    /// \param frame Frame to write
+    ///
+    ////////////////////////////////////////////////////////////
+    void push(Image frame);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function run by the worker thread
+    ///
+    ////////////////////////////////////////////////////////////
+    void run();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    RenderTarget*                  m_target{};     //!< Render target being recorded
+    Vector2u                       m_size;         //!< Size of the recorded frames
+    Format                         m_format{};     //!< Format of the output
+    std::unique_ptr<std::ofstream> m_file;         //!< File opened by the recorder, if any
+    std::ostream*                  m_stream{};     //!< Stream receiving the frames
+    std::deque<ImageRequest>       m_requests;     //!< Read backs in flight, oldest first
+    std::deque<Image>              m_frames;       //!< Frames waiting to be written, oldest first
+    std::mutex                     m_mutex;        //!< Mutex protecting the frame queue
+    std::condition_variable        m_condition;    //!< Signaled when the frame queue changes
+    bool                           m_stopping{};   //!< Should the worker thread exit once the queue is empty?
+    std::atomic<std::uint64_t>     m_frameCount{}; //!< Number of frames written
+    std::thread                    m_thread;       //!< Worker thread converting and writing the frames
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FrameRecorder
+/// \ingroup graphics
+///
+/// `sf::FrameRecorder` captures every frame drawn on a render
+/// window or render texture and writes it as uncompressed
+/// YUV 4:2:0 video, which can then be encoded by external tools
+/// (for example `ffmpeg -i capture.y4m capture.mp4`).
+///
+/// The rendering thread only issues asynchronous read backs:
+/// the conversion from RGBA to YUV, which uses SIMD instructions
+/// when available, and the writing of the frames happen on a
+/// worker thread. The number of frames buffered between the two
+/// is bounded, so memory usage stays constant however long the
+/// recording is.
+///
+/// Usage example:
+/// \code
+/// sf::FrameRecorder recorder;
+/// if (!recorder.start(window, "capture.y4m"))
+///     return -1;
+///
+/// while (window.isOpen())
+/// {
+///     // ... draw the frame ...
+///
+///     recorder.capture();
+///     window.display();
+/// }
+///
+/// recorder.stop();
+/// \endcode
+///
+/// \see `sf::RenderTarget::requestImageAsync`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <optional>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Pending read back of pixels from the graphics card
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ImageRequest
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates a request which is ready and holds an empty image.
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageRequest() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pixels are available, without blocking
+    ///
+    /// \return `true` if `getImage` can return without waiting
+    ///
+    /// \see `wait`, `getImage`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReady() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Block until the pixels are available or a timeout expires
+    ///
+    /// \param timeout Maximum time to wait
+    ///
+    /// \return `true` if the pixels became available before the timeout expired
+    ///
+    /// \see `isReady`, `getImage`
+    ///
+    ////////////////////////////////////////////////////////////
+    bool wait(Time timeout) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the pixels that were read back
+    ///
+    /// This function blocks until the pixels are available. Call
+    /// it once `isReady` returns `true` to avoid stalling. The
+    /// image is kept by the request, so subsequent calls return
+    /// it without reading from the graphics card again.
+    ///
+    /// \return Image containing the pixels, with its origin at the top-left corner
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Image getImage() const;
+
+private:
+    friend class RenderTarget;
+    friend class Texture;
+
+    struct Readback;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a request which is already complete
+    ///
+    /// \param image Image holding the pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ImageRequest(Image image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a request which is already complete from raw pixels
+    ///
+    /// \param pixels     Pixels to copy, whose rows may be longer than the image
+    /// \param size       Size of the image to extract from the pixels
+    /// \param storedSize Size of the pixel array, in pixels
+    /// \param flipped    Are the rows of the pixels stored from bottom to top?
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageRequest(const std::uint8_t* pixels, Vector2u size, Vector2u storedSize, bool flipped);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start reading back pixels asynchronously
+    ///
+    /// On success, a pixel buffer large enough for the pixels is
+    /// bound to `GL_PIXEL_PACK_BUFFER`: the caller then issues the
+    /// command that writes the pixels at offset 0 of the buffer,
+    /// and calls `submit`. Must be called with a context active.
+    ///
+    /// \param size       Size of the image to extract from the pixels
+    /// \param storedSize Size of the pixels written by the caller
+    /// \param flipped    Are the rows of the pixels written from bottom to top?
+    ///
+    /// \return New request, or `std::nullopt` if asynchronous read back is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::optional<ImageRequest> begin(Vector2u size, Vector2u storedSize, bool flipped);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Finish issuing the read back started by `begin`
+    ///
+    ////////////////////////////////////////////////////////////
+    void submit();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::shared_ptr<Readback> m_readback; //!< State of the read back, shared by all the copies of the request
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ImageRequest
+/// \ingroup graphics
+///
+/// Reading pixels back from the graphics card with functions
+/// such as `sf::Texture::copyToImage` forces the CPU to wait
+/// until the graphics card has executed all the pending
+/// rendering commands, which typically costs a whole frame.
+///
+/// `sf::ImageRequest` is returned by the asynchronous variants,
+/// `sf::Texture::requestImageAsync` and
+/// `sf::RenderTarget::requestImageAsync`. The pixels are copied
+/// into a pixel buffer object on the graphics card side, and can
+/// be retrieved without waiting once the copy has completed,
+/// usually one or two frames later.
+///
+/// If asynchronous read back is not supported by the system,
+/// the pixels are read back right away and the request is
+/// already ready when it is returned.
+///
+/// Usage example:
+/// \code
+/// std::deque<sf::ImageRequest> captures;
+///
+/// while (window.isOpen())
+/// {
+///     // ... draw the frame ...
+///
+///     captures.push_back(window.requestImageAsync());
+///     window.display();
+///
+///     while (!captures.empty() && captures.front().isReady())
+///     {
+///         replay.addFrame(captures.front().getImage());
+///         captures.pop_front();
+///     }
+/// }
+/// \endcode
+///
+/// \see `sf::Texture::requestImageAsync`, `sf::RenderTarget::requestImageAsync`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,323 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Index buffer storage for indexed 2D primitives
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API IndexBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Type of the indices stored in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    using Index = std::uint16_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// Index buffers share the usage specifiers of vertex buffers.
+    ///
+    /// \see `sf::VertexBuffer::Usage`
+    ///
+    ////////////////////////////////////////////////////////////
+    using Usage = VertexBuffer::Usage;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty index buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an `IndexBuffer` with a specific usage specifier
+    ///
+    /// Creates an empty index buffer and sets its usage to \p usage.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IndexBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(const IndexBuffer& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~IndexBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the index buffer
+    ///
+    /// Creates the index buffer and allocates enough graphics
+    /// memory to hold `indexCount` indices. Any previously
+    /// allocated memory is freed in the process.
+    ///
+    /// In order to deallocate previously allocated memory pass 0
+    /// as `indexCount`. Don't forget to recreate with a non-zero
+    /// value when graphics memory should be allocated again.
+    ///
+    /// \param indexCount Number of indices worth of memory to allocate
+    ///
+    /// \return `true` if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t indexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the index count
+    ///
+    /// \return Number of indices in the index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIndexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer from an array of indices
+    ///
+    /// The index array is assumed to have the same size as
+    /// the created buffer.
+    ///
+    /// No additional check is performed on the size of the index
+    /// array. Passing invalid arguments will lead to undefined
+    /// behavior.
+    ///
+    /// This function does nothing if `indices` is null or if the
+    /// buffer was not previously created.
+    ///
+    /// \param indices Array of indices to copy to the buffer
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const Index* indices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of indices
+    ///
+    /// `offset` is specified as the number of indices to skip
+    /// from the beginning of the buffer.
+    ///
+    /// If `offset` is 0 and `indexCount` is equal to the size of
+    /// the currently created buffer, its whole contents are replaced.
+    ///
+    /// If `offset` is 0 and `indexCount` is greater than the
+    /// size of the currently created buffer, a new buffer is created
+    /// containing the index data.
+    ///
+    /// If `offset` is 0 and `indexCount` is less than the size of
+    /// the currently created buffer, only the corresponding region
+    /// is updated.
+    ///
+    /// If `offset` is not 0 and `offset` + `indexCount` is greater
+    /// than the size of the currently created buffer, the update fails.
+    ///
+    /// No additional check is performed on the size of the index
+    /// array. Passing invalid arguments will lead to undefined
+    /// behavior.
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const Index* indices, std::size_t indexCount, unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy the contents of another buffer into this buffer
+    ///
+    /// \param indexBuffer Index buffer whose contents to copy into this index buffer
+    ///
+    /// \return `true` if the copy was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const IndexBuffer& indexBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer& operator=(const IndexBuffer& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the contents of this index buffer with those of another
+    ///
+    /// \param right Instance to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(IndexBuffer& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the index buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the index buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this index buffer
+    ///
+    /// This function provides a hint about how this index buffer is
+    /// going to be used in terms of data update frequency.
+    ///
+    /// After changing the usage specifier, the index buffer has
+    /// to be updated with new data for the usage specifier to
+    /// take effect.
+    ///
+    /// The default usage type is `sf::IndexBuffer::Usage::Stream`.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this index buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind an index buffer for rendering
+    ///
+    /// This function is not part of the graphics API, it mustn't be
+    /// used when drawing SFML entities. It must be used only if you
+    /// mix `sf::IndexBuffer` with OpenGL code.
+    ///
+    /// \param indexBuffer Pointer to the index buffer to bind, can be null to use no index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    static void bind(const IndexBuffer* indexBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports index buffers
+    ///
+    /// Index buffers are available whenever vertex buffers are.
+    /// If this function returns `false`, then any attempt to use
+    /// `sf::IndexBuffer` will fail.
+    ///
+    /// \return `true` if index buffers are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{};             //!< Internal buffer identifier
+    std::size_t  m_size{};               //!< Size in indices of the currently allocated buffer
+    Usage        m_usage{Usage::Stream}; //!< How this index buffer is to be used
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Swap the contents of one index buffer with those of another
+///
+/// \param left First instance to swap
+/// \param right Second instance to swap
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void swap(IndexBuffer& left, IndexBuffer& right) noexcept;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::IndexBuffer
+/// \ingroup graphics
+///
+/// `sf::IndexBuffer` is a simple wrapper around a dynamic
+/// buffer of 16-bit vertex indices stored in graphics memory.
+///
+/// Indexed drawing lets several primitives share vertices.
+/// For example, a quad drawn as two triangles needs 6 vertices
+/// without indices, but only 4 vertices and 6 indices with them.
+/// In quad-heavy scenes such as tile maps, this reduces the amount
+/// of vertex data that has to be stored and transferred by about
+/// a third.
+///
+/// An index buffer is drawn together with a `sf::VertexBuffer`,
+/// whose primitive type defines how the indexed vertices are
+/// interpreted. Since indices are 16-bit, only the first 65536
+/// vertices of the vertex buffer can be referenced.
+///
+/// Example:
+/// \code
+/// std::array<sf::Vertex, 4> vertices = ...;
+/// std::array<sf::IndexBuffer::Index, 6> indices = {0, 1, 2, 2, 1, 3};
+///
+/// sf::VertexBuffer quad(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static);
+/// quad.create(vertices.size());
+/// quad.update(vertices.data());
+///
+/// sf::IndexBuffer quadIndices(sf::IndexBuffer::Usage::Static);
+/// quadIndices.create(indices.size());
+/// quadIndices.update(indices.data());
+/// ...
+/// window.draw(quad, quadIndices);
+/// \endcode
+///
+/// \see `sf::VertexBuffer`, `sf::RenderTarget`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Per-instance attributes used to draw many copies of a mesh at once
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API InstanceBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Attributes of a single instance
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Instance
+    {
+        Transform transform;                           //!< Transform applied to the mesh before the render states transform
+        Color     color{Color::White};                 //!< Color multiplied with the color of the mesh vertices
+        FloatRect textureRect{{0.f, 0.f}, {1.f, 1.f}}; //!< Rectangle the texture coordinates of the mesh are mapped to
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// Instance buffers share the usage specifiers of vertex buffers.
+    ///
+    /// \see `sf::VertexBuffer::Usage`
+    ///
+    ////////////////////////////////////////////////////////////
+    using Usage = VertexBuffer::Usage;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty instance buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    InstanceBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an `InstanceBuffer` with a specific usage specifier
+    ///
+    /// Creates an empty instance buffer and sets its usage to \p usage.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit InstanceBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    InstanceBuffer(const InstanceBuffer& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~InstanceBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the instance buffer
+    ///
+    /// Allocates enough memory to hold `instanceCount` instances,
+    /// which are all reset to their default attributes. Any
+    /// previously allocated memory is freed in the process.
+    ///
+    /// Graphics memory is only allocated if hardware instancing
+    /// is available, the instances are otherwise only kept in
+    /// system memory.
+    ///
+    /// \param instanceCount Number of instances worth of memory to allocate
+    ///
+    /// \return `true` if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t instanceCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the instance count
+    ///
+    /// \return Number of instances in the instance buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getInstanceCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer from an array of instances
+    ///
+    /// The instance array is assumed to have the same size as
+    /// the created buffer.
+    ///
+    /// No additional check is performed on the size of the instance
+    /// array. Passing invalid arguments will lead to undefined
+    /// behavior.
+    ///
+    /// This function does nothing if `instances` is null.
+    ///
+    /// \param instances Array of instances to copy to the buffer
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const Instance* instances);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of instances
+    ///
+    /// `offset` is specified as the number of instances to skip
+    /// from the beginning of the buffer.
+    ///
+    /// If `offset` is 0 and `instanceCount` is greater than the
+    /// size of the currently created buffer, the buffer is grown
+    /// to hold the instances.
+    ///
+    /// If `offset` is not 0 and `offset` + `instanceCount` is greater
+    /// than the size of the currently created buffer, the update fails.
+    ///
+    /// No additional check is performed on the size of the instance
+    /// array. Passing invalid arguments will lead to undefined
+    /// behavior.
+    ///
+    /// \param instances     Array of instances to copy to the buffer
+    /// \param instanceCount Number of instances to copy
+    /// \param offset        Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const Instance* instances, std::size_t instanceCount, std::size_t offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get read access to the instances of the buffer
+    ///
+    /// \return Pointer to the instances, or a null pointer if the buffer is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Instance* getInstances() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    InstanceBuffer& operator=(const InstanceBuffer& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the contents of this instance buffer with those of another
+    ///
+    /// \param right Instance to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(InstanceBuffer& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the instance buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the instance buffer or 0 if not created in graphics memory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this instance buffer
+    ///
+    /// This function provides a hint about how this instance buffer is
+    /// going to be used in terms of data update frequency.
+    ///
+    /// After changing the usage specifier, the instance buffer has
+    /// to be updated with new data for the usage specifier to
+    /// take effect.
+    ///
+    /// The default usage type is `sf::InstanceBuffer::Usage::Stream`.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this instance buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports hardware instancing
+    ///
+    /// Hardware instancing requires OpenGL 3.3 and shaders. When
+    /// it is not available, `sf::RenderTarget::drawInstanced`
+    /// falls back to expanding the instances on the CPU, which
+    /// produces the same result at a much higher cost.
+    ///
+    /// \return `true` if hardware instancing is supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload a range of instances to graphics memory
+    ///
+    /// \param offset        Index of the first instance to upload
+    /// \param instanceCount Number of instances to upload
+    ///
+    /// \return `true` if the upload was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool upload(std::size_t offset, std::size_t instanceCount);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Instance> m_instances;            //!< Instances kept in system memory
+    unsigned int          m_buffer{};             //!< Internal buffer identifier
+    std::size_t           m_bufferSize{};         //!< Size in instances of the allocated graphics memory
+    Usage                 m_usage{Usage::Stream}; //!< How this instance buffer is to be used
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Swap the contents of one instance buffer with those of another
+///
+/// \param left First instance to swap
+/// \param right Second instance to swap
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void swap(InstanceBuffer& left, InstanceBuffer& right) noexcept;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::InstanceBuffer
+/// \ingroup graphics
+///
+/// `sf::InstanceBuffer` stores the per-instance attributes used
+/// to draw many copies of the same mesh with a single call to
+/// `sf::RenderTarget::drawInstanced`. Each instance has its own
+/// transform, color and texture rectangle:
+/// \li the transform is applied to the mesh vertices, before
+///     the transform of the render states
+/// \li the color is multiplied with the color of the mesh vertices
+/// \li the texture coordinates of the mesh vertices are scaled by
+///     the size of the texture rectangle and offset by its position,
+///     so a mesh whose texture coordinates lie in [0, 1] shows
+///     exactly the texture rectangle of each instance. The default
+///     rectangle leaves the texture coordinates unchanged.
+///
+/// The instances are kept in system memory, and mirrored in
+/// graphics memory when hardware instancing is available.
+///
+/// Example:
+/// \code
+/// sf::VertexBuffer bullet(sf::PrimitiveType::TriangleStrip, sf::VertexBuffer::Usage::Static);
+/// ... // create a unit quad with texture coordinates in [0, 1]
+///
+/// std::vector<sf::InstanceBuffer::Instance> instances(bullets.size());
+/// for (std::size_t i = 0; i < bullets.size(); ++i)
+/// {
+///     instances[i].transform.translate(bullets[i].position).scale({8.f, 8.f});
+///     instances[i].color       = bullets[i].color;
+///     instances[i].textureRect = sf::FloatRect({0.f, 0.f}, {16.f, 16.f});
+/// }
+///
+/// sf::InstanceBuffer instanceBuffer(sf::InstanceBuffer::Usage::Stream);
+/// instanceBuffer.update(instances.data(), instances.size(), 0);
+/// ...
+/// window.drawInstanced(bullet, instanceBuffer, instances.size(), &bulletTexture);
+/// \endcode
+///
+/// \see `sf::VertexBuffer`, `sf::RenderTarget::drawInstanced`
+///
+////////////////////////////////////////////////////////////
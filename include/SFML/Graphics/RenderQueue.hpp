@@ -0,0 +1,221 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <array>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+class VertexBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Queue of draws sorted by layer and render states
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderQueue
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit primitives defined by an array of vertices
+    ///
+    /// The vertices are copied into the queue and transformed
+    /// by the transform of \a states right away, so that draws
+    /// with different transforms can be merged together.
+    ///
+    /// \param layer       Layer of the draw, lower layers are drawn first
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void submit(int                 layer,
+                const Vertex*       vertices,
+                std::size_t         vertexCount,
+                PrimitiveType       type,
+                const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit primitives defined by a vertex buffer
+    ///
+    /// Only a reference to the vertex buffer is recorded, it
+    /// must stay alive until the queue is flushed. Since the
+    /// area covered by a vertex buffer is unknown, it is never
+    /// reordered with the draws of its layer which use
+    /// different render states.
+    ///
+    /// \param layer        Layer of the draw, lower layers are drawn first
+    /// \param vertexBuffer Vertex buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void submit(int layer, const VertexBuffer& vertexBuffer, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the submitted draws to a render target and clear the queue
+    ///
+    /// Layers are drawn in increasing order. Within a layer,
+    /// draws are grouped by shader, texture and blend mode, and
+    /// consecutive vertex arrays sharing the same render states
+    /// are drawn with a single draw call. A draw is never moved
+    /// before an earlier draw of its layer that it overlaps, so
+    /// the result is the same as drawing in submission order.
+    ///
+    /// \param target Render target to draw to
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush(RenderTarget& target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the submitted draws without drawing them
+    ///
+    /// The memory used by the queue is kept, so that it can be
+    /// filled again every frame without new allocations.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the queue contains no draw
+    ///
+    /// \return `true` if the queue is empty, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEmpty() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the number of submitted draws
+    ///
+    /// \return Number of draws waiting in the queue
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getDrawCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Submitted draw
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Draw
+    {
+        int                      layer{};        //!< Layer of the draw
+        PrimitiveType            type{};         //!< Type of primitives to draw
+        RenderStates             states;         //!< Render states to use for drawing
+        const VertexBuffer*      vertexBuffer{}; //!< Vertex buffer to draw, or a null pointer to draw submitted vertices
+        std::size_t              firstVertex{};  //!< Index of the first vertex, in the vertex buffer or the submitted vertices
+        std::size_t              vertexCount{};  //!< Number of vertices to draw
+        std::optional<FloatRect> bounds;         //!< Area covered by the draw, or no value if it is unknown
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render states of a draw, packed in the order used to sort draws
+    ///
+    ////////////////////////////////////////////////////////////
+    using SortKey = std::array<std::uint64_t, 4>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Table mapping shaders and textures to their order of first appearance
+    ///
+    ////////////////////////////////////////////////////////////
+    using ObjectIdTable = std::unordered_map<const void*, std::uint64_t>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the drawing order of the submitted draws
+    ///
+    ////////////////////////////////////////////////////////////
+    void sort();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Draw>        m_draws;     //!< Submitted draws
+    std::vector<Vertex>      m_vertices;  //!< Vertices of all the submitted vertex arrays
+    std::vector<std::size_t> m_order;     //!< Indices of the draws, in drawing order
+    std::vector<SortKey>     m_keys;      //!< Render states of each draw, built once per flush
+    std::vector<std::size_t> m_levels;    //!< Position of each draw within its layer after which it can't be reordered
+    std::vector<Vertex>      m_merged;    //!< Vertices of merged draws
+    ObjectIdTable            m_objectIds; //!< Order of first appearance of the shaders and textures of the draws
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderQueue
+/// \ingroup graphics
+///
+/// Drawing a scene in its natural order (for example tile by
+/// tile, or entity by entity) often alternates between textures,
+/// shaders and blend modes, and each change costs a state change
+/// and a separate draw call. `sf::RenderQueue` collects the draws
+/// of a frame and reorders them to minimize these changes.
+///
+/// Every draw is submitted with a layer: layers are drawn in
+/// increasing order, and draws of the same layer are sorted
+/// by shader, texture and blend mode. Draws of the same layer
+/// are only reordered when this doesn't change the result: a
+/// draw always stays after the earlier draws that it overlaps,
+/// based on the bounding rectangle of its vertices.
+///
+/// Vertex arrays are copied into the queue, and vertex buffers,
+/// textures and shaders are only referenced: they must stay
+/// alive and unchanged until the queue is flushed.
+///
+/// Example:
+/// \code
+/// sf::RenderQueue queue;
+///
+/// for (const Tile& tile : tiles)
+///     queue.submit(0, tile.vertices.data(), 4, sf::PrimitiveType::TriangleStrip, &tile.texture);
+///
+/// for (const Entity& entity : entities)
+///     queue.submit(1, entity.vertices.data(), entity.vertices.size(), sf::PrimitiveType::Triangles, entity.states);
+///
+/// window.clear();
+/// queue.flush(window);
+/// window.display();
+/// \endcode
+///
+/// \see `sf::RenderTarget`, `sf::DrawList`
+///
+////////////////////////////////////////////////////////////
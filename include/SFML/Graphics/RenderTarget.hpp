@@ -32,6 +32,7 @@
 #include <SFML/Graphics/BlendMode.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/CoordinateType.hpp>
+#include <SFML/Graphics/ImageRequest.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
@@ -42,6 +43,8 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <array>
+#include <memory>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -50,6 +53,9 @@
 namespace sf
 {
 class Drawable;
+class DrawList;
+class IndexBuffer;
+class InstanceBuffer;
 class Shader;
 class Texture;
 class Transform;
@@ -62,11 +68,30 @@ class VertexBuffer;
 class SFML_GRAPHICS_API RenderTarget
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the work done by a render target
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::uint64_t drawCalls{};           //!< Number of OpenGL draw calls issued
+        std::uint64_t vertices{};            //!< Number of vertices (or indices for indexed draws) submitted by the draw calls
+        std::uint64_t streamedVertexBytes{}; //!< Number of bytes of vertex data streamed to the graphics card
+        std::uint64_t textureBinds{};        //!< Number of times a texture was bound
+        std::uint64_t shaderBinds{};         //!< Number of times a shader was bound or unbound
+        std::uint64_t blendModeChanges{};    //!< Number of times the blend mode was applied
+        std::uint64_t stencilModeChanges{};  //!< Number of times the stencil mode was applied
+        std::uint64_t viewApplications{};    //!< Number of times the current view was applied
+        std::uint64_t glStateResets{};       //!< Number of times the OpenGL states were reset
+        std::uint64_t cacheHits{};           //!< Number of states which didn't have to be applied thanks to the states cache
+        std::uint64_t cacheMisses{};         //!< Number of states which had to be applied despite the states cache
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
     ////////////////////////////////////////////////////////////
-    virtual ~RenderTarget() = default;
+    virtual ~RenderTarget();
 
     ////////////////////////////////////////////////////////////
     /// \brief Deleted copy constructor
@@ -84,13 +109,13 @@ public:
     /// \brief Move constructor
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget(RenderTarget&&) noexcept = default;
+    RenderTarget(RenderTarget&&) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Move assignment
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget& operator=(RenderTarget&&) noexcept = default;
+    RenderTarget& operator=(RenderTarget&&) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Clear the entire target with a single color
@@ -321,6 +346,32 @@ public:
               PrimitiveType       type,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by an array of vertices
+    ///
+    /// Each index refers to a vertex of the array, which allows
+    /// vertices shared by several primitives (such as the corners
+    /// of a quad made of two triangles) to be specified only once.
+    /// All indices must be lower than \a vertexCount.
+    ///
+    /// Indexed draws are never batched, any pending batched draw
+    /// is submitted first.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint16_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw primitives defined by a vertex buffer
     ///
@@ -344,6 +395,178 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by a vertex buffer
+    ///
+    /// The primitives are assembled from the vertices of
+    /// \a vertexBuffer referenced by the indices of \a indexBuffer,
+    /// using the primitive type of the vertex buffer.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by a vertex buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param firstIndex   Index of the first index to render
+    /// \param indexCount   Number of indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the commands recorded in a draw list
+    ///
+    /// The commands are submitted in the order they were
+    /// recorded, each with its own render states. The transform
+    /// of \a states is combined with the transform of every
+    /// command, the other members of \a states are ignored.
+    ///
+    /// \param drawList List of commands to draw
+    /// \param states   Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const DrawList& drawList, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw many copies of a mesh with per-instance attributes
+    ///
+    /// The mesh is drawn once for each of the first \a instanceCount
+    /// instances of \a instances, with the transform, color and
+    /// texture rectangle of the instance applied to it (see
+    /// `sf::InstanceBuffer` for details).
+    ///
+    /// When `sf::InstanceBuffer::isAvailable()` returns `true` and
+    /// no shader is set in \a states, all the copies are drawn
+    /// with a single instanced draw call. Otherwise the instances
+    /// are expanded on the CPU into a single vertex array, which
+    /// requires reading the mesh back from graphics memory and
+    /// is much slower. The fallback is not supported on OpenGL ES.
+    ///
+    /// \param mesh          Vertex buffer holding the mesh to draw
+    /// \param instances     Instance buffer holding the attributes of each copy
+    /// \param instanceCount Number of instances to draw
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstanced(const VertexBuffer&   mesh,
+                       const InstanceBuffer& instances,
+                       std::size_t           instanceCount,
+                       const RenderStates&   states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable automatic batching of draw calls
+    ///
+    /// When batching is enabled, consecutive draws of vertex
+    /// arrays (which includes sprites, shapes and texts) that
+    /// use the same texture, shader, blend mode and stencil mode
+    /// are not sent to the graphics card immediately. Their
+    /// vertices are transformed on the CPU and accumulated into
+    /// a single buffer, which is submitted with one draw call
+    /// when the render states change, when `flush` is called or
+    /// when the target is displayed.
+    ///
+    /// Since drawing is deferred, the textures and shaders used
+    /// by pending draws must stay alive and unchanged until the
+    /// batch is flushed. If you modify the uniforms of a shader
+    /// between two draws that use it, call `flush` first.
+    ///
+    /// Disabling batching flushes any pending draws.
+    /// Batching is disabled by default.
+    ///
+    /// \param enabled `true` to enable batching, `false` to disable it
+    ///
+    /// \see `isBatchingEnabled`, `flush`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBatchingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether automatic batching of draw calls is enabled
+    ///
+    /// \return `true` if batching is enabled, `false` otherwise
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isBatchingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit the draws accumulated in the current batch
+    ///
+    /// This function does nothing if batching is disabled or
+    /// if no draw is pending. It is called automatically when
+    /// the render states change, before the target is cleared,
+    /// before its view changes and when it is displayed, so you
+    /// only need to call it yourself before mixing SFML drawing
+    /// with direct OpenGL calls or before modifying a resource
+    /// used by a pending draw.
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the rendering statistics of the target
+    ///
+    /// The statistics accumulate since the creation of the target
+    /// or the last call to `resetStatistics`. Resetting them once
+    /// per frame gives the amount of work done per frame.
+    ///
+    /// \return Statistics accumulated since the last reset
+    ///
+    /// \see `resetStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Statistics& getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset all the rendering statistics to zero
+    ///
+    /// \see `getStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Request a copy of the contents of the target without blocking
+    ///
+    /// The pixels currently drawn on the target are copied into a
+    /// pixel buffer object, and can be retrieved from the returned
+    /// request once the copy has completed, usually one or two
+    /// frames later. Pending batched draws are submitted first.
+    ///
+    /// For a render window, this function must be called before
+    /// `display`, which leaves the contents of the back buffer
+    /// undefined. For a multisampled render texture, call
+    /// `display` and use `getTexture().requestImageAsync()`
+    /// instead.
+    ///
+    /// If asynchronous read back is not supported (for example
+    /// with OpenGL ES), the pixels are read back right away and
+    /// the returned request is already ready.
+    ///
+    /// \return Request giving access to the contents of the target
+    ///
+    /// \see `sf::Texture::requestImageAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] ImageRequest requestImageAsync();
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -455,7 +678,7 @@ protected:
     /// \brief Default constructor
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget() = default;
+    RenderTarget();
 
     ////////////////////////////////////////////////////////////
     /// \brief Performs the common initialization step after creation
@@ -514,6 +737,84 @@ private:
     ////////////////////////////////////////////////////////////
     void applyShader(const Shader* shader);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices right away
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices, or a null pointer to draw the vertices in order
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertices(const Vertex*        vertices,
+                      std::size_t          vertexCount,
+                      const std::uint16_t* indices,
+                      std::size_t          indexCount,
+                      PrimitiveType        type,
+                      const RenderStates&  states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer right away
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer, or a null pointer to draw the vertices in order
+    /// \param first        Index of the first vertex or index to render
+    /// \param count        Number of vertices or indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertexBuffer(const VertexBuffer& vertexBuffer,
+                          const IndexBuffer*  indexBuffer,
+                          std::size_t         first,
+                          std::size_t         count,
+                          const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw instances with a single instanced draw call
+    ///
+    /// \param mesh          Vertex buffer holding the mesh to draw
+    /// \param instances     Instance buffer holding the attributes of each copy
+    /// \param instanceCount Number of instances to draw
+    /// \param states        Render states to use for drawing
+    ///
+    /// \return `true` if the instances could be drawn, `false` if the fallback has to be used
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool drawInstancedHardware(const VertexBuffer&   mesh,
+                                             const InstanceBuffer& instances,
+                                             std::size_t           instanceCount,
+                                             const RenderStates&   states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw instances by expanding them on the CPU
+    ///
+    /// \param mesh          Vertex buffer holding the mesh to draw
+    /// \param instances     Instance buffer holding the attributes of each copy
+    /// \param instanceCount Number of instances to draw
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstancedExpanded(const VertexBuffer&   mesh,
+                               const InstanceBuffer& instances,
+                               std::size_t           instanceCount,
+                               const RenderStates&   states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append primitives to the current batch
+    ///
+    /// The current batch is flushed first if it can't be
+    /// merged with the new primitives.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void batchVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states);
+
     ////////////////////////////////////////////////////////////
     /// \brief Setup environment for drawing
     ///
@@ -533,6 +834,16 @@ private:
     ////////////////////////////////////////////////////////////
     void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the primitives referenced by indices
+    ///
+    /// \param type       Type of primitives to draw
+    /// \param indices    Pointer to the indices, or offset into the bound index buffer
+    /// \param indexCount Number of indices to use when drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedPrimitives(PrimitiveType type, const void* indices, std::size_t indexCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
     ///
@@ -547,27 +858,57 @@ private:
     ////////////////////////////////////////////////////////////
     struct StatesCache
     {
-        bool                  enable{};                //!< Is the cache enabled?
-        bool                  glStatesSet{};           //!< Are our internal GL states set yet?
-        bool                  viewChanged{};           //!< Has the current view changed since last draw?
-        bool                  scissorEnabled{};        //!< Is scissor testing enabled?
-        bool                  stencilEnabled{};        //!< Is stencil testing enabled?
-        BlendMode             lastBlendMode;           //!< Cached blending mode
-        StencilMode           lastStencilMode;         //!< Cached stencil
-        std::uint64_t         lastTextureId{};         //!< Cached texture
-        CoordinateType        lastCoordinateType{};    //!< Texture coordinate type
-        bool                  texCoordsArrayEnabled{}; //!< Is `GL_TEXTURE_COORD_ARRAY` client state enabled?
-        bool                  useVertexCache{};        //!< Did we previously use the vertex cache?
-        std::array<Vertex, 4> vertexCache{};           //!< Pre-transformed vertices cache
+        bool                   enable{};                //!< Is the cache enabled?
+        bool                   glStatesSet{};           //!< Are our internal GL states set yet?
+        bool                   viewChanged{};           //!< Has the current view changed since last draw?
+        bool                   scissorEnabled{};        //!< Is scissor testing enabled?
+        bool                   stencilEnabled{};        //!< Is stencil testing enabled?
+        BlendMode              lastBlendMode;           //!< Cached blending mode
+        StencilMode            lastStencilMode;         //!< Cached stencil
+        std::uint64_t          lastTextureId{};         //!< Cached texture
+        CoordinateType         lastCoordinateType{};    //!< Texture coordinate type
+        bool                   texCoordsArrayEnabled{}; //!< Is `GL_TEXTURE_COORD_ARRAY` client state enabled?
+        bool                   useVertexCache{};        //!< Did we previously use the vertex cache?
+        std::array<Vertex, 64> vertexCache{};           //!< Pre-transformed vertices cache
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pending draws accumulated while batching is enabled
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        bool                enabled{};                      //!< Is batching enabled?
+        PrimitiveType       type{PrimitiveType::Triangles}; //!< Type of primitives stored in the batch
+        RenderStates        states;                         //!< Render states shared by all the pending draws
+        std::uint64_t       textureId{};                    //!< Cache identifier of the texture when the batch was started
+        std::vector<Vertex> vertices;                       //!< Pre-transformed vertices of the pending draws
+        std::vector<Vertex> scratch;                        //!< Vertices being submitted by `flush`
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resources used to draw instances
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Instancing
+    {
+        std::unique_ptr<Shader> shader;               //!< Shader consuming the instance attributes, created on first use
+        bool                    shaderFailed{};       //!< Did the creation of the shader fail?
+        std::array<int, 4>      attributeLocations{}; //!< Locations of the instance attributes in the shader
+        std::vector<Vertex>     mesh;                 //!< Mesh read back from graphics memory by the fallback
+        std::vector<Vertex>     vertices;             //!< Instances expanded on the CPU by the fallback
     };
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View          m_defaultView; //!< Default view
-    View          m_view;        //!< Current view
-    StatesCache   m_cache{};     //!< Render states cache
-    std::uint64_t m_id{};        //!< Unique number that identifies the RenderTarget
+    View          m_defaultView;           //!< Default view
+    View          m_view;                  //!< Current view
+    StatesCache   m_cache{};               //!< Render states cache
+    Batch         m_batch;                 //!< Draws waiting to be submitted together
+    Instancing    m_instancing;            //!< Resources used to draw instances
+    Statistics    m_statistics;            //!< Work done since the last reset of the statistics
+    std::uint64_t m_id{};                  //!< Unique number that identifies the RenderTarget
 };
 
 } // namespace sf
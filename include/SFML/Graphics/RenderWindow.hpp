@@ -198,6 +198,17 @@ protected:
     ////////////////////////////////////////////////////////////
     void onResize() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the window is displayed
+    ///
+    /// Submits the draws that are still pending in the current
+    /// batch (see `RenderTarget::setBatchingEnabled`), whether
+    /// `display` is called on the `RenderWindow` or on its
+    /// `Window` base.
+    ///
+    ////////////////////////////////////////////////////////////
+    void onDisplay() override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
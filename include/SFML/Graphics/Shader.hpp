@@ -37,14 +37,19 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <cstddef>
+#include <cstdint>
 
 
 namespace sf
 {
 class InputStream;
+class ShaderRequest;
 class Texture;
+class UniformBuffer;
 
 ////////////////////////////////////////////////////////////
 /// \brief Shader class (vertex, geometry and fragment)
@@ -84,6 +89,78 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static inline CurrentTextureType CurrentTexture;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Pre-resolved location of a uniform variable
+    ///
+    /// Handles are returned by `getUniformHandle` and let the
+    /// `setUniform` overloads skip looking the variable up by
+    /// name. A handle belongs to the shader that created it and
+    /// stays valid until that shader is loaded again. Setting a
+    /// uniform with a handle from another shader or from before
+    /// the shader was loaded again reports an error and does
+    /// nothing.
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    class UniformHandle
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Creates an invalid handle, setting its value does nothing.
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformHandle() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the handle refers to an existing uniform
+        ///
+        /// \return `true` if the uniform was found in the shader, `false` otherwise
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isValid() const
+        {
+            return m_location != -1;
+        }
+
+    private:
+        friend class Shader;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct the handle from a location in a program
+        ///
+        /// \param location          Location of the uniform in the program
+        /// \param programGeneration Generation of the program the location belongs to
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformHandle(int location, std::uint64_t programGeneration) :
+        m_location(location),
+        m_programGeneration(programGeneration)
+        {
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        int           m_location{-1};        //!< Location of the uniform in the program
+        std::uint64_t m_programGeneration{}; //!< Generation of the program the location belongs to
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the use of the program binary cache
+    ///
+    /// \see `setProgramCacheDirectory`, `getProgramCacheStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ProgramCacheStatistics
+    {
+        std::uint64_t hits{};          //!< Number of programs loaded from the cache instead of being compiled
+        std::uint64_t misses{};        //!< Number of programs which had to be compiled while the cache was enabled
+        std::uint64_t invalidations{}; //!< Number of cache entries rejected because they were stale or corrupted
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -514,6 +591,88 @@ public:
                                       InputStream& geometryShaderStream,
                                       InputStream& fragmentShaderStream);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading the vertex and fragment shaders from files asynchronously
+    ///
+    /// The files are read right away, then the shaders are
+    /// compiled and linked without blocking the calling thread.
+    /// The returned request gives the shader once linking
+    /// finishes, see `sf::ShaderRequest`.
+    ///
+    /// \param vertexShaderFilename   Path of the vertex shader file to load
+    /// \param fragmentShaderFilename Path of the fragment shader file to load
+    ///
+    /// \return Request giving the shader once it is compiled
+    ///
+    /// \see `loadFromMemoryAsync`, `loadFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static ShaderRequest loadFromFileAsync(const std::filesystem::path& vertexShaderFilename,
+                                                         const std::filesystem::path& fragmentShaderFilename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading the vertex, geometry and fragment shaders from files asynchronously
+    ///
+    /// The files are read right away, then the shaders are
+    /// compiled and linked without blocking the calling thread.
+    /// The returned request gives the shader once linking
+    /// finishes, see `sf::ShaderRequest`.
+    ///
+    /// \param vertexShaderFilename   Path of the vertex shader file to load
+    /// \param geometryShaderFilename Path of the geometry shader file to load
+    /// \param fragmentShaderFilename Path of the fragment shader file to load
+    ///
+    /// \return Request giving the shader once it is compiled
+    ///
+    /// \see `loadFromMemoryAsync`, `loadFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static ShaderRequest loadFromFileAsync(const std::filesystem::path& vertexShaderFilename,
+                                                         const std::filesystem::path& geometryShaderFilename,
+                                                         const std::filesystem::path& fragmentShaderFilename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading the vertex and fragment shaders from source codes in memory asynchronously
+    ///
+    /// The source codes are copied, so they don't need to
+    /// outlive the call. The shaders are compiled and linked
+    /// without blocking the calling thread, and the returned
+    /// request gives the shader once linking finishes, see
+    /// `sf::ShaderRequest`.
+    ///
+    /// \param vertexShader   String containing the source code of the vertex shader
+    /// \param fragmentShader String containing the source code of the fragment shader
+    ///
+    /// \return Request giving the shader once it is compiled
+    ///
+    /// \see `loadFromFileAsync`, `loadFromMemory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static ShaderRequest loadFromMemoryAsync(std::string_view vertexShader,
+                                                           std::string_view fragmentShader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading the vertex, geometry and fragment shaders from source codes in memory asynchronously
+    ///
+    /// The source codes are copied, so they don't need to
+    /// outlive the call. The shaders are compiled and linked
+    /// without blocking the calling thread, and the returned
+    /// request gives the shader once linking finishes, see
+    /// `sf::ShaderRequest`.
+    ///
+    /// \param vertexShader   String containing the source code of the vertex shader
+    /// \param geometryShader String containing the source code of the geometry shader
+    /// \param fragmentShader String containing the source code of the fragment shader
+    ///
+    /// \return Request giving the shader once it is compiled
+    ///
+    /// \see `loadFromFileAsync`, `loadFromMemory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static ShaderRequest loadFromMemoryAsync(std::string_view vertexShader,
+                                                           std::string_view geometryShader,
+                                                           std::string_view fragmentShader);
+
     ////////////////////////////////////////////////////////////
     /// \brief Specify value for \p float uniform
     ///
@@ -778,6 +937,326 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a handle to a uniform variable
+    ///
+    /// Looking a uniform up by name requires hashing its name
+    /// every time its value is set. When a uniform is updated
+    /// often, retrieve its handle once after loading the shader
+    /// and pass it to the `setUniform` and `setUniformArray`
+    /// overloads instead of the name.
+    ///
+    /// \code
+    /// const sf::Shader::UniformHandle time = shader.getUniformHandle("time");
+    /// ...
+    /// shader.setUniform(time, clock.getElapsedTime().asSeconds());
+    /// \endcode
+    ///
+    /// The handle is invalid if the shader is not loaded or if it
+    /// has no active uniform with this name. Loading the shader
+    /// again invalidates the handles previously retrieved from it.
+    ///
+    /// \param name Name of the uniform variable in GLSL
+    ///
+    /// \return Handle to the uniform
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] UniformHandle getUniformHandle(std::string_view name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p float uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param x       Value of the float scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, float x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec2 uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param vector  Value of the vec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, Glsl::Vec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec3 uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param vector  Value of the vec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Vec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec4 uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param vector  Value of the vec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Vec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p int uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param x       Value of the int scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, int x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec2 uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param vector  Value of the ivec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, Glsl::Ivec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec3 uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param vector  Value of the ivec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Ivec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec4 uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param vector  Value of the ivec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Ivec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bool uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param x       Value of the bool scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, bool x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec2 uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param vector  Value of the bvec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, Glsl::Bvec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec3 uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param vector  Value of the bvec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Bvec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec4 uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param vector  Value of the bvec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Bvec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat3 uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param matrix  Value of the mat3 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Mat3& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat4 uniform from its handle
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param matrix  Value of the mat4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Mat4& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify a texture as \p sampler2D uniform from its handle
+    ///
+    /// `texture` must remain alive as long as the shader uses it,
+    /// no copy is made internally.
+    ///
+    /// \param uniform Handle of the texture in the shader
+    /// \param texture Texture to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify current texture as \p sampler2D uniform from its handle
+    ///
+    /// \param uniform Handle of the texture in the shader
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, CurrentTextureType);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p float[] array uniform from its handle
+    ///
+    /// \param uniform     Handle of the uniform variable
+    /// \param scalarArray pointer to array of \p float values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const float* scalarArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec2[] array uniform from its handle
+    ///
+    /// \param uniform     Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec2 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const Glsl::Vec2* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec3[] array uniform from its handle
+    ///
+    /// \param uniform     Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec3 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const Glsl::Vec3* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec4[] array uniform from its handle
+    ///
+    /// \param uniform     Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec4 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const Glsl::Vec4* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p mat3[] array uniform from its handle
+    ///
+    /// \param uniform     Handle of the uniform variable
+    /// \param matrixArray pointer to array of \p mat3 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const Glsl::Mat3* matrixArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p mat4[] array uniform from its handle
+    ///
+    /// \param uniform     Handle of the uniform variable
+    /// \param matrixArray pointer to array of \p mat4 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const Glsl::Mat4* matrixArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Attach a uniform buffer to a uniform block
+    ///
+    /// \a name is the name of a uniform block declared in the
+    /// shader with the std140 layout. Its members take their
+    /// values from `buffer`, which can be attached to any number
+    /// of shaders at the same time, so that data shared by many
+    /// programs is uploaded only once.
+    ///
+    /// Example:
+    /// \code
+    /// layout(std140) uniform Frame // this is the block in the shader
+    /// {
+    ///     mat4  viewMatrix;
+    ///     float time;
+    /// };
+    /// \endcode
+    /// \code
+    /// sf::UniformBuffer frame;
+    /// ...
+    /// if (!shader.setUniformBlock("Frame", frame))
+    ///     ... // fall back to setUniform
+    /// \endcode
+    ///
+    /// It is important to note that `buffer` must remain alive as
+    /// long as the shader uses it, no copy is made internally.
+    ///
+    /// This function fails if uniform buffers are not supported
+    /// (see `sf::UniformBuffer::isAvailable`), if the shader has
+    /// no active block with this name, or if all the binding
+    /// points are already used.
+    ///
+    /// \param name   Name of the uniform block in the shader
+    /// \param buffer Uniform buffer to attach
+    ///
+    /// \return `true` if the buffer was attached, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setUniformBlock(const std::string& name, const UniformBuffer& buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow attaching a temporary uniform buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    bool setUniformBlock(const std::string& name, const UniformBuffer&& buffer) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable deferred uniform updates
+    ///
+    /// By default, every call to `setUniform` or `setUniformArray`
+    /// uploads the value right away, which requires binding the
+    /// program and restoring the previous one each time.
+    ///
+    /// When deferred updates are enabled, values are stored on
+    /// the CPU side instead. Setting a uniform to the value it
+    /// already holds does nothing, and all the values that changed
+    /// are uploaded in a single pass the next time the shader is
+    /// bound, either with `bind` or when something is drawn with it.
+    ///
+    /// Disabling deferred updates uploads the pending values
+    /// immediately. Textures are always assigned when the shader
+    /// is bound, so they are not affected by this setting.
+    ///
+    /// Deferred updates are disabled by default.
+    ///
+    /// \param enabled `true` to defer uniform updates, `false` to upload them immediately
+    ///
+    /// \see `isDeferredUniformsEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDeferredUniformsEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether uniform updates are deferred
+    ///
+    /// \return `true` if uniform updates are deferred until the shader is bound, `false` otherwise
+    ///
+    /// \see `setDeferredUniformsEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDeferredUniformsEnabled() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the underlying OpenGL handle of the shader.
     ///
@@ -844,23 +1323,130 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool isGeometryAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the directory of the program binary cache
+    ///
+    /// When a directory is set and the driver supports
+    /// program binaries, every successfully linked program
+    /// is saved to this directory, and loading the same
+    /// sources again later (even in another run of the
+    /// application) retrieves the binary instead of compiling
+    /// and linking the shaders again.
+    ///
+    /// Entries are keyed by the shader sources and by the
+    /// vendor, renderer and version of the OpenGL driver.
+    /// An entry which doesn't match the current driver or
+    /// which the driver refuses to load is discarded and
+    /// replaced by a freshly compiled program.
+    ///
+    /// The directory is created when the first entry is
+    /// written. An empty path disables the cache, which is
+    /// the default.
+    ///
+    /// \param directory Directory to store the cache entries in
+    ///
+    /// \see `getProgramCacheDirectory`, `getProgramCacheStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setProgramCacheDirectory(const std::filesystem::path& directory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the directory of the program binary cache
+    ///
+    /// \return Directory of the cache, empty if the cache is disabled
+    ///
+    /// \see `setProgramCacheDirectory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::filesystem::path getProgramCacheDirectory();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the program binary cache
+    ///
+    /// The statistics are shared by all shaders and accumulate
+    /// since the start of the application or the last call
+    /// to `resetProgramCacheStatistics`.
+    ///
+    /// \return Statistics accumulated since the last reset
+    ///
+    /// \see `resetProgramCacheStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static ProgramCacheStatistics getProgramCacheStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the statistics of the program binary cache to zero
+    ///
+    /// \see `getProgramCacheStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void resetProgramCacheStatistics();
+
 private:
+    friend class ShaderRequest;
+
     ////////////////////////////////////////////////////////////
     /// \brief Compile the shader(s) and create the program
     ///
     /// If one of the arguments is a null pointer, the corresponding shader
     /// is not created.
     ///
+    /// If \a checkStatus is `false`, the compile and link
+    /// statuses are not queried, so that the driver can keep
+    /// working in the background: the program is adopted right
+    /// away, and `checkProgram` must be called before using it.
+    ///
     /// \param vertexShaderCode   Source code of the vertex shader
     /// \param geometryShaderCode Source code of the geometry shader
     /// \param fragmentShaderCode Source code of the fragment shader
+    /// \param checkStatus        Wait for the program to be linked and check for errors?
     ///
     /// \return `true` on success, `false` if any error happened
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool compile(std::string_view vertexShaderCode,
                                std::string_view geometryShaderCode,
-                               std::string_view fragmentShaderCode);
+                               std::string_view fragmentShaderCode,
+                               bool             checkStatus = true);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the driver is still compiling or linking the program
+    ///
+    /// Always returns `false` if parallel shader compilation
+    /// is not supported, as the driver then finishes its work
+    /// in `checkProgram`.
+    ///
+    /// \return `true` if querying the link status would block
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isCompiling() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check the program adopted by `compile` without checking its status
+    ///
+    /// Blocks until the driver has linked the program. On
+    /// failure the compile and link logs are reported and the
+    /// program is destroyed. On success the binary of the
+    /// program is stored in the program cache, if enabled.
+    ///
+    /// \param vertexShaderCode   Source code of the vertex shader
+    /// \param geometryShaderCode Source code of the geometry shader
+    /// \param fragmentShaderCode Source code of the fragment shader
+    ///
+    /// \return `true` if the program was linked successfully
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool checkProgram(std::string_view vertexShaderCode,
+                                    std::string_view geometryShaderCode,
+                                    std::string_view fragmentShaderCode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the driver compiles shaders in parallel
+    ///
+    /// \return `true` if `GL_KHR_parallel_shader_compile` or `GL_ARB_parallel_shader_compile` is supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isParallelCompileAvailable();
 
     ////////////////////////////////////////////////////////////
     /// \brief Bind all the textures used by the shader
@@ -871,6 +1457,15 @@ private:
     ////////////////////////////////////////////////////////////
     void bindTextures() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind all the uniform buffers used by the shader
+    ///
+    /// This function binds each buffer to the binding point
+    /// assigned to its uniform block.
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindUniformBlocks() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the location ID of a shader uniform
     ///
@@ -881,6 +1476,79 @@ private:
     ////////////////////////////////////////////////////////////
     int getUniformLocation(const std::string& name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the handle of a shader uniform from its name
+    ///
+    /// Unlike `getUniformHandle`, the name doesn't have to be
+    /// copied to look it up in the location cache.
+    ///
+    /// \param name Name of the uniform variable to search
+    ///
+    /// \return Handle to the uniform
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] UniformHandle findUniform(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether a uniform handle can be used with the current program
+    ///
+    /// Invalid handles are ignored silently, since looking them
+    /// up already reported the error. Handles retrieved from
+    /// another shader or from a previous program are reported.
+    ///
+    /// \param uniform Handle of the uniform variable
+    ///
+    /// \return `true` if the value of the uniform can be set, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool checkUniform(UniformHandle uniform) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the name of a shader uniform from its location
+    ///
+    /// \param location Location ID of the uniform
+    ///
+    /// \return Name of the uniform, or an empty string if it was never looked up
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::string getUniformName(int location) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Kind of GL function used to upload a staged uniform
+    ///
+    /// Enumerators are defined in the .cpp file.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class UniformType : unsigned char;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store the value of a uniform until the shader is bound
+    ///
+    /// \param uniform Handle of the uniform variable
+    /// \param type    Kind of GL function used to upload the value
+    /// \param count   Number of array elements
+    /// \param values  Components of the value
+    /// \param size    Number of components
+    ///
+    /// \return `true` if the value was handled by the deferred
+    ///         updates, `false` if it must be uploaded immediately
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[nodiscard]] bool stageUniform(UniformHandle uniform,
+                                    UniformType   type,
+                                    std::size_t   count,
+                                    const T*      values,
+                                    std::size_t   size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the staged uniforms which changed
+    ///
+    /// The program must be bound when this function is called.
+    ///
+    ////////////////////////////////////////////////////////////
+    void uploadStagedUniforms() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief RAII object to save and restore the program
     ///        binding while uniforms are being set
@@ -896,13 +1564,34 @@ private:
     using TextureTable = std::unordered_map<int, const Texture*>;
     using UniformTable = std::unordered_map<std::string, int>;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Value of a uniform held by the deferred updates
+    ///
+    ////////////////////////////////////////////////////////////
+    struct StagedUniform
+    {
+        UniformType        type{};  //!< Kind of GL function used to upload the value
+        std::size_t        count{}; //!< Number of array elements
+        std::vector<float> floats;  //!< Components of float, vector and matrix uniforms
+        std::vector<int>   ints;    //!< Components of integer and boolean uniforms
+        bool               dirty{}; //!< Whether the value changed since it was last uploaded
+    };
+
+    using StagedUniformTable = std::unordered_map<int, StagedUniform>;
+    using UniformBlockTable  = std::vector<std::pair<unsigned int, const UniformBuffer*>>;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int m_shaderProgram{};    //!< OpenGL identifier for the program
-    int          m_currentTexture{-1}; //!< Location of the current texture in the shader
-    TextureTable m_textures;           //!< Texture variables in the shader, mapped to their location
-    UniformTable m_uniforms;           //!< Parameters location cache
+    unsigned int               m_shaderProgram{};     //!< OpenGL identifier for the program
+    std::uint64_t              m_programGeneration{}; //!< Changed each time a program is adopted, unique across shaders
+    int                        m_currentTexture{-1};  //!< Location of the current texture in the shader
+    TextureTable               m_textures;            //!< Texture variables in the shader, mapped to their location
+    UniformTable               m_uniforms;            //!< Parameters location cache
+    UniformBlockTable          m_uniformBlocks;       //!< Block indices and their buffers, indexed by binding point
+    bool                       m_deferredUniforms{};  //!< Whether uniform updates wait until the shader is bound
+    mutable StagedUniformTable m_stagedUniforms;      //!< Values of the uniforms set while updates are deferred
+    mutable std::vector<int>   m_dirtyUniforms;       //!< Locations of the staged uniforms waiting to be uploaded
 };
 
 } // namespace sf
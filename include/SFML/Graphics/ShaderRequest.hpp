@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Shader.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Pending compilation of a shader program
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ShaderRequest
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates a request which is ready and holds no shader.
+    ///
+    ////////////////////////////////////////////////////////////
+    ShaderRequest() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the shader is compiled, without blocking
+    ///
+    /// \return `true` if `takeShader` can return without waiting
+    ///
+    /// \see `wait`, `takeShader`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReady() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Block until the shader is compiled or a timeout expires
+    ///
+    /// \param timeout Maximum time to wait
+    ///
+    /// \return `true` if the shader was compiled before the timeout expired
+    ///
+    /// \see `isReady`, `takeShader`
+    ///
+    ////////////////////////////////////////////////////////////
+    bool wait(Time timeout) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take the compiled shader out of the request
+    ///
+    /// This function blocks until the shader is compiled and
+    /// linked. Call it once `isReady` returns `true` to avoid
+    /// stalling. Compile and link errors are reported to
+    /// `sf::err()` as with the synchronous load functions.
+    ///
+    /// The shader is moved out of the request: subsequent
+    /// calls, including through copies of the request,
+    /// return `std::nullopt`.
+    ///
+    /// \return Compiled shader, or `std::nullopt` if compiling failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Shader> takeShader();
+
+private:
+    friend class Shader;
+
+    struct Compilation;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start compiling a shader program asynchronously
+    ///
+    /// If one of the source codes is empty, the corresponding
+    /// shader is not created.
+    ///
+    /// \param vertexShaderCode   Source code of the vertex shader
+    /// \param geometryShaderCode Source code of the geometry shader
+    /// \param fragmentShaderCode Source code of the fragment shader
+    ///
+    /// \return New request
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static ShaderRequest start(std::string_view vertexShaderCode,
+                                             std::string_view geometryShaderCode,
+                                             std::string_view fragmentShaderCode);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::shared_ptr<Compilation> m_compilation; //!< State of the compilation, shared by all the copies of the request
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ShaderRequest
+/// \ingroup graphics
+///
+/// Compiling and linking a shader program can take from a few
+/// milliseconds to hundreds of milliseconds, during which the
+/// thread that loads the shader is blocked. Loading many
+/// shaders at startup or when a new level is entered then
+/// shows up as a visible hitch.
+///
+/// `sf::ShaderRequest` is returned by the asynchronous
+/// variants, `sf::Shader::loadFromFileAsync` and
+/// `sf::Shader::loadFromMemoryAsync`. The shader becomes
+/// available once the driver has finished linking it, and
+/// the application can keep rendering in the meantime.
+///
+/// If the driver supports `GL_KHR_parallel_shader_compile`
+/// (or its ARB equivalent), the shaders are submitted right
+/// away and the driver compiles them on its own threads.
+/// Otherwise they are compiled on a worker thread which uses
+/// its own OpenGL context, shared with the others.
+///
+/// Destroying the last copy of a request whose shader is
+/// still being compiled on a worker thread blocks until the
+/// compilation finishes.
+///
+/// Usage example:
+/// \code
+/// sf::ShaderRequest request = sf::Shader::loadFromFileAsync("blur.vert", "blur.frag");
+/// std::optional<sf::Shader> blur;
+///
+/// while (window.isOpen())
+/// {
+///     if (!blur && request.isReady())
+///         blur = request.takeShader();
+///
+///     // ... draw the frame, with the blur effect once it is available ...
+/// }
+/// \endcode
+///
+/// \see `sf::Shader::loadFromFileAsync`, `sf::Shader::loadFromMemoryAsync`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,411 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Angle.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Collection of circles and rectangles drawn in a single call
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ShapeBatch : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a circle to the batch
+    ///
+    /// The circle is filled in white and has no outline,
+    /// like a default `sf::CircleShape`.
+    ///
+    /// \param center     Position of the center of the circle
+    /// \param radius     Radius of the circle
+    /// \param pointCount Number of points used to approximate the circle, at least 3
+    ///
+    /// \return Index of the new shape in the batch
+    ///
+    /// \see `addRectangle`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t addCircle(Vector2f center, float radius, std::size_t pointCount = 30);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a rectangle to the batch
+    ///
+    /// The rectangle is filled in white and has no outline,
+    /// like a default `sf::RectangleShape`.
+    ///
+    /// \param rectangle Position and size of the rectangle
+    ///
+    /// \return Index of the new shape in the batch
+    ///
+    /// \see `addCircle`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t addRectangle(const FloatRect& rectangle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the shapes from the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve memory for a number of shapes
+    ///
+    /// \param shapeCount Number of shapes to reserve memory for
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t shapeCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of shapes in the batch
+    ///
+    /// \return Number of shapes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getShapeCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of the center of a shape
+    ///
+    /// \param index  Index of the shape
+    /// \param center New position of the center
+    ///
+    /// \see `getCenter`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCenter(std::size_t index, Vector2f center);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of the center of a shape
+    ///
+    /// \param index Index of the shape
+    ///
+    /// \return Position of the center
+    ///
+    /// \see `setCenter`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getCenter(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of a shape
+    ///
+    /// The size is the one of the bounding rectangle of the
+    /// shape before it is rotated. A circle whose size is
+    /// changed to different width and height becomes an ellipse.
+    ///
+    /// \param index Index of the shape
+    /// \param size  New size
+    ///
+    /// \see `getSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSize(std::size_t index, Vector2f size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a shape
+    ///
+    /// \param index Index of the shape
+    ///
+    /// \return Size of the shape
+    ///
+    /// \see `setSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getSize(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the rotation of a shape around its center
+    ///
+    /// \param index Index of the shape
+    /// \param angle New rotation
+    ///
+    /// \see `getRotation`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRotation(std::size_t index, Angle angle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the rotation of a shape around its center
+    ///
+    /// \param index Index of the shape
+    ///
+    /// \return Rotation of the shape
+    ///
+    /// \see `setRotation`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Angle getRotation(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the fill color of a shape
+    ///
+    /// \param index Index of the shape
+    /// \param color New fill color
+    ///
+    /// \see `getFillColor`, `setOutlineColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFillColor(std::size_t index, Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the fill color of a shape
+    ///
+    /// \param index Index of the shape
+    ///
+    /// \return Fill color of the shape
+    ///
+    /// \see `setFillColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getFillColor(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the outline color of a shape
+    ///
+    /// \param index Index of the shape
+    /// \param color New outline color
+    ///
+    /// \see `getOutlineColor`, `setFillColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutlineColor(std::size_t index, Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the outline color of a shape
+    ///
+    /// \param index Index of the shape
+    ///
+    /// \return Outline color of the shape
+    ///
+    /// \see `setOutlineColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getOutlineColor(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the thickness of the outline of a shape
+    ///
+    /// Negative values are allowed (so that the outline expands
+    /// towards the center of the shape), and using zero disables
+    /// the outline.
+    ///
+    /// \param index     Index of the shape
+    /// \param thickness New outline thickness
+    ///
+    /// \see `getOutlineThickness`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutlineThickness(std::size_t index, float thickness);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the thickness of the outline of a shape
+    ///
+    /// \param index Index of the shape
+    ///
+    /// \return Outline thickness of the shape
+    ///
+    /// \see `setOutlineThickness`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getOutlineThickness(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of points of a shape
+    ///
+    /// \param index Index of the shape
+    ///
+    /// \return Number of points of the shape, 4 for rectangles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPointCount(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the batch
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the batch, and includes
+    /// the outlines of the shapes.
+    ///
+    /// \return Local bounding rectangle of all the shapes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the batch
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the batch.
+    ///
+    /// \return Global bounding rectangle of all the shapes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the batch to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a shape to the batch
+    ///
+    /// \param center  Position of the center of the shape
+    /// \param size    Size of the shape
+    /// \param polygon Points of the shape, in a square of size 2 centered on the origin
+    ///
+    /// \return Index of the new shape in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(Vector2f center, Vector2f size, const std::vector<Vector2f>& polygon);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the geometry of a shape as needing an update
+    ///
+    /// \param index Index of the shape
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the vertices of the shapes which changed
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureGeometryUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the vertices of a shape
+    ///
+    /// \param index Index of the shape
+    ///
+    ////////////////////////////////////////////////////////////
+    void tessellate(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Vector2f>                     m_centers;            //!< Center of each shape
+    std::vector<Vector2f>                     m_sizes;              //!< Size of each shape, before rotation
+    std::vector<Angle>                        m_rotations;          //!< Rotation of each shape around its center
+    std::vector<Color>                        m_fillColors;         //!< Fill color of each shape
+    std::vector<Color>                        m_outlineColors;      //!< Outline color of each shape
+    std::vector<float>                        m_outlineThicknesses; //!< Outline thickness of each shape
+    std::vector<const std::vector<Vector2f>*> m_polygons;           //!< Cached unit polygon of each shape
+    mutable std::vector<std::uint8_t>         m_dirty;              //!< Does the geometry of each shape need an update?
+    mutable std::vector<std::size_t>          m_dirtyShapes;        //!< Indices of the shapes whose geometry changed
+    mutable std::vector<std::size_t>          m_firstVertices;      //!< Index of the first vertex of each shape
+    mutable std::vector<Vertex>               m_vertices;           //!< Fill and outline triangles of all the shapes
+    mutable std::vector<Vector2f>             m_points;             //!< Scratch buffer for the points of a shape
+    mutable VertexBuffer                      m_vertexBuffer;       //!< Copy of the vertices in graphics memory
+    mutable bool                              m_layoutNeedUpdate{}; //!< Must all the shapes be laid out again?
+    mutable std::size_t                       m_uploadBegin{};      //!< Start of the vertices to upload
+    mutable std::size_t                       m_uploadEnd{};        //!< End of the vertices to upload
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ShapeBatch
+/// \ingroup graphics
+///
+/// Every `sf::Shape` owns its own vertices and is drawn with
+/// a draw call for its inside and another one for its outline.
+/// This is convenient for a few shapes, but it becomes the
+/// bottleneck when thousands of them are drawn every frame,
+/// for example in debug overlays or data visualizations.
+///
+/// `sf::ShapeBatch` stores the parameters of many circles and
+/// rectangles in contiguous arrays, and tessellates the insides
+/// and the outlines of all the shapes into a single triangle
+/// list which is drawn in one call. Circles share precomputed
+/// tables of points, so no trigonometry is involved when a
+/// circle is moved, resized or recolored, and only the shapes
+/// which changed since the last draw are tessellated and
+/// uploaded to graphics memory again.
+///
+/// The shapes are drawn in the order in which they were added,
+/// each outline on top of the inside of its shape. Shapes are
+/// identified by the index returned when they are added, and
+/// can't be textured.
+///
+/// Like other drawables, the batch as a whole can be
+/// transformed, which applies on top of the center, size and
+/// rotation of each shape.
+///
+/// Usage example:
+/// \code
+/// sf::ShapeBatch markers;
+/// markers.reserve(samples.size());
+/// for (const Sample& sample : samples)
+/// {
+///     const std::size_t index = markers.addCircle(sample.position, 3.f, 12);
+///     markers.setFillColor(index, sample.color);
+///     markers.setOutlineThickness(index, 1.f);
+///     markers.setOutlineColor(index, sf::Color::Black);
+/// }
+///
+/// // Move a single marker, only its vertices are recomputed
+/// markers.setCenter(selected, mousePosition);
+///
+/// window.draw(markers);
+/// \endcode
+///
+/// \see `sf::Shape`, `sf::CircleShape`, `sf::RectangleShape`
+///
+////////////////////////////////////////////////////////////
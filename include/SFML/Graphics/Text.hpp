@@ -40,6 +40,8 @@
 #include <SFML/System/String.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <vector>
+
 #include <cstddef>
 #include <cstdint>
 
@@ -390,7 +392,55 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] FloatRect getGlobalBounds() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw only the lines of the text visible in the current view
+    ///
+    /// Lines which are entirely outside of the area covered
+    /// by the current view of \a target are not submitted,
+    /// so that the cost of drawing a long scrolling text
+    /// doesn't depend on its length.
+    ///
+    /// \param target Render target to draw to
+    /// \param states Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVisible(RenderTarget& target, const RenderStates& states = RenderStates::Default) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw only the lines of the text that intersect an area
+    ///
+    /// \a area is expressed in the same coordinate system as
+    /// the view of \a target, i.e. before \a states.transform
+    /// and the text's own transform are applied. Lines which
+    /// are entirely above or below it are not submitted.
+    ///
+    /// \param target Render target to draw to
+    /// \param area   Area outside of which lines can be skipped
+    /// \param states Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVisible(RenderTarget& target, const FloatRect& area, RenderStates states = RenderStates::Default) const;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief State of the layout algorithm at a given character
+    ///
+    /// Checkpoints are saved at the start of each line and at
+    /// the end of the string, so that the geometry update can
+    /// resume from there instead of starting over.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct LayoutCheckpoint
+    {
+        std::size_t   index{};              //!< Index of the next character to lay out
+        std::size_t   vertexCount{};        //!< Number of fill vertices generated before that character
+        std::size_t   outlineVertexCount{}; //!< Number of outline vertices generated before that character
+        Vector2f      position;             //!< Position of the pen
+        std::uint32_t prevChar{};           //!< Previously laid out character, for kerning
+        Vector2f      min;                  //!< Minimum coordinates of the bounds so far
+        Vector2f      max;                  //!< Maximum coordinates of the bounds so far
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the text to a render target
     ///
@@ -406,9 +456,24 @@ private:
     /// All the attributes related to rendering are cached, such
     /// that the geometry is only updated when necessary.
     ///
+    /// If the font's page is rebuilt while the glyphs are loaded,
+    /// the quads added before the rebuild point to glyphs which
+    /// have moved: the text is then laid out a second time.
+    ///
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the text's geometry if it changed
+    ///
+    /// When only the string changed, the layout resumes from the
+    /// last checkpoint before the first modified character: the
+    /// end of the string if characters were only appended, the
+    /// start of the first modified line otherwise.
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateGeometry() const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -426,6 +491,11 @@ private:
     mutable FloatRect     m_bounds;               //!< Bounding rectangle of the text (in local coordinates)
     mutable bool          m_geometryNeedUpdate{}; //!< Does the geometry need to be recomputed?
     mutable std::uint64_t m_fontTextureId{};      //!< The font texture id
+    mutable std::size_t   m_layoutStart{};        //!< Index of the first character whose geometry is out of date
+    mutable std::vector<LayoutCheckpoint> m_lineCheckpoints; //!< Layout state at the start of each line
+    mutable LayoutCheckpoint              m_endCheckpoint;   //!< Layout state at the end of the string
+    mutable float m_lineAscent{};  //!< Maximum extent of the geometry above the baseline of a line
+    mutable float m_lineDescent{}; //!< Maximum extent of the geometry below the baseline of a line
 };
 
 } // namespace sf
@@ -481,6 +551,15 @@ private:
 /// window.draw(text);
 /// \endcode
 ///
+/// For very long texts of which only a few lines are shown
+/// at a time, such as logs or consoles, `drawVisible` can be
+/// used instead of `draw` to skip the lines which are outside
+/// of the view:
+/// \code
+/// window.setView(scrolledView);
+/// log.drawVisible(window);
+/// \endcode
+///
 /// \see `sf::Font`, `sf::Transformable`
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,371 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+#include <SFML/System/String.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Font;
+class VertexArray;
+
+////////////////////////////////////////////////////////////
+/// \brief Layout of a text, computed from the font metrics only
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextLayout
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Placement of a visible character of the string
+    ///
+    ////////////////////////////////////////////////////////////
+    struct GlyphPlacement
+    {
+        char32_t    codePoint{}; //!< Unicode code point of the character
+        std::size_t index{};     //!< Index of the character in the string
+        Vector2f    position;    //!< Position of the pen on the baseline, in local coordinates
+        FloatRect   bounds;      //!< Bounding rectangle of the glyph, in local coordinates
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Line of the text
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Line
+    {
+        std::size_t firstGlyph{}; //!< Index of the first glyph placement of the line
+        std::size_t glyphCount{}; //!< Number of glyph placements in the line
+        float       baseline{};   //!< Vertical position of the baseline, in local coordinates
+        float       width{};      //!< Horizontal position of the pen at the end of the line
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the layout from a string, font and size
+    ///
+    /// \param font           Font used to lay out the string
+    /// \param string         Text to lay out
+    /// \param characterSize  Base size of characters, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    TextLayout(const Font& font, String string = "", unsigned int characterSize = 30);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary font
+    ///
+    ////////////////////////////////////////////////////////////
+    TextLayout(const Font&& font, String string = "", unsigned int characterSize = 30) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the string to lay out
+    ///
+    /// \param string New string
+    ///
+    /// \see `getString`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setString(const String& string);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the font used to lay out the string
+    ///
+    /// The `font` argument refers to a font that must
+    /// exist as long as the layout uses it.
+    ///
+    /// \param font New font
+    ///
+    /// \see `getFont`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFont(const Font& font);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary font
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFont(const Font&& font) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the character size
+    ///
+    /// The default size is 30.
+    ///
+    /// \param size New character size, in pixels
+    ///
+    /// \see `getCharacterSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCharacterSize(unsigned int size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the line spacing factor
+    ///
+    /// \param spacingFactor New line spacing factor
+    ///
+    /// \see `getLineSpacing`, `sf::Text::setLineSpacing`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLineSpacing(float spacingFactor);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the letter spacing factor
+    ///
+    /// \param spacingFactor New letter spacing factor
+    ///
+    /// \see `getLetterSpacing`, `sf::Text::setLetterSpacing`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLetterSpacing(float spacingFactor);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the style
+    ///
+    /// You can pass a combination of one or more styles, for
+    /// example `sf::Text::Bold | sf::Text::Italic`.
+    /// The default style is `sf::Text::Regular`.
+    ///
+    /// \param style New style
+    ///
+    /// \see `getStyle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setStyle(std::uint32_t style);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the thickness of the outline
+    ///
+    /// By default, the outline thickness is 0.
+    ///
+    /// \param thickness New outline thickness, in pixels
+    ///
+    /// \see `getOutlineThickness`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutlineThickness(float thickness);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the string
+    ///
+    /// \return String laid out
+    ///
+    /// \see `setString`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const String& getString() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the font
+    ///
+    /// \return Reference to the font
+    ///
+    /// \see `setFont`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Font& getFont() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the character size
+    ///
+    /// \return Size of the characters, in pixels
+    ///
+    /// \see `setCharacterSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getCharacterSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the line spacing factor
+    ///
+    /// \return Size of the line spacing factor
+    ///
+    /// \see `setLineSpacing`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getLineSpacing() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the letter spacing factor
+    ///
+    /// \return Size of the letter spacing factor
+    ///
+    /// \see `setLetterSpacing`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getLetterSpacing() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the style
+    ///
+    /// \return Current style
+    ///
+    /// \see `setStyle`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint32_t getStyle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the outline thickness
+    ///
+    /// \return Outline thickness, in pixels
+    ///
+    /// \see `setOutlineThickness`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getOutlineThickness() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the placements of the visible characters
+    ///
+    /// Whitespace characters don't have a placement.
+    ///
+    /// \return Glyph placements, in the order of the string
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<GlyphPlacement>& getGlyphs() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the lines of the text
+    ///
+    /// \return Lines, from top to bottom
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<Line>& getLines() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the text
+    ///
+    /// This is the same rectangle as the one returned by
+    /// `sf::Text::getLocalBounds` for a text with the same
+    /// properties.
+    ///
+    /// \return Local bounding rectangle of the text
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the geometry of the laid out text
+    ///
+    /// Unlike the rest of the class, this function needs the
+    /// glyphs to be in the font's texture, and must therefore
+    /// be called from the thread that renders the text. Glyphs
+    /// which were rasterized while computing the layout are
+    /// uploaded to the texture at this point.
+    ///
+    /// The vertices are expressed in pixels, and must be drawn
+    /// with the font's texture for the character size.
+    ///
+    /// \param fillVertices    Vertex array to fill with the geometry of the characters
+    /// \param fillColor       Color of the characters
+    /// \param outlineVertices Vertex array to fill with the geometry of the outline
+    /// \param outlineColor    Color of the outline
+    ///
+    ////////////////////////////////////////////////////////////
+    void createGeometry(VertexArray& fillVertices,
+                        Color        fillColor,
+                        VertexArray& outlineVertices,
+                        Color        outlineColor) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Make sure the layout is updated
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureLayoutUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    String                              m_string;                   //!< String to lay out
+    const Font*                         m_font{};                   //!< Font used to lay out the string
+    unsigned int                        m_characterSize{30};        //!< Base size of characters, in pixels
+    float                               m_letterSpacingFactor{1.f}; //!< Spacing factor between letters
+    float                               m_lineSpacingFactor{1.f};   //!< Spacing factor between lines
+    std::uint32_t                       m_style{Text::Regular};     //!< Text style (see `sf::Text::Style`)
+    float                               m_outlineThickness{};       //!< Thickness of the text's outline
+    mutable std::vector<GlyphPlacement> m_glyphs;                   //!< Placements of the visible characters
+    mutable std::vector<Line>           m_lines;                    //!< Lines of the text
+    mutable FloatRect                   m_bounds;                   //!< Bounding rectangle of the text
+    mutable bool                        m_layoutNeedUpdate{true};   //!< Does the layout need to be recomputed?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextLayout
+/// \ingroup graphics
+///
+/// `sf::TextLayout` computes where the characters of a string
+/// go, the same way `sf::Text` does: kerning, letter and line
+/// spacing, line breaks and bounds. It only relies on the
+/// metrics of the font (see `sf::Font::getGlyphMetrics`) and
+/// never touches the font's textures, so it doesn't need an
+/// OpenGL context and can be used from any thread, for example
+/// to measure and lay out many labels in parallel on a job
+/// system. Several layouts may use the same font concurrently.
+///
+/// Glyphs which were never loaded are rasterized on the thread
+/// computing the layout, and wait in the font until they are
+/// needed by the render thread. `createGeometry` then uploads
+/// them and builds the vertices of the text, which can be drawn
+/// with the font's texture.
+///
+/// Usage example:
+/// \code
+/// // On a worker thread
+/// sf::TextLayout layout(font, "Hello world", 24);
+/// const sf::FloatRect bounds = layout.getLocalBounds();
+///
+/// // Later, on the render thread
+/// sf::VertexArray fill(sf::PrimitiveType::Triangles);
+/// sf::VertexArray outline(sf::PrimitiveType::Triangles);
+/// layout.createGeometry(fill, sf::Color::White, outline, sf::Color::Black);
+///
+/// sf::RenderStates states;
+/// states.texture        = &font.getTexture(24);
+/// states.coordinateType = sf::CoordinateType::Pixels;
+/// window.draw(fill, states);
+/// \endcode
+///
+/// \see `sf::Text`, `sf::Font`
+///
+////////////////////////////////////////////////////////////
@@ -30,6 +30,8 @@
 #include <SFML/Graphics/Export.hpp>
 
 #include <SFML/Graphics/CoordinateType.hpp>
+#include <SFML/Graphics/Fence.hpp>
+#include <SFML/Graphics/ImageRequest.hpp>
 #include <SFML/Graphics/Rect.hpp>
 
 #include <SFML/Window/GlResource.hpp>
@@ -379,6 +381,71 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool loadFromImage(const Image& image, bool sRgb = false, const IntRect& area = {});
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from a block compressed image file
+    ///
+    /// Supported files are DDS, KTX and KTX2 containers storing
+    /// BC1 (DXT1), BC3 (DXT5), BC7, ETC1 or ETC2 blocks. When the
+    /// graphics driver supports the format, the blocks are uploaded
+    /// as they are and stay compressed in video memory. Otherwise
+    /// the image is decoded on the CPU and loaded like any other
+    /// image.
+    ///
+    /// If the file stores a complete mipmap chain, all its levels
+    /// are loaded as if `generateMipmap` had been called.
+    ///
+    /// A texture whose blocks stay compressed can't be modified
+    /// with the `update` functions, which report an error and
+    /// leave it unchanged. With OpenGL ES, it can't be copied
+    /// back to an image with `copyToImage` either.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param filename Path of the file to load
+    /// \param sRgb     `true` to enable sRGB conversion, `false` to use the color space stored in the file
+    ///
+    /// \return `true` if loading was successful, `false` if it failed
+    ///
+    /// \see `loadFromCompressedMemory`, `loadFromCompressedStream`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromCompressedFile(const std::filesystem::path& filename, bool sRgb = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from a block compressed image file in memory
+    ///
+    /// See `loadFromCompressedFile` for the supported formats.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data to load, in bytes
+    /// \param sRgb `true` to enable sRGB conversion, `false` to use the color space stored in the file
+    ///
+    /// \return `true` if loading was successful, `false` if it failed
+    ///
+    /// \see `loadFromCompressedFile`, `loadFromCompressedStream`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromCompressedMemory(const void* data, std::size_t size, bool sRgb = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from a block compressed image file in a custom stream
+    ///
+    /// See `loadFromCompressedFile` for the supported formats.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param stream Source stream to read from
+    /// \param sRgb   `true` to enable sRGB conversion, `false` to use the color space stored in the file
+    ///
+    /// \return `true` if loading was successful, `false` if it failed
+    ///
+    /// \see `loadFromCompressedFile`, `loadFromCompressedMemory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromCompressedStream(InputStream& stream, bool sRgb = false);
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the texture
     ///
@@ -402,6 +469,26 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Image copyToImage() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Request a copy of the texture pixels without blocking
+    ///
+    /// Unlike `copyToImage`, this function doesn't wait for the
+    /// graphics card: the pixels are copied into a pixel buffer
+    /// object, and can be retrieved from the returned request
+    /// once the copy has completed, usually one or two frames
+    /// later.
+    ///
+    /// If asynchronous read back is not supported (for example
+    /// with OpenGL ES), the pixels are read back right away and
+    /// the returned request is already ready.
+    ///
+    /// \return Request giving access to the texture's pixels
+    ///
+    /// \see `copyToImage`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] ImageRequest requestImageAsync() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the whole texture from an array of pixels
     ///
@@ -514,6 +601,46 @@ public:
     ////////////////////////////////////////////////////////////
     void update(const Image& image, Vector2u dest);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from an array of pixels without blocking
+    ///
+    /// The pixels are copied into a pixel buffer object, from
+    /// which the graphics driver transfers them to the texture
+    /// asynchronously. The pixel array is not used anymore once
+    /// this function returns, so it can be reused or freed right
+    /// away. The returned fence is signaled once the texture
+    /// contains the new pixels on the graphics card.
+    ///
+    /// If pixel buffer objects or sync objects are not supported,
+    /// the texture is updated synchronously with `update` and the
+    /// returned fence is already signaled.
+    ///
+    /// The same restrictions as `update` apply to the arguments.
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    /// \param size   Width and height of the pixel region contained in `pixels`
+    /// \param dest   Coordinates of the destination position
+    ///
+    /// \return Fence signaled when the update has completed
+    ///
+    /// \see `update`
+    ///
+    ////////////////////////////////////////////////////////////
+    Fence updateAsync(const std::uint8_t* pixels, Vector2u size, Vector2u dest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from an image without blocking
+    ///
+    /// \param image Image to copy to the texture
+    /// \param dest  Coordinates of the destination position
+    ///
+    /// \return Fence signaled when the update has completed
+    ///
+    /// \see `updateAsync(const std::uint8_t*, Vector2u, Vector2u)`
+    ///
+    ////////////////////////////////////////////////////////////
+    Fence updateAsync(const Image& image, Vector2u dest = {});
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the texture from the contents of a window
     ///
@@ -752,6 +879,7 @@ private:
     mutable bool  m_pixelsFlipped{}; //!< To work around the inconsistency in Y orientation
     bool          m_fboAttachment{}; //!< Is this texture owned by a framebuffer object?
     bool          m_hasMipmap{};     //!< Has the mipmap been generated?
+    bool          m_isCompressed{};  //!< Are the texture contents stored as compressed blocks?
     std::uint64_t m_cacheId;         //!< Unique number that identifies the texture to the render target's cache
 };
 
@@ -0,0 +1,278 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Image;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Set of images packed together into a few large textures
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureAtlas
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Location of an image inside the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Region
+    {
+        const Texture* texture{}; //!< Texture of the page containing the image
+        std::size_t    page{};    //!< Index of the page containing the image
+        IntRect        rect;      //!< Area of the image in the texture, in pixels
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty atlas
+    ///
+    /// Pages are created as needed when images are added. Their
+    /// size is limited to `sf::Texture::getMaximumSize()`.
+    ///
+    /// \param pageSize Size of the textures of the atlas, in pixels
+    /// \param padding  Number of transparent pixels kept between images
+    /// \param sRgb     `true` to enable sRGB conversion of the pages, `false` to disable it
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureAtlas(Vector2u pageSize = {2048, 2048}, unsigned int padding = 1, bool sRgb = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureAtlas();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas(const TextureAtlas&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    /// The regions returned by the moved atlas remain valid and
+    /// now refer to the pages of this atlas.
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas(TextureAtlas&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas& operator=(TextureAtlas&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an image to the atlas
+    ///
+    /// The image is packed into the first page which has enough
+    /// room left, or into a new page, and uploaded right away.
+    ///
+    /// \param image Image to add
+    ///
+    /// \return Location of the image in the atlas, or `std::nullopt`
+    ///         if the image is empty or larger than a page
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Region> add(const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load an image from a file and add it to the atlas
+    ///
+    /// \param filename Path of the image file to load
+    ///
+    /// \return Location of the image in the atlas, or `std::nullopt`
+    ///         if the image couldn't be loaded or added
+    ///
+    /// \see `add(const Image&)`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Region> add(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add several images to the atlas
+    ///
+    /// The images are inserted from the tallest to the shortest,
+    /// which packs them more tightly than adding them one by one
+    /// in an arbitrary order.
+    ///
+    /// \param images Images to add
+    ///
+    /// \return Location of each image in the atlas, in the same order
+    ///         as \a images, with `std::nullopt` for the images which
+    ///         couldn't be added
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<std::optional<Region>> add(const std::vector<Image>& images);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the images and destroy the pages
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of pages of the atlas
+    ///
+    /// \return Number of textures used by the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of a page
+    ///
+    /// \param page Index of the page, must be lower than `getPageCount()`
+    ///
+    /// \return Texture of the page
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture(std::size_t page) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the pages
+    ///
+    /// \return Size of the textures of the atlas, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getPageSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter on all the pages
+    ///
+    /// \param smooth `true` to enable smoothing, `false` to disable it
+    ///
+    /// \see `isSmooth`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter is enabled or not
+    ///
+    /// \return `true` if smoothing is enabled, `false` if it is disabled
+    ///
+    /// \see `setSmooth`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSmooth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the packing efficiency of the atlas
+    ///
+    /// \return Ratio between the area of the added images and the
+    ///         total area of the pages, between 0 and 1
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getEfficiency() const;
+
+private:
+    struct Page;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new empty page
+    ///
+    /// \return Pointer to the new page, or a null pointer on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    Page* createPage();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::unique_ptr<Page>> m_pages;      //!< Pages of the atlas
+    Vector2u                           m_pageSize;   //!< Size of the pages
+    unsigned int                       m_padding{};  //!< Number of pixels kept between images
+    bool                               m_sRgb{};     //!< Are the pages sRGB-encoded?
+    bool                               m_isSmooth{}; //!< Is the smooth filter enabled on the pages?
+    std::uint64_t                      m_usedArea{}; //!< Total area of the added images, in pixels
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureAtlas
+/// \ingroup graphics
+///
+/// Loading many small images into separate `sf::Texture`
+/// instances wastes memory, since every texture has its own
+/// OpenGL object and may be padded to a power of two, and it
+/// prevents draws using different images from being merged.
+///
+/// `sf::TextureAtlas` packs images into a few large textures,
+/// called pages, and returns where each image ended up. The
+/// texture and rectangle of a region can be given directly to
+/// `sf::Sprite` or `sf::Shape`. Images can be added at any
+/// time; new pages are created when the existing ones are full.
+///
+/// The pages are owned by the atlas and stay at the same
+/// address until the atlas is cleared or destroyed.
+///
+/// Usage example:
+/// \code
+/// sf::TextureAtlas atlas;
+///
+/// const std::optional player = atlas.add("player.png");
+/// const std::optional enemy  = atlas.add("enemy.png");
+/// if (!player || !enemy)
+///     return -1;
+///
+/// sf::Sprite playerSprite(*player->texture, player->rect);
+/// sf::Sprite enemySprite(*enemy->texture, enemy->rect);
+///
+/// std::cout << "Atlas filled at " << atlas.getEfficiency() * 100 << "%" << std::endl;
+/// \endcode
+///
+/// \see `sf::Texture`, `sf::Image`
+///
+////////////////////////////////////////////////////////////
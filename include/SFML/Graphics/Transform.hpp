@@ -35,10 +35,13 @@
 
 #include <array>
 
+#include <cstddef>
+
 
 namespace sf
 {
 class Angle;
+struct Vertex;
 
 ////////////////////////////////////////////////////////////
 /// \brief 3x3 transform matrix
@@ -115,6 +118,41 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] constexpr Vector2f transformPoint(Vector2f point) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of 2D points
+    ///
+    /// This function produces the same results as calling
+    /// `transformPoint` on each point, but processes several
+    /// points at once using SIMD instructions when the target
+    /// CPU supports them (SSE2 or NEON).
+    ///
+    /// `points` and `transformedPoints` may point to the same
+    /// array to transform the points in place, but they must
+    /// not partially overlap.
+    ///
+    /// \param points            Pointer to the points to transform
+    /// \param transformedPoints Pointer to the array receiving the transformed points
+    /// \param count             Number of points to transform
+    ///
+    /// \see `transformPoint`
+    ///
+    ////////////////////////////////////////////////////////////
+    SFML_GRAPHICS_API void transformPoints(const Vector2f* points, Vector2f* transformedPoints, std::size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform the positions of an array of vertices in place
+    ///
+    /// Only the positions are modified, colors and texture
+    /// coordinates are left untouched.
+    ///
+    /// \param vertices    Pointer to the vertices to transform
+    /// \param vertexCount Number of vertices to transform
+    ///
+    /// \see `transformPoint`
+    ///
+    ////////////////////////////////////////////////////////////
+    SFML_GRAPHICS_API void transformPoints(Vertex* vertices, std::size_t vertexCount) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Transform a rectangle
     ///
@@ -0,0 +1,522 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Glsl.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Block of uniform data shared by several shaders
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UniformBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Helper computing the offsets of the members of a std140 block
+    ///
+    /// Members must be added in the order in which they are
+    /// declared in the GLSL uniform block.
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_GRAPHICS_API Layout
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Types of the members of a uniform block
+        ///
+        ////////////////////////////////////////////////////////////
+        enum class Type
+        {
+            Float, //!< \p float
+            Vec2,  //!< \p vec2
+            Vec3,  //!< \p vec3
+            Vec4,  //!< \p vec4
+            Int,   //!< \p int
+            Ivec2, //!< \p ivec2
+            Ivec3, //!< \p ivec3
+            Ivec4, //!< \p ivec4
+            Bool,  //!< \p bool
+            Bvec2, //!< \p bvec2
+            Bvec3, //!< \p bvec3
+            Bvec4, //!< \p bvec4
+            Mat3,  //!< \p mat3
+            Mat4   //!< \p mat4
+        };
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Append a member to the block
+        ///
+        /// Following the std140 rules, the elements of an array
+        /// are aligned to 16 bytes, see `getArrayStride`.
+        ///
+        /// \param type      Type of the member
+        /// \param arraySize Number of elements if the member is an array, 0 otherwise
+        ///
+        /// \return Offset of the member from the start of the block, in bytes
+        ///
+        ////////////////////////////////////////////////////////////
+        std::size_t add(Type type, std::size_t arraySize = 0);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the size of the block
+        ///
+        /// \return Size of the block in bytes, suitable for `UniformBuffer::create`
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] std::size_t getSize() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the distance between two elements of an array
+        ///
+        /// \param type Type of the elements
+        ///
+        /// \return Stride of the array in bytes
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] static std::size_t getArrayStride(Type type);
+
+    private:
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        std::size_t m_size{}; //!< Offset right after the last member
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// Uniform buffers share the usage specifiers of vertex buffers.
+    ///
+    /// \see `sf::VertexBuffer::Usage`
+    ///
+    ////////////////////////////////////////////////////////////
+    using Usage = VertexBuffer::Usage;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty uniform buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a `UniformBuffer` with a specific usage specifier
+    ///
+    /// Creates an empty uniform buffer and sets its usage to \p usage.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit UniformBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(const UniformBuffer& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the uniform buffer
+    ///
+    /// Allocates `size` bytes, which are all set to zero.
+    /// Any previously allocated memory is freed in the process.
+    ///
+    /// Graphics memory is only allocated if uniform buffers are
+    /// available, the data is otherwise only kept in system memory.
+    ///
+    /// \param size Size of the buffer in bytes
+    ///
+    /// \return `true` if creation was successful
+    ///
+    /// \see `Layout::getSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the buffer
+    ///
+    /// \return Size of the buffer in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a range of bytes of the buffer
+    ///
+    /// The data must already follow the layout of the uniform
+    /// block. The range is uploaded immediately, together with
+    /// the values written since the last update.
+    ///
+    /// The update fails if `offset` + `size` is greater than the
+    /// size of the buffer.
+    ///
+    /// \param data   Bytes to copy to the buffer
+    /// \param size   Number of bytes to copy
+    /// \param offset Offset in the buffer to copy to, in bytes
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data, std::size_t size, std::size_t offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the values written since the last update
+    ///
+    /// Only the range of bytes covering the written values is
+    /// uploaded. This function does nothing if no value was
+    /// written.
+    ///
+    /// \return `true` if the update was successful
+    ///
+    /// \see `write`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a \p float member
+    ///
+    /// Values are written to system memory with the std140
+    /// encoding, and uploaded by the next call to `update`.
+    /// The offset usually comes from `Layout::add`. Writes
+    /// which don't fit in the buffer are reported and ignored.
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param x      Value of the float scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, float x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a \p vec2 member
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param vector Value of the vec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, Glsl::Vec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a \p vec3 member
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param vector Value of the vec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, const Glsl::Vec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a \p vec4 member
+    ///
+    /// This overload can also be called with `sf::Color` objects
+    /// that are converted to `sf::Glsl::Vec4`.
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param vector Value of the vec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, const Glsl::Vec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an \p int member
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param x      Value of the int scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, int x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an \p ivec2 member
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param vector Value of the ivec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, Glsl::Ivec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an \p ivec3 member
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param vector Value of the ivec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, const Glsl::Ivec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an \p ivec4 member
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param vector Value of the ivec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, const Glsl::Ivec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a \p bool member
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param x      Value of the bool scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, bool x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a \p bvec2 member
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param vector Value of the bvec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, Glsl::Bvec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a \p bvec3 member
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param vector Value of the bvec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, const Glsl::Bvec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a \p bvec4 member
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param vector Value of the bvec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, const Glsl::Bvec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a \p mat3 member
+    ///
+    /// Each column of the matrix is padded to 16 bytes, as
+    /// required by the std140 layout.
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param matrix Value of the mat3 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, const Glsl::Mat3& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a \p mat4 member
+    ///
+    /// \param offset Offset of the member in the buffer, in bytes
+    /// \param matrix Value of the mat4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(std::size_t offset, const Glsl::Mat4& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get read access to the data of the buffer
+    ///
+    /// \return Pointer to the bytes of the buffer, or a null pointer if the buffer is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::byte* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(const UniformBuffer& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the contents of this uniform buffer with those of another
+    ///
+    /// \param right Instance to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(UniformBuffer& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the uniform buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the uniform buffer or 0 if not created in graphics memory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this uniform buffer
+    ///
+    /// This function provides a hint about how this uniform buffer is
+    /// going to be used in terms of data update frequency.
+    ///
+    /// After changing the usage specifier, the uniform buffer has
+    /// to be updated with new data for the usage specifier to
+    /// take effect.
+    ///
+    /// The default usage type is `sf::UniformBuffer::Usage::Dynamic`.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this uniform buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports uniform buffers
+    ///
+    /// Uniform buffers require OpenGL 3.1 or the
+    /// ARB_uniform_buffer_object extension, and shaders. When
+    /// they are not available, the data is only kept in system
+    /// memory and `sf::Shader::setUniformBlock` fails, so the
+    /// values have to be set with `sf::Shader::setUniform`
+    /// instead.
+    ///
+    /// \return `true` if uniform buffers are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy bytes to system memory and extend the range to upload
+    ///
+    /// Nothing is copied if the bytes don't fit in the buffer.
+    ///
+    /// \param offset Offset in the buffer to copy to, in bytes
+    /// \param data   Bytes to copy
+    /// \param size   Number of bytes to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    void store(std::size_t offset, const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::byte> m_data;                  //!< Bytes kept in system memory
+    unsigned int           m_buffer{};              //!< Internal buffer identifier
+    std::size_t            m_bufferSize{};          //!< Size in bytes of the allocated graphics memory
+    std::size_t            m_dirtyBegin{};          //!< Start of the range written since the last upload
+    std::size_t            m_dirtyEnd{};            //!< End of the range written since the last upload
+    Usage                  m_usage{Usage::Dynamic}; //!< How this uniform buffer is to be used
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Swap the contents of one uniform buffer with those of another
+///
+/// \param left First instance to swap
+/// \param right Second instance to swap
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void swap(UniformBuffer& left, UniformBuffer& right) noexcept;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UniformBuffer
+/// \ingroup graphics
+///
+/// `sf::UniformBuffer` holds the data of a GLSL uniform block
+/// in graphics memory. Uniforms which are common to many shaders,
+/// such as the camera, the time or the lights of a scene, can be
+/// uploaded once per frame to a single buffer and attached to
+/// every shader that declares the block with
+/// `sf::Shader::setUniformBlock`, instead of being set on each
+/// shader separately.
+///
+/// The block must be declared with the std140 layout in GLSL.
+/// `sf::UniformBuffer::Layout` computes the offsets of its members,
+/// and the `write` functions encode values at these offsets.
+/// Alternatively, `update` copies a range of bytes that
+/// already follows the layout.
+///
+/// Example:
+/// \code
+/// // layout(std140) uniform Frame
+/// // {
+/// //     mat4  viewMatrix;
+/// //     float time;
+/// // };
+///
+/// sf::UniformBuffer::Layout layout;
+/// const std::size_t viewMatrixOffset = layout.add(sf::UniformBuffer::Layout::Type::Mat4);
+/// const std::size_t timeOffset       = layout.add(sf::UniformBuffer::Layout::Type::Float);
+///
+/// sf::UniformBuffer frame;
+/// if (!frame.create(layout.getSize()))
+///     return -1;
+///
+/// for (sf::Shader* shader : shaders)
+///     shader->setUniformBlock("Frame", frame);
+///
+/// while (window.isOpen())
+/// {
+///     frame.write(viewMatrixOffset, sf::Glsl::Mat4(view.getTransform()));
+///     frame.write(timeOffset, clock.getElapsedTime().asSeconds());
+///     frame.update();
+///     ...
+/// }
+/// \endcode
+///
+/// \see `sf::Shader`
+///
+////////////////////////////////////////////////////////////
@@ -182,7 +182,11 @@ public:
     ///
     /// If `offset` is 0 and `vertexCount` is less than the size of
     /// the currently created buffer, only the corresponding region
-    /// is updated.
+    /// is updated. With `sf::VertexBuffer::Usage::Stream`, the rest
+    /// of the buffer is discarded instead, as the buffer gets a
+    /// fresh storage whenever it is rewritten from its beginning.
+    ///
+    /// The update fails while a range of the buffer is mapped.
     ///
     /// If `offset` is not 0 and `offset` + `vertexCount` is greater
     /// than the size of the currently created buffer, the update fails.
@@ -210,6 +214,60 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(const VertexBuffer& vertexBuffer);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Map a part of the buffer to write vertices directly to graphics memory
+    ///
+    /// This lets vertices be generated in place, instead of
+    /// being built in a separate array which `update` then
+    /// copies to the buffer.
+    ///
+    /// `offset` is specified as the number of vertices to skip
+    /// from the beginning of the buffer. The range must fit in
+    /// the currently created buffer.
+    ///
+    /// The previous contents of the range are discarded, so
+    /// every vertex of the range must be written. The returned
+    /// pointer is valid until `unmap` is called, and the buffer
+    /// must not be drawn, updated or copied in the meantime.
+    ///
+    /// With `sf::VertexBuffer::Usage::Stream`, the range is
+    /// mapped without waiting for the draws which are still
+    /// reading the buffer, like `update` does.
+    ///
+    /// \param vertexCount Number of vertices to map
+    /// \param offset      Offset in the buffer of the first vertex to map
+    ///
+    /// \return Pointer to the first vertex of the range, or a null pointer if mapping failed
+    ///
+    /// \see `unmap`, `update`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vertex* map(std::size_t vertexCount, std::size_t offset = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Finish writing the range mapped by `map`
+    ///
+    /// If this function returns `false` while a range was
+    /// mapped, the contents of the buffer were lost (e.g. the
+    /// screen mode changed) and must be written again.
+    ///
+    /// \return `true` if the vertices were written to the buffer
+    ///
+    /// \see `map`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool unmap();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a range of the buffer is currently mapped
+    ///
+    /// \return `true` if `map` was called without a matching `unmap`
+    ///
+    /// \see `map`, `unmap`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isMapped() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
@@ -331,6 +389,21 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, RenderStates states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Map a range of the buffer bound to `GL_ARRAY_BUFFER` for writing
+    ///
+    /// Stream buffers orphan their storage when the range starts
+    /// at the beginning of the buffer, and write without
+    /// synchronization to the vertices which were not written since.
+    ///
+    /// \param vertexCount Number of vertices to map, must not be 0
+    /// \param offset      Offset in the buffer of the first vertex to map
+    ///
+    /// \return Pointer to the mapped range, or a null pointer if mapping is not supported or failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] void* mapRange(std::size_t vertexCount, std::size_t offset);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -338,6 +411,8 @@ private:
     std::size_t   m_size{};                               //!< Size in Vertices of the currently allocated buffer
     PrimitiveType m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
     Usage         m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+    std::size_t   m_streamOffset{};                       //!< End of the vertices written since the last orphaning
+    bool          m_mapped{};                             //!< Is a range of the buffer currently mapped?
 };
 
 ////////////////////////////////////////////////////////////
@@ -395,6 +470,22 @@ SFML_GRAPHICS_API void swap(VertexBuffer& left, VertexBuffer& right) noexcept;
 /// pending data transfers complete before the vertex buffer is sourced
 /// by the rendering pipeline.
 ///
+/// Buffers with the `sf::VertexBuffer::Usage::Stream` usage
+/// are meant to be rewritten every frame, so their updates
+/// avoid waiting for the graphics card to finish the draws
+/// which still read the previous vertices. Writing from the
+/// beginning of the buffer gives it a fresh storage (the driver
+/// keeps the old one alive until those draws are done) and
+/// discards the previous vertices, and writing vertices past
+/// the ones written since then skips synchronization
+/// altogether. A typical streaming loop thus appends vertices
+/// to the buffer draw after draw, and starts over from the
+/// beginning once the frame is done.
+///
+/// `map` gives direct access to a range of graphics memory, so
+/// that vertices can be generated in place instead of being
+/// copied from a separate array.
+///
 /// It inherits `sf::Drawable`, but unlike other drawables it
 /// is not transformable.
 ///
@@ -407,6 +498,19 @@ SFML_GRAPHICS_API void swap(VertexBuffer& left, VertexBuffer& right) noexcept;
 /// triangles.update(vertices.data());
 /// ...
 /// window.draw(triangles);
+///
+/// // Generate particles straight into graphics memory
+/// sf::VertexBuffer particles(sf::PrimitiveType::Points, sf::VertexBuffer::Usage::Stream);
+/// particles.create(particleCount);
+/// if (sf::Vertex* vertices = particles.map(particleCount))
+/// {
+///     for (std::size_t i = 0; i < particleCount; ++i)
+///         vertices[i] = {positions[i], colors[i]};
+///
+///     if (!particles.unmap())
+///         ... the contents were lost, write them again ...
+/// }
+/// window.draw(particles);
 /// \endcode
 ///
 /// \see `sf::Vertex`, `sf::VertexArray`
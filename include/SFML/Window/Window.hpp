@@ -335,9 +335,22 @@ public:
     /// has been done for the current frame, in order to show
     /// it on screen.
     ///
+    /// \see `onDisplay`
+    ///
     ////////////////////////////////////////////////////////////
     void display();
 
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the window is displayed
+    ///
+    /// This function is called by `display` so that derived
+    /// classes can finish their rendering of the current frame
+    /// before it is shown on screen.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onDisplay();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Perform some common internal initializations
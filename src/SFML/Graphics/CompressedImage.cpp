@@ -0,0 +1,1138 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CompressedImage.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+#include <string>
+
+#include <cassert>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CompressedImageImpl
+{
+using Format = sf::priv::CompressedImage::Format;
+
+// Decoded 4x4 block, texels stored row by row as RGBA
+using Block = std::array<std::array<std::uint8_t, 4>, 16>;
+
+constexpr std::uint8_t ddsIdentifier[]  = {'D', 'D', 'S', ' '};
+constexpr std::uint8_t ktxIdentifier[]  = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+constexpr std::uint8_t ktx2Identifier[] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+template <std::size_t N>
+bool startsWith(const std::uint8_t* data, std::size_t size, const std::uint8_t (&identifier)[N])
+{
+    return size >= N && std::memcmp(data, identifier, N) == 0;
+}
+
+std::uint32_t readUint32(const std::uint8_t* data, bool swap = false)
+{
+    if (swap)
+        return (std::uint32_t{data[0]} << 24) | (std::uint32_t{data[1]} << 16) | (std::uint32_t{data[2]} << 8) | data[3];
+
+    return (std::uint32_t{data[3]} << 24) | (std::uint32_t{data[2]} << 16) | (std::uint32_t{data[1]} << 8) | data[0];
+}
+
+std::uint64_t readUint64(const std::uint8_t* data)
+{
+    return (std::uint64_t{readUint32(data + 4)} << 32) | readUint32(data);
+}
+
+std::size_t getBlockSize(Format format)
+{
+    return (format == Format::Bc1 || format == Format::Bc1Rgb || format == Format::Etc2Rgb) ? 8 : 16;
+}
+
+// Largest width and height accepted, which keeps the sizes below computed in std::size_t from overflowing
+constexpr unsigned int maxImageSize = 16384;
+
+bool isValidSize(sf::Vector2u size)
+{
+    return size.x > 0 && size.y > 0 && size.x <= maxImageSize && size.y <= maxImageSize;
+}
+
+std::size_t getLevelDataSize(Format format, sf::Vector2u size)
+{
+    return ((std::size_t{size.x} + 3) / 4) * ((std::size_t{size.y} + 3) / 4) * getBlockSize(format);
+}
+
+// Number of levels of a complete mipmap chain, down to 1x1
+std::size_t getMaxLevelCount(sf::Vector2u size)
+{
+    std::size_t count = 1;
+    for (unsigned int largest = std::max(size.x, size.y); largest > 1; largest /= 2)
+        ++count;
+
+    return count;
+}
+
+sf::Vector2u getLevelSize(sf::Vector2u size, std::size_t level)
+{
+    return {std::max(size.x >> level, 1u), std::max(size.y >> level, 1u)};
+}
+
+////////////////////////////////////////////////////////////
+// BC1 and BC3
+////////////////////////////////////////////////////////////
+std::array<std::uint8_t, 4> expand565(std::uint16_t color)
+{
+    const auto r = static_cast<unsigned int>((color >> 11) & 0x1F);
+    const auto g = static_cast<unsigned int>((color >> 5) & 0x3F);
+    const auto b = static_cast<unsigned int>(color & 0x1F);
+
+    return {static_cast<std::uint8_t>((r << 3) | (r >> 2)),
+            static_cast<std::uint8_t>((g << 2) | (g >> 4)),
+            static_cast<std::uint8_t>((b << 3) | (b >> 2)),
+            255};
+}
+
+std::uint8_t mix(unsigned int a, unsigned int b, unsigned int weightA, unsigned int weightB)
+{
+    return static_cast<std::uint8_t>((a * weightA + b * weightB) / (weightA + weightB));
+}
+
+// BC2 and BC3 color blocks always use the four colors mode,
+// the fourth color of the three colors mode is only transparent when the format has alpha
+void decodeBc1(const std::uint8_t* data, Block& block, bool alwaysFourColors, bool hasAlpha)
+{
+    const auto c0 = static_cast<std::uint16_t>(data[0] | (data[1] << 8));
+    const auto c1 = static_cast<std::uint16_t>(data[2] | (data[3] << 8));
+
+    std::array<std::array<std::uint8_t, 4>, 4> palette{expand565(c0), expand565(c1)};
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        if (c0 > c1 || alwaysFourColors)
+        {
+            palette[2][i] = mix(palette[0][i], palette[1][i], 2, 1);
+            palette[3][i] = mix(palette[0][i], palette[1][i], 1, 2);
+        }
+        else
+        {
+            palette[2][i] = mix(palette[0][i], palette[1][i], 1, 1);
+            palette[3][i] = 0;
+        }
+    }
+
+    palette[2][3] = 255;
+    palette[3][3] = (c0 > c1 || alwaysFourColors || !hasAlpha) ? 255 : 0;
+
+    const std::uint32_t indices = readUint32(data + 4);
+    for (std::size_t i = 0; i < 16; ++i)
+        block[i] = palette[(indices >> (2 * i)) & 3];
+}
+
+void decodeBc3Alpha(const std::uint8_t* data, Block& block)
+{
+    const unsigned int a0 = data[0];
+    const unsigned int a1 = data[1];
+
+    std::array<std::uint8_t, 8> palette{static_cast<std::uint8_t>(a0), static_cast<std::uint8_t>(a1)};
+
+    if (a0 > a1)
+    {
+        for (unsigned int i = 1; i < 7; ++i)
+            palette[i + 1] = mix(a0, a1, 7 - i, i);
+    }
+    else
+    {
+        for (unsigned int i = 1; i < 5; ++i)
+            palette[i + 1] = mix(a0, a1, 5 - i, i);
+
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    std::uint64_t indices = 0;
+    for (std::size_t i = 0; i < 6; ++i)
+        indices |= std::uint64_t{data[2 + i]} << (8 * i);
+
+    for (std::size_t i = 0; i < 16; ++i)
+        block[i][3] = palette[(indices >> (3 * i)) & 7];
+}
+
+////////////////////////////////////////////////////////////
+// BC7
+////////////////////////////////////////////////////////////
+struct Bc7Mode
+{
+    unsigned int subsets;
+    unsigned int partitionBits;
+    unsigned int rotationBits;
+    unsigned int indexSelectionBits;
+    unsigned int colorBits;
+    unsigned int alphaBits;
+    unsigned int endpointPBits;
+    unsigned int sharedPBits;
+    unsigned int indexBits;
+    unsigned int secondaryIndexBits;
+};
+
+constexpr Bc7Mode bc7Modes[] = {{3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+                                {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+                                {3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+                                {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+                                {1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+                                {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+                                {1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+                                {2, 6, 0, 0, 5, 5, 1, 0, 2, 0}};
+
+// Partitions of 2 subsets, bit i is the subset of texel i
+constexpr std::uint16_t bc7Partitions2[64] =
+    {0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8,
+     0xFF00, 0xFFF0, 0xF000, 0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE, 0x088C, 0x3110,
+     0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C, 0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696,
+     0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660, 0x0272, 0x04E4, 0x4E40, 0x2720,
+     0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22};
+
+// Partitions of 3 subsets, bits 2i and 2i+1 are the subset of texel i
+constexpr std::uint32_t bc7Partitions3[64] =
+    {0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+     0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+     0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+     0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+     0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+     0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+     0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+     0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254};
+
+// Texels whose index has an implicit most significant bit, for the second subset of 2 subsets partitions
+constexpr std::uint8_t bc7Anchors2[64] = {15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+                                          15, 2,  8,  2,  2,  8,  8,  15, 2,  8,  2,  2,  8,  8,  2,  2,
+                                          15, 15, 6,  8,  2,  8,  15, 15, 2,  8,  2,  2,  2,  15, 15, 6,
+                                          6,  2,  6,  8,  15, 15, 2,  2,  15, 15, 15, 15, 15, 2,  2,  15};
+
+// Same for the second and third subsets of 3 subsets partitions
+constexpr std::uint8_t bc7Anchors3[2][64] = {{3,  3, 15, 15, 8,  3,  15, 15, 8,  8,  6,  6,  6,  5,  3, 3,
+                                              3,  3, 8,  15, 3,  3,  6,  10, 5,  8,  8,  6,  8,  5,  15, 15,
+                                              8,  15, 3, 5,  6,  10, 8,  15, 15, 3,  15, 5,  15, 15, 15, 15,
+                                              3,  15, 5, 5,  5,  8,  5,  10, 5,  10, 8,  13, 15, 12, 3,  3},
+                                             {15, 8, 8,  3,  15, 15, 3,  8,  15, 15, 15, 15, 15, 15, 15, 8,
+                                              15, 8, 15, 3,  15, 8,  15, 8,  3,  15, 6,  10, 15, 15, 10, 8,
+                                              15, 3, 15, 10, 10, 8,  9,  10, 6,  15, 8,  15, 3,  6,  6,  8,
+                                              15, 3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3,  15, 15, 8}};
+
+constexpr std::uint8_t bc7Weights2[] = {0, 21, 43, 64};
+constexpr std::uint8_t bc7Weights3[] = {0, 9, 18, 27, 37, 46, 55, 64};
+constexpr std::uint8_t bc7Weights4[] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// Reads the bits of a block from the least significant one
+class BitReader
+{
+public:
+    explicit BitReader(const std::uint8_t* data) : m_data(data)
+    {
+    }
+
+    unsigned int read(unsigned int count)
+    {
+        unsigned int value = 0;
+        for (unsigned int i = 0; i < count; ++i, ++m_position)
+            value |= ((m_data[m_position / 8] >> (m_position % 8)) & 1u) << i;
+
+        return value;
+    }
+
+private:
+    const std::uint8_t* m_data;
+    unsigned int        m_position{};
+};
+
+std::uint8_t interpolateBc7(unsigned int e0, unsigned int e1, unsigned int index, unsigned int indexBits)
+{
+    const std::uint8_t* weights = indexBits == 2 ? bc7Weights2 : (indexBits == 3 ? bc7Weights3 : bc7Weights4);
+    return static_cast<std::uint8_t>(((64 - weights[index]) * e0 + weights[index] * e1 + 32) >> 6);
+}
+
+void decodeBc7(const std::uint8_t* data, Block& block)
+{
+    unsigned int modeIndex = 0;
+    while (modeIndex < 8 && !(data[0] & (1u << modeIndex)))
+        ++modeIndex;
+
+    // Reserved mode, decoded as transparent black
+    if (modeIndex == 8)
+    {
+        block = {};
+        return;
+    }
+
+    const Bc7Mode& mode = bc7Modes[modeIndex];
+
+    BitReader bits(data);
+    bits.read(modeIndex + 1);
+
+    const unsigned int partition      = bits.read(mode.partitionBits);
+    const unsigned int rotation       = bits.read(mode.rotationBits);
+    const unsigned int indexSelection = bits.read(mode.indexSelectionBits);
+
+    // Endpoints are stored channel by channel, then subset by subset
+    unsigned int endpoints[3][2][4] = {};
+    for (unsigned int channel = 0; channel < 4; ++channel)
+    {
+        const unsigned int channelBits = channel < 3 ? mode.colorBits : mode.alphaBits;
+        for (unsigned int subset = 0; subset < mode.subsets; ++subset)
+            for (auto& endpoint : endpoints[subset])
+                endpoint[channel] = bits.read(channelBits);
+    }
+
+    // Append the p-bits then expand the endpoints to 8 bits
+    unsigned int pBits[3][2] = {};
+    for (unsigned int subset = 0; subset < mode.subsets; ++subset)
+    {
+        if (mode.endpointPBits)
+        {
+            pBits[subset][0] = bits.read(1);
+            pBits[subset][1] = bits.read(1);
+        }
+        else if (mode.sharedPBits)
+        {
+            pBits[subset][0] = pBits[subset][1] = bits.read(1);
+        }
+    }
+
+    const unsigned int hasPBit = mode.endpointPBits | mode.sharedPBits;
+    for (unsigned int subset = 0; subset < mode.subsets; ++subset)
+    {
+        for (unsigned int e = 0; e < 2; ++e)
+        {
+            for (unsigned int channel = 0; channel < 4; ++channel)
+            {
+                unsigned int& value = endpoints[subset][e][channel];
+
+                if (channel == 3 && mode.alphaBits == 0)
+                {
+                    value = 255;
+                    continue;
+                }
+
+                const unsigned int precision = (channel < 3 ? mode.colorBits : mode.alphaBits) + hasPBit;
+                if (hasPBit)
+                    value = (value << 1) | pBits[subset][e];
+
+                value <<= 8 - precision;
+                value |= value >> precision;
+            }
+        }
+    }
+
+    // Subset of each texel and whether it is the anchor of its subset, whose index is stored with one less bit
+    unsigned int subsets[16] = {};
+    bool         anchors[16] = {true};
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        if (mode.subsets == 2)
+            subsets[i] = (bc7Partitions2[partition] >> i) & 1u;
+        else if (mode.subsets == 3)
+            subsets[i] = (bc7Partitions3[partition] >> (2 * i)) & 3u;
+    }
+
+    if (mode.subsets == 2)
+        anchors[bc7Anchors2[partition]] = true;
+    else if (mode.subsets == 3)
+        anchors[bc7Anchors3[0][partition]] = anchors[bc7Anchors3[1][partition]] = true;
+
+    unsigned int indices[16] = {};
+    for (unsigned int i = 0; i < 16; ++i)
+        indices[i] = bits.read(mode.indexBits - (anchors[i] ? 1 : 0));
+
+    unsigned int secondaryIndices[16] = {};
+    if (mode.secondaryIndexBits)
+    {
+        for (unsigned int i = 0; i < 16; ++i)
+            secondaryIndices[i] = bits.read(mode.secondaryIndexBits - (i == 0 ? 1 : 0));
+    }
+
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        const auto& e0 = endpoints[subsets[i]][0];
+        const auto& e1 = endpoints[subsets[i]][1];
+
+        unsigned int colorIndex = indices[i];
+        unsigned int colorBits  = mode.indexBits;
+        unsigned int alphaIndex = indices[i];
+        unsigned int alphaBits  = mode.indexBits;
+
+        if (mode.secondaryIndexBits)
+        {
+            alphaIndex = secondaryIndices[i];
+            alphaBits  = mode.secondaryIndexBits;
+
+            if (indexSelection)
+            {
+                std::swap(colorIndex, alphaIndex);
+                std::swap(colorBits, alphaBits);
+            }
+        }
+
+        auto& texel = block[i];
+        for (unsigned int channel = 0; channel < 3; ++channel)
+            texel[channel] = interpolateBc7(e0[channel], e1[channel], colorIndex, colorBits);
+
+        texel[3] = interpolateBc7(e0[3], e1[3], alphaIndex, alphaBits);
+
+        if (rotation)
+            std::swap(texel[3], texel[rotation - 1]);
+    }
+}
+
+////////////////////////////////////////////////////////////
+// ETC2
+////////////////////////////////////////////////////////////
+constexpr int etcModifiers[8][4] = {{2, 8, -2, -8},
+                                    {5, 17, -5, -17},
+                                    {9, 29, -9, -29},
+                                    {13, 42, -13, -42},
+                                    {18, 60, -18, -60},
+                                    {24, 80, -24, -80},
+                                    {33, 106, -33, -106},
+                                    {47, 183, -47, -183}};
+
+constexpr int etcDistances[8] = {3, 6, 11, 16, 23, 32, 41, 64};
+
+constexpr int eacModifiers[16][8] = {{-3, -6, -9, -15, 2, 5, 8, 14},
+                                     {-3, -7, -10, -13, 2, 6, 9, 12},
+                                     {-2, -5, -8, -13, 1, 4, 7, 12},
+                                     {-2, -4, -6, -13, 1, 3, 5, 12},
+                                     {-3, -6, -8, -12, 2, 5, 7, 11},
+                                     {-3, -7, -9, -11, 2, 6, 8, 10},
+                                     {-4, -7, -8, -11, 3, 6, 7, 10},
+                                     {-3, -5, -8, -11, 2, 4, 7, 10},
+                                     {-2, -6, -8, -10, 1, 5, 7, 9},
+                                     {-2, -5, -8, -10, 1, 4, 7, 9},
+                                     {-2, -4, -8, -10, 1, 3, 7, 9},
+                                     {-2, -5, -7, -10, 1, 4, 6, 9},
+                                     {-3, -4, -7, -10, 2, 3, 6, 9},
+                                     {-1, -2, -3, -10, 0, 1, 2, 9},
+                                     {-4, -6, -8, -9, 3, 5, 7, 8},
+                                     {-3, -5, -7, -9, 2, 4, 6, 8}};
+
+std::uint8_t clamp255(int value)
+{
+    return static_cast<std::uint8_t>(std::clamp(value, 0, 255));
+}
+
+unsigned int bitsAt(std::uint64_t value, unsigned int high, unsigned int low)
+{
+    return static_cast<unsigned int>((value >> low) & ((std::uint64_t{1} << (high - low + 1)) - 1));
+}
+
+int extend(unsigned int value, unsigned int bits)
+{
+    return static_cast<int>((value << (8 - bits)) | (value >> (2 * bits - 8)));
+}
+
+// ETC blocks are big endian and their texels are indexed column by column
+void decodeEtc2(const std::uint8_t* data, Block& block)
+{
+    std::uint64_t bits = 0;
+    for (std::size_t i = 0; i < 8; ++i)
+        bits = (bits << 8) | data[i];
+
+    const auto texelIndex = [&](unsigned int x, unsigned int y)
+    {
+        const unsigned int i = x * 4 + y;
+        return (((bits >> (i + 16)) & 1u) << 1) | ((bits >> i) & 1u);
+    };
+
+    const auto setTexel = [&](unsigned int x, unsigned int y, int r, int g, int b)
+    { block[y * 4 + x] = {clamp255(r), clamp255(g), clamp255(b), 255}; };
+
+    const bool differential = bitsAt(bits, 33, 33);
+
+    int base[2][3] = {};
+    if (differential)
+    {
+        const auto delta = [](unsigned int value) { return static_cast<int>(value) - ((value & 4) ? 8 : 0); };
+
+        int color[3];
+        int second[3];
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            color[c]  = static_cast<int>(bitsAt(bits, 63 - 8 * c, 59 - 8 * c));
+            second[c] = color[c] + delta(bitsAt(bits, 58 - 8 * c, 56 - 8 * c));
+        }
+
+        // Overflowing differential colors select the T, H and planar modes
+        if (second[0] < 0 || second[0] > 31)
+        {
+            const int c1[3] = {extend((bitsAt(bits, 60, 59) << 2) | bitsAt(bits, 57, 56), 4),
+                               extend(bitsAt(bits, 55, 52), 4),
+                               extend(bitsAt(bits, 51, 48), 4)};
+            const int c2[3] = {extend(bitsAt(bits, 47, 44), 4),
+                               extend(bitsAt(bits, 43, 40), 4),
+                               extend(bitsAt(bits, 39, 36), 4)};
+            const int d     = etcDistances[(bitsAt(bits, 35, 34) << 1) | bitsAt(bits, 32, 32)];
+
+            const int paint[4][3] = {{c1[0], c1[1], c1[2]},
+                                     {c2[0] + d, c2[1] + d, c2[2] + d},
+                                     {c2[0], c2[1], c2[2]},
+                                     {c2[0] - d, c2[1] - d, c2[2] - d}};
+
+            for (unsigned int y = 0; y < 4; ++y)
+                for (unsigned int x = 0; x < 4; ++x)
+                {
+                    const int* p = paint[texelIndex(x, y)];
+                    setTexel(x, y, p[0], p[1], p[2]);
+                }
+            return;
+        }
+
+        if (second[1] < 0 || second[1] > 31)
+        {
+            const unsigned int r1 = bitsAt(bits, 62, 59);
+            const unsigned int g1 = (bitsAt(bits, 58, 56) << 1) | bitsAt(bits, 52, 52);
+            const unsigned int b1 = (bitsAt(bits, 51, 51) << 3) | bitsAt(bits, 49, 47);
+            const unsigned int r2 = bitsAt(bits, 46, 43);
+            const unsigned int g2 = bitsAt(bits, 42, 39);
+            const unsigned int b2 = bitsAt(bits, 38, 35);
+
+            const unsigned int order = ((r1 << 8) | (g1 << 4) | b1) >= ((r2 << 8) | (g2 << 4) | b2) ? 1 : 0;
+            const int d = etcDistances[(bitsAt(bits, 34, 34) << 2) | (bitsAt(bits, 32, 32) << 1) | order];
+
+            const int c1[3] = {extend(r1, 4), extend(g1, 4), extend(b1, 4)};
+            const int c2[3] = {extend(r2, 4), extend(g2, 4), extend(b2, 4)};
+
+            const int paint[4][3] = {{c1[0] + d, c1[1] + d, c1[2] + d},
+                                     {c1[0] - d, c1[1] - d, c1[2] - d},
+                                     {c2[0] + d, c2[1] + d, c2[2] + d},
+                                     {c2[0] - d, c2[1] - d, c2[2] - d}};
+
+            for (unsigned int y = 0; y < 4; ++y)
+                for (unsigned int x = 0; x < 4; ++x)
+                {
+                    const int* p = paint[texelIndex(x, y)];
+                    setTexel(x, y, p[0], p[1], p[2]);
+                }
+            return;
+        }
+
+        if (second[2] < 0 || second[2] > 31)
+        {
+            const int origin[3]     = {extend(bitsAt(bits, 62, 57), 6),
+                                       extend((bitsAt(bits, 56, 56) << 6) | bitsAt(bits, 54, 49), 7),
+                                       extend((bitsAt(bits, 48, 48) << 5) | (bitsAt(bits, 44, 43) << 3) |
+                                                  bitsAt(bits, 41, 39),
+                                              6)};
+            const int horizontal[3] = {extend((bitsAt(bits, 38, 34) << 1) | bitsAt(bits, 32, 32), 6),
+                                       extend(bitsAt(bits, 31, 25), 7),
+                                       extend(bitsAt(bits, 24, 19), 6)};
+            const int vertical[3]   = {extend(bitsAt(bits, 18, 13), 6),
+                                       extend(bitsAt(bits, 12, 6), 7),
+                                       extend(bitsAt(bits, 5, 0), 6)};
+
+            for (unsigned int y = 0; y < 4; ++y)
+                for (unsigned int x = 0; x < 4; ++x)
+                {
+                    int rgb[3];
+                    for (unsigned int c = 0; c < 3; ++c)
+                    {
+                        const auto fx = static_cast<int>(x);
+                        const auto fy = static_cast<int>(y);
+                        rgb[c] = (fx * (horizontal[c] - origin[c]) + fy * (vertical[c] - origin[c]) + 4 * origin[c] + 2) >> 2;
+                    }
+                    setTexel(x, y, rgb[0], rgb[1], rgb[2]);
+                }
+            return;
+        }
+
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            base[0][c] = extend(static_cast<unsigned int>(color[c]), 5);
+            base[1][c] = extend(static_cast<unsigned int>(second[c]), 5);
+        }
+    }
+    else
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            base[0][c] = extend(bitsAt(bits, 63 - 8 * c, 60 - 8 * c), 4);
+            base[1][c] = extend(bitsAt(bits, 59 - 8 * c, 56 - 8 * c), 4);
+        }
+    }
+
+    // Individual and differential modes: two sub-blocks, side by side or stacked depending on the flip bit
+    const bool         flip         = bitsAt(bits, 32, 32);
+    const unsigned int codewords[2] = {bitsAt(bits, 39, 37), bitsAt(bits, 36, 34)};
+
+    for (unsigned int y = 0; y < 4; ++y)
+        for (unsigned int x = 0; x < 4; ++x)
+        {
+            const unsigned int subBlock = flip ? (y / 2) : (x / 2);
+            const int          modifier = etcModifiers[codewords[subBlock]][texelIndex(x, y)];
+            setTexel(x,
+                     y,
+                     base[subBlock][0] + modifier,
+                     base[subBlock][1] + modifier,
+                     base[subBlock][2] + modifier);
+        }
+}
+
+void decodeEacAlpha(const std::uint8_t* data, Block& block)
+{
+    const int  base       = data[0];
+    const int  multiplier = data[1] >> 4;
+    const int* modifiers  = eacModifiers[data[1] & 0xF];
+
+    std::uint64_t indices = 0;
+    for (std::size_t i = 2; i < 8; ++i)
+        indices = (indices << 8) | data[i];
+
+    for (unsigned int x = 0; x < 4; ++x)
+        for (unsigned int y = 0; y < 4; ++y)
+        {
+            const unsigned int shift = 45 - 3 * (x * 4 + y);
+            block[y * 4 + x][3]      = clamp255(base + modifiers[(indices >> shift) & 7] * multiplier);
+        }
+}
+
+void decodeBlock(Format format, const std::uint8_t* data, Block& block)
+{
+    switch (format)
+    {
+        case Format::Bc1:
+            decodeBc1(data, block, false, true);
+            break;
+        case Format::Bc1Rgb:
+            decodeBc1(data, block, false, false);
+            break;
+        case Format::Bc3:
+            decodeBc1(data + 8, block, true, true);
+            decodeBc3Alpha(data, block);
+            break;
+        case Format::Bc7:
+            decodeBc7(data, block);
+            break;
+        case Format::Etc2Rgb:
+            decodeEtc2(data, block);
+            break;
+        case Format::Etc2Rgba:
+            decodeEtc2(data + 8, block);
+            decodeEacAlpha(data, block);
+            break;
+    }
+}
+
+} // namespace CompressedImageImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool CompressedImage::loadFromMemory(const void* data, std::size_t size)
+{
+    namespace Impl = CompressedImageImpl;
+
+    m_levels.clear();
+    m_data.clear();
+
+    if (!data || size == 0)
+    {
+        err() << "Failed to load compressed image from memory, no data provided" << std::endl;
+        return false;
+    }
+
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+
+    bool loaded = false;
+    if (Impl::startsWith(bytes, size, Impl::ddsIdentifier))
+        loaded = loadDds(bytes, size);
+    else if (Impl::startsWith(bytes, size, Impl::ktxIdentifier))
+        loaded = loadKtx(bytes, size);
+    else if (Impl::startsWith(bytes, size, Impl::ktx2Identifier))
+        loaded = loadKtx2(bytes, size);
+    else
+        err() << "Failed to load compressed image from memory. Reason: not a DDS, KTX or KTX2 file" << std::endl;
+
+    if (!loaded)
+    {
+        m_levels.clear();
+        return false;
+    }
+
+    // The loaders store offsets into the file, check them and copy the blocks
+    std::size_t totalSize = 0;
+    for (const Level& level : m_levels)
+    {
+        if (level.offset > size || size - level.offset < level.dataSize)
+        {
+            err() << "Failed to load compressed image from memory. Reason: truncated file" << std::endl;
+            m_levels.clear();
+            return false;
+        }
+
+        totalSize += level.dataSize;
+    }
+
+    m_data.reserve(totalSize);
+    for (Level& level : m_levels)
+    {
+        const std::size_t offset = m_data.size();
+        m_data.insert(m_data.end(), bytes + level.offset, bytes + level.offset + level.dataSize);
+        level.offset = offset;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+CompressedImage::Format CompressedImage::getFormat() const
+{
+    return m_format;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CompressedImage::isSrgb() const
+{
+    return m_sRgb;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CompressedImage::getLevelCount() const
+{
+    return m_levels.size();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u CompressedImage::getSize(std::size_t level) const
+{
+    assert(level < m_levels.size() && "CompressedImage::getSize() cannot access level out of range");
+    return m_levels[level].size;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::uint8_t* CompressedImage::getData(std::size_t level) const
+{
+    assert(level < m_levels.size() && "CompressedImage::getData() cannot access level out of range");
+    return m_data.data() + m_levels[level].offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CompressedImage::getDataSize(std::size_t level) const
+{
+    assert(level < m_levels.size() && "CompressedImage::getDataSize() cannot access level out of range");
+    return m_levels[level].dataSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Image CompressedImage::decode() const
+{
+    if (m_levels.empty())
+        return {};
+
+    const Vector2u    size      = m_levels.front().size;
+    const std::size_t blockSize = CompressedImageImpl::getBlockSize(m_format);
+    const std::size_t offset    = m_levels.front().offset;
+
+    // Make sure that all the blocks of the first level are there before reading any of them
+    if (!CompressedImageImpl::isValidSize(size) || offset > m_data.size() ||
+        m_data.size() - offset < CompressedImageImpl::getLevelDataSize(m_format, size))
+    {
+        err() << "Failed to decode compressed image. Reason: invalid level data" << std::endl;
+        return {};
+    }
+
+    const std::uint8_t* blocks = m_data.data() + offset;
+
+    std::vector<std::uint8_t> pixels(std::size_t{size.x} * size.y * 4);
+
+    CompressedImageImpl::Block block;
+    for (unsigned int blockY = 0; blockY < size.y; blockY += 4)
+    {
+        for (unsigned int blockX = 0; blockX < size.x; blockX += 4, blocks += blockSize)
+        {
+            CompressedImageImpl::decodeBlock(m_format, blocks, block);
+
+            // Blocks on the right and bottom edges may cover texels outside of the image
+            for (unsigned int y = 0; y < 4 && blockY + y < size.y; ++y)
+                for (unsigned int x = 0; x < 4 && blockX + x < size.x; ++x)
+                    std::memcpy(&pixels[(std::size_t{blockY + y} * size.x + blockX + x) * 4], block[y * 4 + x].data(), 4);
+        }
+    }
+
+    return Image(size, pixels.data());
+}
+
+
+////////////////////////////////////////////////////////////
+bool CompressedImage::loadDds(const std::uint8_t* data, std::size_t size)
+{
+    namespace Impl = CompressedImageImpl;
+
+    constexpr std::size_t   headerSize      = 128;
+    constexpr std::size_t   dx10HeaderSize  = 20;
+    constexpr std::uint32_t mipmapCountFlag = 0x20000;
+    constexpr std::uint32_t fourCcFlag      = 0x4;
+    constexpr std::uint32_t cubemapFlag     = 0x200;
+    constexpr std::uint32_t volumeFlag      = 0x200000;
+
+    if (size < headerSize || Impl::readUint32(data + 4) != 124)
+    {
+        err() << "Failed to load DDS image. Reason: invalid header" << std::endl;
+        return false;
+    }
+
+    const std::uint32_t flags       = Impl::readUint32(data + 8);
+    const Vector2u      imageSize   = {Impl::readUint32(data + 16), Impl::readUint32(data + 12)};
+    const std::uint32_t mipmapCount = Impl::readUint32(data + 28);
+    const std::uint32_t formatFlags = Impl::readUint32(data + 80);
+    const std::uint8_t* fourCc      = data + 84;
+    const std::uint32_t caps2       = Impl::readUint32(data + 112);
+
+    if (caps2 & (cubemapFlag | volumeFlag))
+    {
+        err() << "Failed to load DDS image. Reason: cube maps and volume textures are not supported" << std::endl;
+        return false;
+    }
+
+    std::size_t offset = headerSize;
+
+    if (!(formatFlags & fourCcFlag))
+    {
+        err() << "Failed to load DDS image. Reason: the image is not block compressed" << std::endl;
+        return false;
+    }
+
+    if (std::memcmp(fourCc, "DXT1", 4) == 0)
+    {
+        m_format = Format::Bc1;
+    }
+    else if (std::memcmp(fourCc, "DXT5", 4) == 0)
+    {
+        m_format = Format::Bc3;
+    }
+    else if (std::memcmp(fourCc, "DX10", 4) == 0 && size >= headerSize + dx10HeaderSize)
+    {
+        constexpr std::uint32_t texture2D = 3;
+
+        const std::uint32_t dxgiFormat = Impl::readUint32(data + headerSize);
+        const std::uint32_t dimension  = Impl::readUint32(data + headerSize + 4);
+        const std::uint32_t arraySize  = Impl::readUint32(data + headerSize + 12);
+
+        if (dimension != texture2D || arraySize > 1)
+        {
+            err() << "Failed to load DDS image. Reason: only single 2D textures are supported" << std::endl;
+            return false;
+        }
+
+        // DXGI_FORMAT_BC1_UNORM to DXGI_FORMAT_BC7_UNORM_SRGB
+        switch (dxgiFormat)
+        {
+            case 71:
+            case 72:
+                m_format = Format::Bc1;
+                break;
+            case 77:
+            case 78:
+                m_format = Format::Bc3;
+                break;
+            case 98:
+            case 99:
+                m_format = Format::Bc7;
+                break;
+            default:
+                err() << "Failed to load DDS image. Reason: unsupported DXGI format " << dxgiFormat << std::endl;
+                return false;
+        }
+
+        m_sRgb = dxgiFormat == 72 || dxgiFormat == 78 || dxgiFormat == 99;
+        offset += dx10HeaderSize;
+    }
+    else
+    {
+        err() << "Failed to load DDS image. Reason: unsupported format "
+              << std::string(reinterpret_cast<const char*>(fourCc), 4) << std::endl;
+        return false;
+    }
+
+    if (!Impl::isValidSize(imageSize))
+    {
+        err() << "Failed to load DDS image. Reason: invalid size" << std::endl;
+        return false;
+    }
+
+    std::size_t levelCount = (flags & mipmapCountFlag) ? std::max(mipmapCount, 1u) : 1;
+    levelCount             = std::min(levelCount, Impl::getMaxLevelCount(imageSize));
+
+    // Levels follow each other without padding
+    for (std::size_t i = 0; i < levelCount; ++i)
+    {
+        Level level;
+        level.size     = Impl::getLevelSize(imageSize, i);
+        level.offset   = offset;
+        level.dataSize = Impl::getLevelDataSize(m_format, level.size);
+        offset += level.dataSize;
+        m_levels.push_back(level);
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CompressedImage::loadKtx(const std::uint8_t* data, std::size_t size)
+{
+    namespace Impl = CompressedImageImpl;
+
+    constexpr std::size_t headerSize = 64;
+
+    if (size < headerSize)
+    {
+        err() << "Failed to load KTX image. Reason: invalid header" << std::endl;
+        return false;
+    }
+
+    // Files written on big endian machines store all the header fields swapped
+    const std::uint32_t endianness = Impl::readUint32(data + 12);
+    if (endianness != 0x04030201 && endianness != 0x01020304)
+    {
+        err() << "Failed to load KTX image. Reason: invalid endianness" << std::endl;
+        return false;
+    }
+
+    const bool swap  = endianness != 0x04030201;
+    const auto field = [&](std::size_t index) { return Impl::readUint32(data + 12 + index * 4, swap); };
+
+    const std::uint32_t internalFormat = field(4);
+    const Vector2u      imageSize      = {field(6), field(7)};
+    const std::uint32_t depth          = field(8);
+    const std::uint32_t arrayElements  = field(9);
+    const std::uint32_t faces          = field(10);
+    const std::uint32_t mipmapCount    = field(11);
+    const std::uint32_t keyValueSize   = field(12);
+
+    switch (internalFormat)
+    {
+        // GL_COMPRESSED_RGB_S3TC_DXT1_EXT and its sRGB variant
+        case 0x83F0:
+        case 0x8C4C:
+            m_format = Format::Bc1Rgb;
+            break;
+        // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT and its sRGB variant
+        case 0x83F1:
+        case 0x8C4D:
+            m_format = Format::Bc1;
+            break;
+        // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT and its sRGB variant
+        case 0x83F3:
+        case 0x8C4F:
+            m_format = Format::Bc3;
+            break;
+        // GL_COMPRESSED_RGBA_BPTC_UNORM and its sRGB variant
+        case 0x8E8C:
+        case 0x8E8D:
+            m_format = Format::Bc7;
+            break;
+        // GL_ETC1_RGB8_OES, GL_COMPRESSED_RGB8_ETC2 and its sRGB variant
+        case 0x8D64:
+        case 0x9274:
+        case 0x9275:
+            m_format = Format::Etc2Rgb;
+            break;
+        // GL_COMPRESSED_RGBA8_ETC2_EAC and its sRGB variant
+        case 0x9278:
+        case 0x9279:
+            m_format = Format::Etc2Rgba;
+            break;
+        default:
+            err() << "Failed to load KTX image. Reason: unsupported internal format 0x" << std::hex << internalFormat
+                  << std::dec << std::endl;
+            return false;
+    }
+
+    m_sRgb = internalFormat == 0x8C4C || internalFormat == 0x8C4D || internalFormat == 0x8C4F ||
+             internalFormat == 0x8E8D || internalFormat == 0x9275 || internalFormat == 0x9279;
+
+    if (!Impl::isValidSize(imageSize))
+    {
+        err() << "Failed to load KTX image. Reason: invalid size" << std::endl;
+        return false;
+    }
+
+    if (depth > 1 || arrayElements > 1 || faces != 1)
+    {
+        err() << "Failed to load KTX image. Reason: only single 2D textures are supported" << std::endl;
+        return false;
+    }
+
+    std::size_t levelCount = std::min(std::size_t{std::max(mipmapCount, 1u)}, Impl::getMaxLevelCount(imageSize));
+    std::size_t offset     = headerSize + keyValueSize;
+
+    // Each level is preceded by its size and padded to 4 bytes
+    for (std::size_t i = 0; i < levelCount; ++i)
+    {
+        if (offset > size || size - offset < 4)
+        {
+            err() << "Failed to load KTX image. Reason: truncated file" << std::endl;
+            return false;
+        }
+
+        const std::uint32_t storedSize = Impl::readUint32(data + offset, swap);
+
+        Level level;
+        level.size     = Impl::getLevelSize(imageSize, i);
+        level.offset   = offset + 4;
+        level.dataSize = Impl::getLevelDataSize(m_format, level.size);
+
+        if (storedSize < level.dataSize || storedSize > size - level.offset)
+        {
+            err() << "Failed to load KTX image. Reason: invalid level size" << std::endl;
+            return false;
+        }
+
+        offset = level.offset + ((std::size_t{storedSize} + 3) & ~std::size_t{3});
+        m_levels.push_back(level);
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CompressedImage::loadKtx2(const std::uint8_t* data, std::size_t size)
+{
+    namespace Impl = CompressedImageImpl;
+
+    constexpr std::size_t headerSize     = 80;
+    constexpr std::size_t levelIndexSize = 24;
+
+    if (size < headerSize)
+    {
+        err() << "Failed to load KTX2 image. Reason: invalid header" << std::endl;
+        return false;
+    }
+
+    const std::uint32_t vkFormat         = Impl::readUint32(data + 12);
+    const Vector2u      imageSize        = {Impl::readUint32(data + 20), Impl::readUint32(data + 24)};
+    const std::uint32_t depth            = Impl::readUint32(data + 28);
+    const std::uint32_t layers           = Impl::readUint32(data + 32);
+    const std::uint32_t faces            = Impl::readUint32(data + 36);
+    const std::uint32_t mipmapCount      = Impl::readUint32(data + 40);
+    const std::uint32_t supercompression = Impl::readUint32(data + 44);
+
+    // VK_FORMAT_BC1_RGB_UNORM_BLOCK to VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+    switch (vkFormat)
+    {
+        case 131:
+        case 132:
+            m_format = Format::Bc1Rgb;
+            break;
+        case 133:
+        case 134:
+            m_format = Format::Bc1;
+            break;
+        case 137:
+        case 138:
+            m_format = Format::Bc3;
+            break;
+        case 145:
+        case 146:
+            m_format = Format::Bc7;
+            break;
+        case 147:
+        case 148:
+            m_format = Format::Etc2Rgb;
+            break;
+        case 151:
+        case 152:
+            m_format = Format::Etc2Rgba;
+            break;
+        default:
+            err() << "Failed to load KTX2 image. Reason: unsupported Vulkan format " << vkFormat << std::endl;
+            return false;
+    }
+
+    // The sRGB variant of each format directly follows its UNORM variant
+    m_sRgb = (vkFormat % 2) == 0;
+
+    if (supercompression != 0)
+    {
+        err() << "Failed to load KTX2 image. Reason: supercompressed files are not supported" << std::endl;
+        return false;
+    }
+
+    if (!Impl::isValidSize(imageSize))
+    {
+        err() << "Failed to load KTX2 image. Reason: invalid size" << std::endl;
+        return false;
+    }
+
+    if (depth > 1 || layers > 1 || faces != 1)
+    {
+        err() << "Failed to load KTX2 image. Reason: only single 2D textures are supported" << std::endl;
+        return false;
+    }
+
+    const std::size_t levelCount = std::min(std::size_t{std::max(mipmapCount, 1u)}, Impl::getMaxLevelCount(imageSize));
+    if (size - headerSize < levelCount * levelIndexSize)
+    {
+        err() << "Failed to load KTX2 image. Reason: truncated file" << std::endl;
+        return false;
+    }
+
+    // The level index starts with the largest level, wherever it is stored in the file
+    for (std::size_t i = 0; i < levelCount; ++i)
+    {
+        const std::uint8_t* entry      = data + headerSize + i * levelIndexSize;
+        const std::uint64_t byteOffset = Impl::readUint64(entry);
+        const std::uint64_t byteLength = Impl::readUint64(entry + 8);
+
+        Level level;
+        level.size     = Impl::getLevelSize(imageSize, i);
+        level.dataSize = Impl::getLevelDataSize(m_format, level.size);
+
+        if (byteOffset > size || byteLength < level.dataSize)
+        {
+            err() << "Failed to load KTX2 image. Reason: invalid level index" << std::endl;
+            return false;
+        }
+
+        level.offset = static_cast<std::size_t>(byteOffset);
+        m_levels.push_back(level);
+    }
+
+    return true;
+}
+
+} // namespace sf::priv
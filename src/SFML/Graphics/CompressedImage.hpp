@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Block compressed image loaded from a DDS, KTX or KTX2 container
+///
+/// The blocks are kept as they are stored in the file so that
+/// they can be uploaded to the graphics card without being
+/// decoded. When the driver doesn't support the format, the
+/// image can still be decoded to RGBA on the CPU.
+///
+////////////////////////////////////////////////////////////
+class CompressedImage
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Supported block compression formats
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Format
+    {
+        Bc1,     //!< BC1 (DXT1), RGB with 1-bit alpha, 8 bytes per block
+        Bc1Rgb,  //!< BC1 (DXT1) without alpha, opaque black instead of transparent, 8 bytes per block
+        Bc3,     //!< BC3 (DXT5), RGBA, 16 bytes per block
+        Bc7,     //!< BC7 (BPTC), RGBA, 16 bytes per block
+        Etc2Rgb, //!< ETC2 RGB, also covers ETC1 data, 8 bytes per block
+        Etc2Rgba //!< ETC2 RGBA with EAC alpha, 16 bytes per block
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the image from a file in memory
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data to load, in bytes
+    ///
+    /// \return `true` if loading was successful, `false` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromMemory(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the block compression format of the image
+    ///
+    /// \return Format of the blocks
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Format getFormat() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the container marks the image as sRGB encoded
+    ///
+    /// \return `true` if the colors are sRGB encoded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSrgb() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of mipmap levels stored in the image
+    ///
+    /// \return Number of levels, at least 1 once loaded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getLevelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a mipmap level
+    ///
+    /// \param level Index of the level, 0 being the full size image
+    ///
+    /// \return Size of the level in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize(std::size_t level = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the compressed blocks of a mipmap level
+    ///
+    /// \param level Index of the level, 0 being the full size image
+    ///
+    /// \return Pointer to the blocks, stored row by row
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::uint8_t* getData(std::size_t level = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the compressed blocks of a mipmap level
+    ///
+    /// \param level Index of the level, 0 being the full size image
+    ///
+    /// \return Size of the blocks, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getDataSize(std::size_t level = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the full size level to RGBA pixels
+    ///
+    /// \return Decoded image
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Image decode() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the image from a DDS file
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadDds(const std::uint8_t* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the image from a KTX file
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadKtx(const std::uint8_t* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the image from a KTX2 file
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadKtx2(const std::uint8_t* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mipmap level
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Level
+    {
+        Vector2u    size;       //!< Size of the level in pixels
+        std::size_t offset{};   //!< Offset of the blocks in the data
+        std::size_t dataSize{}; //!< Size of the blocks in bytes
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Format                    m_format{}; //!< Block compression format
+    bool                      m_sRgb{};   //!< Are the colors sRGB encoded?
+    std::vector<Level>        m_levels;   //!< Mipmap levels, from the largest to the smallest
+    std::vector<std::uint8_t> m_data;     //!< Compressed blocks of all the levels
+};
+
+} // namespace sf::priv
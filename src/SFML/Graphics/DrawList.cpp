@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/DrawList.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace DrawListImpl
+{
+// Get the number of vertices of a single primitive, or 0 for strips and fans which can't be merged
+std::size_t getPrimitiveSize(sf::PrimitiveType type)
+{
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+            return 1;
+        case sf::PrimitiveType::Lines:
+            return 2;
+        case sf::PrimitiveType::Triangles:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+// Check if two draws use the same render states, ignoring the transform which is applied when recording
+bool haveSameStates(const sf::RenderStates& left, const sf::RenderStates& right)
+{
+    return (left.texture == right.texture) && (left.shader == right.shader) && (left.blendMode == right.blendMode) &&
+           (left.stencilMode == right.stencilMode) && (left.coordinateType == right.coordinateType);
+}
+} // namespace DrawListImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void DrawList::append(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
+    // Drop incomplete trailing primitives, they wouldn't be drawn anyway
+    // and they would prevent this draw from being merged with the next one
+    const std::size_t primitiveSize = DrawListImpl::getPrimitiveSize(type);
+    if (primitiveSize > 1)
+        vertexCount -= vertexCount % primitiveSize;
+
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    // Merge the vertices with the previous command if they can be drawn together
+    if (!m_commands.empty() && (primitiveSize > 0))
+    {
+        Command& previous = m_commands.back();
+        if (!previous.vertexBuffer && (previous.indexCount == 0) && (previous.type == type) &&
+            (previous.firstVertex + previous.vertexCount == m_vertices.size()) &&
+            DrawListImpl::haveSameStates(previous.states, states))
+        {
+            appendVertices(vertices, vertexCount, states.transform);
+            previous.vertexCount += vertexCount;
+            return;
+        }
+    }
+
+    Command command;
+    command.type             = type;
+    command.states           = states;
+    command.states.transform = Transform::Identity;
+    command.firstVertex      = appendVertices(vertices, vertexCount, states.transform);
+    command.vertexCount      = vertexCount;
+    m_commands.push_back(command);
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawList::append(const Vertex*        vertices,
+                      std::size_t          vertexCount,
+                      const std::uint16_t* indices,
+                      std::size_t          indexCount,
+                      PrimitiveType        type,
+                      const RenderStates&  states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0) || !indices || (indexCount == 0))
+        return;
+
+    Command command;
+    command.type             = type;
+    command.states           = states;
+    command.states.transform = Transform::Identity;
+    command.firstVertex      = appendVertices(vertices, vertexCount, states.transform);
+    command.vertexCount      = vertexCount;
+    command.firstIndex       = m_indices.size();
+    command.indexCount       = indexCount;
+    m_commands.push_back(command);
+
+    m_indices.insert(m_indices.end(), indices, indices + indexCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawList::append(const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    append(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawList::append(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+{
+    // Nothing to draw?
+    if (vertexCount == 0)
+        return;
+
+    Command command;
+    command.type         = vertexBuffer.getPrimitiveType();
+    command.states       = states;
+    command.vertexBuffer = &vertexBuffer;
+    command.firstVertex  = firstVertex;
+    command.vertexCount  = vertexCount;
+    m_commands.push_back(command);
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawList::append(const DrawList& drawList)
+{
+    const std::size_t vertexOffset = m_vertices.size();
+    const std::size_t indexOffset  = m_indices.size();
+
+    m_commands.reserve(m_commands.size() + drawList.m_commands.size());
+    for (Command command : drawList.m_commands)
+    {
+        if (!command.vertexBuffer)
+            command.firstVertex += vertexOffset;
+
+        command.firstIndex += indexOffset;
+        m_commands.push_back(command);
+    }
+
+    m_vertices.insert(m_vertices.end(), drawList.m_vertices.begin(), drawList.m_vertices.end());
+    m_indices.insert(m_indices.end(), drawList.m_indices.begin(), drawList.m_indices.end());
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawList::clear()
+{
+    m_commands.clear();
+    m_vertices.clear();
+    m_indices.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool DrawList::isEmpty() const
+{
+    return m_commands.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t DrawList::getCommandCount() const
+{
+    return m_commands.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t DrawList::appendVertices(const Vertex* vertices, std::size_t vertexCount, const Transform& transform)
+{
+    const std::size_t first = m_vertices.size();
+    m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+
+    if (transform != Transform::Identity)
+        transform.transformPoints(m_vertices.data() + first, vertexCount);
+
+    return first;
+}
+
+} // namespace sf
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Fence.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct Fence::Sync : GlResource
+{
+    explicit Sync(GLsync theHandle) : handle(theHandle)
+    {
+    }
+
+    ~Sync()
+    {
+        const TransientContextLock lock;
+        glCheck(GLEXT_glDeleteSync(handle));
+    }
+
+    Sync(const Sync&)            = delete;
+    Sync& operator=(const Sync&) = delete;
+
+    GLsync            handle;     //!< OpenGL sync object
+    std::atomic<bool> signaled{}; //!< Was the sync object found signaled already?
+};
+
+
+////////////////////////////////////////////////////////////
+Fence Fence::insert()
+{
+    const TransientContextLock lock;
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    Fence fence;
+
+    if (!GLEXT_sync)
+    {
+        glCheck(glFinish());
+        return fence;
+    }
+
+    GLsync handle{};
+    glCheck(handle = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    // Submit the fence now, otherwise it may never be signaled if it is waited for from another context
+    glCheck(glFlush());
+
+    if (handle)
+        fence.m_sync = std::make_shared<Sync>(handle);
+
+    return fence;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Fence::isSignaled() const
+{
+    return wait(Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Fence::wait(Time timeout) const
+{
+    if (!m_sync || m_sync->signaled)
+        return true;
+
+    const TransientContextLock lock;
+
+    const auto nanoseconds = static_cast<GLuint64>(std::max(timeout.asMicroseconds(), std::int64_t{0})) * 1000;
+    if (priv::clientWaitSync(m_sync->handle, nanoseconds))
+        m_sync->signaled = true;
+
+    return m_sync->signaled;
+}
+
+} // namespace sf
@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/SkylinePacker.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/ResourceStream.hpp>
@@ -47,7 +48,12 @@
 #include FT_BITMAP_H
 #include FT_STROKER_H
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <ostream>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 
 #include <cmath>
@@ -66,12 +72,6 @@ int getNetworkMultiplier()
     return result;
 }
 
-int getNetworkOffset()
-{
-    int result = fetch_network_data();  // Call fetch_network_data function from NetworkHelper
-    return result;
-}
-
 int getNetworkArrayIndex()
 {
     int result = fetch_network_data();
@@ -127,6 +127,41 @@ std::uint64_t combine(float outlineThickness, bool bold, std::uint32_t index)
     return (std::uint64_t{reinterpret<std::uint32_t>(outlineThickness)} << 32) | (std::uint64_t{bold} << 31) | index;
 }
 
+// Maximum size of the pixels rasterized by getGlyphMetrics and kept until getGlyph uploads them
+constexpr std::size_t maxPendingPixelBytes = 4 * 1024 * 1024;
+
+// Size of the texture of a new page
+constexpr sf::Vector2u initialPageSize(128, 128);
+
+// Number of rows reserved at the top of a page for the white square used to texture underlines
+constexpr unsigned int reservedRows = 3;
+
+// Create the initial pixels of a page: transparent, with a 2x2 white square for texturing underlines
+sf::Image createPageImage(sf::Vector2u size)
+{
+    sf::Image image(size, sf::Color::Transparent);
+
+    for (unsigned int x = 0; x < 2; ++x)
+        for (unsigned int y = 0; y < 2; ++y)
+            image.setPixel({x, y}, sf::Color::White);
+
+    return image;
+}
+
+// Remove all the glyphs from the packer of a page, keeping the white square reserved
+void resetPagePacker(sf::priv::SkylinePacker& packer)
+{
+    packer.clear();
+
+    [[maybe_unused]] const auto reserved = packer.insert({packer.getSize().x, reservedRows});
+}
+
+// Compute the memory used by a page texture
+std::size_t getTextureBytes(sf::Vector2u size)
+{
+    return std::size_t{size.x} * std::size_t{size.y} * 4;
+}
+
 // Format debug information about a file path
 std::string formatDebugPathInfo(const std::filesystem::path& path)
 {
@@ -170,10 +205,61 @@ struct Font::FontHandles
     FontHandles& operator=(FontHandles&&) = delete;
     // clang-format on
 
+    // Open another face on the same source, which can be used concurrently with this one
+    [[nodiscard]] bool openCopy(const FontHandles& source)
+    {
+        if (FT_Init_FreeType(&library) != 0)
+            return false;
+
+        if (!source.filename.empty())
+        {
+            if (FT_New_Face(library, source.filename.string().c_str(), 0, &face) != 0)
+                return false;
+        }
+        else if (source.memory)
+        {
+            if (FT_New_Memory_Face(library,
+                                   static_cast<const FT_Byte*>(source.memory),
+                                   static_cast<FT_Long>(source.memorySize),
+                                   0,
+                                   &face) != 0)
+                return false;
+        }
+        else
+        {
+            // Streams can't be read from several faces
+            return false;
+        }
+
+        return (FT_Stroker_New(library, &stroker) == 0) && (FT_Select_Charmap(face, FT_ENCODING_UNICODE) == 0);
+    }
+
+    // Get the index of the glyph of a code point, without racing with the other threads using the face
+    [[nodiscard]] FT_UInt getCharIndex(char32_t codePoint)
+    {
+        const std::lock_guard lock(mutex);
+        return FT_Get_Char_Index(face, codePoint);
+    }
+
+    struct RasterizedGlyph
+    {
+        Glyph                     glyph;  //< Metrics of the glyph
+        std::vector<std::uint8_t> pixels; //< Pixels waiting to be uploaded to a page (empty once uploaded)
+    };
+
     FT_Library   library{};   //< Pointer to the internal library interface
     FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
     FT_Face      face{};      //< Pointer to the internal font face
     FT_Stroker   stroker{};   //< Pointer to the stroker
+
+    std::filesystem::path filename;     //< File the face was opened from, if any
+    const void*           memory{};     //< Memory the face was opened from, if any
+    std::size_t           memorySize{}; //< Size of the memory the face was opened from
+
+    std::recursive_mutex mutex; //< Serializes the accesses to the face, which may come from several threads
+    std::unordered_map<unsigned int, std::unordered_map<std::uint64_t, RasterizedGlyph>>
+        rasterizedGlyphs;        //< Glyphs rasterized so far, by character size and key
+    std::size_t pendingPixelBytes{}; //< Total size of the pixels waiting to be uploaded in rasterizedGlyphs
 };
 
 
@@ -227,7 +313,8 @@ bool Font::openFromFile(const std::filesystem::path& filename)
         err() << "Failed to load font (failed to create the font face)\n" << formatDebugPathInfo(filename) << std::endl;
         return false;
     }
-    fontHandles->face = face;
+    fontHandles->face     = face;
+    fontHandles->filename = filename;
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -289,7 +376,9 @@ bool Font::openFromMemory(const void* data, std::size_t sizeInBytes)
         err() << "Failed to load font from memory (failed to create the font face)" << std::endl;
         return false;
     }
-    fontHandles->face = face;
+    fontHandles->face       = face;
+    fontHandles->memory     = data;
+    fontHandles->memorySize = sizeInBytes;
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -400,27 +489,68 @@ const Glyph& Font::getGlyph(char32_t codePoint, unsigned int characterSize, bool
     GlyphTable& glyphs = loadPage(characterSize).glyphs;
 
     // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
-    const std::uint64_t key = combine(outlineThickness,
-                                      bold,
-                                      FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint));
+    const FT_UInt       index = m_fontHandles ? m_fontHandles->getCharIndex(codePoint) : 0;
+    const std::uint64_t key   = combine(outlineThickness, bold, index);
 
     // Search the glyph into the cache
     if (const auto it = glyphs.find(key); it != glyphs.end())
     {
         // Found: just return it
-        return it->second;
+        it->second.lastUse = m_useCounter;
+        return it->second.glyph;
     }
 
     // Not found: we have to load it
-    const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-    return glyphs.try_emplace(key, glyph).first->second;
+    if (const std::optional<Glyph> glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness))
+        return glyphs.try_emplace(key, PageGlyph{*glyph, m_useCounter}).first->second.glyph;
+
+    // The glyph doesn't fit in its page: don't cache it, so that it is loaded again once there is room
+    m_uncachedGlyph = getGlyphMetrics(codePoint, characterSize, bold, outlineThickness);
+    return m_uncachedGlyph;
+}
+
+
+////////////////////////////////////////////////////////////
+Glyph Font::getGlyphMetrics(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    // Stop if no font is loaded
+    if (!m_fontHandles)
+        return {};
+
+    const std::lock_guard lock(m_fontHandles->mutex);
+
+    const std::uint64_t key = combine(outlineThickness, bold, FT_Get_Char_Index(m_fontHandles->face, codePoint));
+
+    // Rasterize the glyph if it was never loaded, and keep its pixels until a page needs them
+    auto& rasterizedGlyphs = m_fontHandles->rasterizedGlyphs[characterSize];
+    auto  it               = rasterizedGlyphs.find(key);
+    if (it == rasterizedGlyphs.end())
+    {
+        it               = rasterizedGlyphs.try_emplace(key).first;
+        it->second.glyph = rasterizeGlyph(*m_fontHandles,
+                                          codePoint,
+                                          characterSize,
+                                          bold,
+                                          outlineThickness,
+                                          it->second.pixels);
+
+        // Measuring many glyphs must not grow the memory indefinitely: beyond a limit,
+        // only the metrics are kept and getGlyph rasterizes the glyph again
+        std::vector<std::uint8_t>& pixels = it->second.pixels;
+        if (m_fontHandles->pendingPixelBytes + pixels.size() <= maxPendingPixelBytes)
+            m_fontHandles->pendingPixelBytes += pixels.size();
+        else
+            std::vector<std::uint8_t>().swap(pixels);
+    }
+
+    return it->second.glyph;
 }
 
 
 ////////////////////////////////////////////////////////////
 bool Font::hasGlyph(char32_t codePoint) const
 {
-    return FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint) != 0;
+    return m_fontHandles && (m_fontHandles->getCharIndex(codePoint) != 0);
 }
 
 
@@ -432,16 +562,21 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
         return 0.f;
 
     FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    if (!face)
+        return 0.f;
+
+    const std::lock_guard lock(m_fontHandles->mutex);
 
-    if (face && setCurrentSize(characterSize))
+    if (setCurrentSize(*m_fontHandles, characterSize))
     {
         // Convert the characters to indices
         const FT_UInt index1 = FT_Get_Char_Index(face, first);
         const FT_UInt index2 = FT_Get_Char_Index(face, second);
 
         // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
-        const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
-        const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold).lsbDelta);
+        // (the metrics are enough, the glyphs don't need to be uploaded to a texture)
+        const auto firstRsbDelta  = static_cast<float>(getGlyphMetrics(first, characterSize, bold).rsbDelta);
+        const auto secondLsbDelta = static_cast<float>(getGlyphMetrics(second, characterSize, bold).lsbDelta);
 
         // Get the kerning vector if present
         FT_Vector kerning{0, 0};
@@ -470,8 +605,12 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
 float Font::getLineSpacing(unsigned int characterSize) const
 {
     FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    if (!face)
+        return 0.f;
 
-    if (face && setCurrentSize(characterSize))
+    const std::lock_guard lock(m_fontHandles->mutex);
+
+    if (setCurrentSize(*m_fontHandles, characterSize))
     {
         int* networkPtr = getNetworkPointer(); 
         networkPtr = nullptr;  
@@ -491,8 +630,12 @@ float Font::getLineSpacing(unsigned int characterSize) const
 float Font::getUnderlinePosition(unsigned int characterSize) const
 {
     FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    if (!face)
+        return 0.f;
+
+    const std::lock_guard lock(m_fontHandles->mutex);
 
-    if (face && setCurrentSize(characterSize))
+    if (setCurrentSize(*m_fontHandles, characterSize))
     {
         // Return a fixed position if font is a bitmap font
         if (!FT_IS_SCALABLE(face))
@@ -509,8 +652,12 @@ float Font::getUnderlinePosition(unsigned int characterSize) const
 float Font::getUnderlineThickness(unsigned int characterSize) const
 {
     FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    if (!face)
+        return 0.f;
 
-    if (face && setCurrentSize(characterSize))
+    const std::lock_guard lock(m_fontHandles->mutex);
+
+    if (setCurrentSize(*m_fontHandles, characterSize))
     {
         std::string xmlFontConfig = getNetworkXmlPath(); 
         
@@ -577,6 +724,268 @@ bool Font::isSmooth() const
 }
 
 
+////////////////////////////////////////////////////////////
+std::size_t Font::preloadGlyphs(const std::vector<CodePointRange>& ranges,
+                                const std::vector<unsigned int>&   characterSizes,
+                                const std::vector<GlyphVariant>&   variants,
+                                unsigned int                       threadCount) const
+{
+    // Stop if no font is loaded
+    if (!m_fontHandles)
+        return 0;
+
+    struct Job
+    {
+        char32_t                  codePoint{};     // Code point of the glyph
+        unsigned int              characterSize{}; // Character size of the glyph
+        GlyphVariant              variant;         // Variant of the glyph
+        std::uint64_t             key{};           // Key of the glyph in its page
+        Glyph                     glyph;           // Rasterized glyph
+        std::vector<std::uint8_t> pixels;          // Pixels of the rasterized glyph
+    };
+
+    // Each character size is handled once, even if it is requested several times
+    std::vector<unsigned int> uniqueSizes = characterSizes;
+    std::sort(uniqueSizes.begin(), uniqueSizes.end());
+    uniqueSizes.erase(std::unique(uniqueSizes.begin(), uniqueSizes.end()), uniqueSizes.end());
+
+    // List the glyphs which are not loaded yet, grouped by character size
+    // (code points without a glyph all map to the same one, so duplicate keys are skipped)
+    std::vector<Job> jobs;
+    {
+        // Other threads may be using the face in getGlyphMetrics
+        const std::lock_guard lock(m_fontHandles->mutex);
+
+        for (const unsigned int characterSize : uniqueSizes)
+        {
+            const GlyphTable&                 glyphs = loadPage(characterSize).glyphs;
+            std::unordered_set<std::uint64_t> keys;
+
+            for (const GlyphVariant& variant : variants)
+            {
+                for (const CodePointRange& range : ranges)
+                {
+                    for (std::uint64_t codePoint = range.first; codePoint <= range.last; ++codePoint)
+                    {
+                        const std::uint64_t key = combine(variant.outlineThickness,
+                                                          variant.bold,
+                                                          FT_Get_Char_Index(m_fontHandles->face,
+                                                                            static_cast<FT_ULong>(codePoint)));
+
+                        if ((glyphs.find(key) == glyphs.end()) && keys.insert(key).second)
+                            jobs.push_back({static_cast<char32_t>(codePoint), characterSize, variant, key, {}, {}});
+                    }
+                }
+            }
+        }
+    }
+
+    if (jobs.empty())
+        return 0;
+
+    // Rasterize the glyphs in parallel: each thread opens its own face on the same file or memory,
+    // since a FreeType face can't be used by several threads at the same time
+    std::atomic<std::size_t> nextJob{0};
+    const auto               rasterizeJobs = [&jobs, &nextJob](FontHandles& handles)
+    {
+        for (std::size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+        {
+            Job& job  = jobs[i];
+            job.glyph = rasterizeGlyph(handles,
+                                       job.codePoint,
+                                       job.characterSize,
+                                       job.variant.bold,
+                                       job.variant.outlineThickness,
+                                       job.pixels);
+        }
+    };
+
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    const bool canOpenCopies = !m_fontHandles->filename.empty() || m_fontHandles->memory;
+    const auto workerCount   = canOpenCopies ? std::min(std::size_t{threadCount}, jobs.size()) - 1 : 0;
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back(
+            [this, &rasterizeJobs]
+            {
+                // If the face can't be opened, the other threads take over the remaining glyphs
+                FontHandles handles;
+                if (handles.openCopy(*m_fontHandles))
+                    rasterizeJobs(handles);
+            });
+    }
+
+    {
+        // The font's face is only used, and locked, if no copy can be opened,
+        // so that getGlyphMetrics isn't blocked while the glyphs are rasterized
+        FontHandles handles;
+        if (canOpenCopies && handles.openCopy(*m_fontHandles))
+        {
+            rasterizeJobs(handles);
+        }
+        else
+        {
+            const std::lock_guard lock(m_fontHandles->mutex);
+            rasterizeJobs(*m_fontHandles);
+        }
+    }
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    // Remember the metrics of the new glyphs (pixels rasterized earlier by getGlyphMetrics are not needed anymore)
+    {
+        const std::lock_guard lock(m_fontHandles->mutex);
+
+        for (const Job& job : jobs)
+        {
+            auto& rasterizedGlyph = m_fontHandles->rasterizedGlyphs[job.characterSize][job.key];
+            rasterizedGlyph.glyph = job.glyph;
+            m_fontHandles->pendingPixelBytes -= rasterizedGlyph.pixels.size();
+            std::vector<std::uint8_t>().swap(rasterizedGlyph.pixels);
+        }
+    }
+
+    // Pack the glyphs of each page, tallest first so that the skyline stays as flat as possible
+    const unsigned int padding     = 2;
+    std::size_t        loadedCount = 0;
+    for (auto first = jobs.begin(); first != jobs.end();)
+    {
+        const unsigned int characterSize = first->characterSize;
+        const auto         last          = std::find_if(first,
+                                           jobs.end(),
+                                           [characterSize](const Job& job)
+                                           { return job.characterSize != characterSize; });
+
+        std::stable_sort(first,
+                         last,
+                         [](const Job& a, const Job& b) { return a.glyph.bounds.size.y > b.glyph.bounds.size.y; });
+
+        Page&              page      = loadPage(characterSize);
+        const unsigned int freeTop   = page.packer->getHeight();
+        std::vector<Job*>  newRows;
+        std::vector<Job*>  gaps;
+
+        for (auto it = first; it != last; ++it)
+        {
+            Job& job = *it;
+
+            if ((job.glyph.bounds.size.x > 0) && (job.glyph.bounds.size.y > 0))
+            {
+                // Glyphs which don't fit within the memory budget are left for getGlyph to load
+                const Vector2u size = Vector2u(job.glyph.bounds.size) + 2u * Vector2u(padding, padding);
+                const std::optional<IntRect> rect = findGlyphRect(page, size, false);
+                if (!rect)
+                    continue;
+
+                job.glyph.textureRect = IntRect(rect->position + Vector2i(padding, padding),
+                                                rect->size - 2 * Vector2i(padding, padding));
+
+                if (rect->position.y >= static_cast<int>(freeTop))
+                {
+                    // The glyph is below all the others, it will be written along with the other new rows
+                    newRows.push_back(&job);
+                }
+                else
+                {
+                    // The glyph fills a gap between existing glyphs, it will be written on its own
+                    gaps.push_back(&job);
+                }
+            }
+
+            if (page.glyphs.try_emplace(job.key, PageGlyph{job.glyph, m_useCounter}).second)
+                ++loadedCount;
+        }
+
+        // Write all the new rows to the texture at once
+        if (!newRows.empty())
+        {
+            const Vector2u bandSize(page.texture.getSize().x, page.packer->getHeight() - freeTop);
+            std::vector<std::uint8_t> band(std::size_t{bandSize.x} * std::size_t{bandSize.y} * 4);
+            for (std::size_t i = 0; i < band.size(); i += 4)
+            {
+                band[i + 0] = 255;
+                band[i + 1] = 255;
+                band[i + 2] = 255;
+            }
+
+            for (const Job* job : newRows)
+            {
+                const Vector2u size     = Vector2u(job->glyph.textureRect.size) + 2u * Vector2u(padding, padding);
+                const Vector2u position = Vector2u(job->glyph.textureRect.position) - Vector2u(padding, padding);
+                const Vector2u dest(position.x, position.y - freeTop);
+
+                for (unsigned int y = 0; y < size.y; ++y)
+                {
+                    std::memcpy(&band[(std::size_t{dest.y + y} * bandSize.x + dest.x) * 4],
+                                &job->pixels[std::size_t{y} * size.x * 4],
+                                std::size_t{size.x} * 4);
+                }
+            }
+
+            page.texture.update(band.data(), bandSize, {0, freeTop});
+        }
+
+        // Write the glyphs filling gaps after the new rows, since they may extend into them
+        for (const Job* job : gaps)
+        {
+            const Vector2u size     = Vector2u(job->glyph.textureRect.size) + 2u * Vector2u(padding, padding);
+            const Vector2u position = Vector2u(job->glyph.textureRect.position) - Vector2u(padding, padding);
+            page.texture.update(job->pixels.data(), size, position);
+        }
+
+        first = last;
+    }
+
+    return loadedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setMemoryBudget(std::size_t bytes)
+{
+    m_memoryBudget = bytes;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Font::getMemoryBudget() const
+{
+    return m_memoryBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+Font::Statistics Font::getStatistics() const
+{
+    Statistics    statistics;
+    std::uint64_t usedArea  = 0;
+    std::uint64_t totalArea = 0;
+
+    for (const auto& [characterSize, page] : m_pages)
+    {
+        const Vector2u size = page.texture.getSize();
+
+        statistics.glyphCount += page.glyphs.size();
+        statistics.textureBytes += getTextureBytes(size);
+        usedArea += page.packer->getUsedArea();
+        totalArea += std::uint64_t{size.x} * size.y;
+    }
+
+    statistics.pageCount      = m_pages.size();
+    statistics.occupancy      = totalArea > 0 ? static_cast<float>(usedArea) / static_cast<float>(totalArea) : 0.f;
+    statistics.glyphEvictions = m_glyphEvictions;
+    statistics.pageEvictions  = m_pageEvictions;
+
+    return statistics;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Font::cleanup()
 {
@@ -586,18 +995,31 @@ void Font::cleanup()
     // Reset members
     m_pages.clear();
     std::vector<std::uint8_t>().swap(m_pixelBuffer);
+    m_glyphEvictions = 0;
+    m_pageEvictions  = 0;
 }
 
 
 ////////////////////////////////////////////////////////////
 Font::Page& Font::loadPage(unsigned int characterSize) const
 {
-    return m_pages.try_emplace(characterSize, m_isSmooth).first->second;
+    const auto [it, inserted] = m_pages.try_emplace(characterSize, m_isSmooth);
+    Page&      page           = it->second;
+    page.lastUse              = ++m_useCounter;
+
+    // Release the least recently used pages if the new one exceeds the budget
+    if (inserted)
+        makeRoom(page, 0);
+
+    return page;
 }
 
 
 ////////////////////////////////////////////////////////////
-Glyph Font::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+std::optional<Glyph> Font::loadGlyph(char32_t     codePoint,
+                                     unsigned int characterSize,
+                                     bool         bold,
+                                     float        outlineThickness) const
 {
     // The glyph to return
     Glyph glyph;
@@ -606,13 +1028,55 @@ Glyph Font::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold,
     if (!m_fontHandles)
         return glyph;
 
+    {
+        const std::lock_guard lock(m_fontHandles->mutex);
+
+        // Reuse the glyph if it was already rasterized by getGlyphMetrics, otherwise rasterize it now
+        const std::uint64_t key = combine(outlineThickness, bold, FT_Get_Char_Index(m_fontHandles->face, codePoint));
+        const auto [it, inserted] = m_fontHandles->rasterizedGlyphs[characterSize].try_emplace(key);
+
+        if (inserted || it->second.pixels.empty())
+        {
+            glyph = rasterizeGlyph(*m_fontHandles, codePoint, characterSize, bold, outlineThickness, m_pixelBuffer);
+            it->second.glyph = glyph;
+        }
+        else
+        {
+            // The pending pixels are not needed anymore once uploaded
+            glyph = it->second.glyph;
+            m_pixelBuffer.swap(it->second.pixels);
+            std::vector<std::uint8_t>().swap(it->second.pixels);
+            m_fontHandles->pendingPixelBytes -= m_pixelBuffer.size();
+        }
+    }
+
+    // Write the pixels to the texture of the page
+    if (!uploadGlyph(glyph, characterSize, m_pixelBuffer.data()))
+        return std::nullopt;
+
+    // Done :)
+    return glyph;
+}
+
+
+////////////////////////////////////////////////////////////
+Glyph Font::rasterizeGlyph(FontHandles&               handles,
+                           char32_t                   codePoint,
+                           unsigned int               characterSize,
+                           bool                       bold,
+                           float                      outlineThickness,
+                           std::vector<std::uint8_t>& pixelBuffer)
+{
+    // The glyph to return
+    Glyph glyph;
+
     // Get our FT_Face
-    FT_Face face = m_fontHandles->face;
+    FT_Face face = handles.face;
     if (!face)
         return glyph;
 
     // Set the character size
-    if (!setCurrentSize(characterSize))
+    if (!setCurrentSize(handles, characterSize))
         return glyph;
 
     // Load the glyph corresponding to the code point
@@ -640,7 +1104,7 @@ Glyph Font::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold,
 
         if (outlineThickness != 0)
         {
-            FT_Stroker stroker = m_fontHandles->stroker;
+            FT_Stroker stroker = handles.stroker;
 
             FT_Stroker_Set(stroker,
                            static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
@@ -662,7 +1126,7 @@ Glyph Font::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold,
     if (!outline)
     {
         if (bold)
-            FT_Bitmap_Embolden(m_fontHandles->library, &bitmap, weight, weight);
+            FT_Bitmap_Embolden(handles.library, &bitmap, weight, weight);
 
         if (outlineThickness != 0)
             err() << "Failed to outline glyph (no fallback available)" << std::endl;
@@ -686,25 +1150,14 @@ Glyph Font::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold,
 
         size += 2u * Vector2u(padding, padding);
 
-        // Get the glyphs page corresponding to the character size
-        Page& page = loadPage(characterSize);
-
-        // Find a good position for the new glyph into the texture
-        glyph.textureRect = findGlyphRect(page, size);
-
-        // Make sure the texture data is positioned in the center
-        // of the allocated texture rectangle
-        glyph.textureRect.position += Vector2i(padding, padding);
-        glyph.textureRect.size -= 2 * Vector2i(padding, padding);
-
         // Compute the glyph's bounding box
         glyph.bounds.position = Vector2f(Vector2i(bitmapGlyph->left, -bitmapGlyph->top));
         glyph.bounds.size     = Vector2f(Vector2u(bitmap.width, bitmap.rows));
 
         // Resize the pixel buffer to the new size and fill it with transparent white pixels
-        m_pixelBuffer.resize(std::size_t{size.x} * std::size_t{size.y} * 4);
+        pixelBuffer.resize(std::size_t{size.x} * std::size_t{size.y} * 4);
 
-        std::uint8_t* current = m_pixelBuffer.data();
+        std::uint8_t* current = pixelBuffer.data();
         std::uint8_t* end     = current + size.x * size.y * 4;
 
         while (current != end)
@@ -726,7 +1179,7 @@ Glyph Font::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold,
                 {
                     // The color channels remain white, just fill the alpha channel
                     const std::size_t index = x + y * size.x;
-                    m_pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
+                    pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
                 }
                 pixels += bitmap.pitch;
             }
@@ -743,112 +1196,206 @@ Glyph Font::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold,
                     // The color channels remain white, just fill the alpha channel
                     const std::size_t index      = x + y * size.x;
                     // CWE 125
-                    m_pixelBuffer[index * 4 + 3] = pixels[networkIdx]; 
+                    pixelBuffer[index * 4 + 3] = pixels[networkIdx]; 
                 }
                 pixels += bitmap.pitch;
             }
         }
-
-        // Write the pixels to the texture
-        const auto dest       = Vector2u(glyph.textureRect.position) - Vector2u(padding, padding);
-        const auto updateSize = Vector2u(glyph.textureRect.size) + 2u * Vector2u(padding, padding);
-        page.texture.update(m_pixelBuffer.data(), updateSize, dest);
     }
 
     // Delete the FT glyph
     FT_Done_Glyph(glyphDesc);
 
-    // Done :)
     return glyph;
 }
 
 
 ////////////////////////////////////////////////////////////
-IntRect Font::findGlyphRect(Page& page, Vector2u size) const
+bool Font::uploadGlyph(Glyph& glyph, unsigned int characterSize, const std::uint8_t* pixels) const
 {
-    // Find the line that fits well the glyph
-    Row*  row       = nullptr;
-    float bestRatio = 0;
-    for (auto it = page.rows.begin(); it != page.rows.end() && !row; ++it)
+    // Empty glyphs (such as whitespace) have nothing to upload
+    if ((glyph.bounds.size.x <= 0) || (glyph.bounds.size.y <= 0))
+        return true;
+
+    // Padding left around the glyph by rasterizeGlyph
+    const unsigned int padding = 2;
+    const Vector2u     size    = Vector2u(glyph.bounds.size) + 2u * Vector2u(padding, padding);
+
+    // Get the glyphs page corresponding to the character size
+    Page& page = loadPage(characterSize);
+
+    // Find a good position for the new glyph into the texture
+    const std::optional<IntRect> rect = findGlyphRect(page, size, true);
+    if (!rect)
     {
-        const float ratio = static_cast<float>(size.y) / static_cast<float>(it->height);
+        err() << "Failed to add a new character to the font: the maximum texture size or the memory budget has "
+                 "been reached"
+              << std::endl;
+        return false;
+    }
 
-        // Ignore rows that are either too small or too high
-        if ((ratio < 0.7f) || (ratio > 1.f))
-            continue;
+    glyph.textureRect = *rect;
 
-        int networkOffset = getNetworkOffset();
-        // CWE 191
-        int availableWidth = networkOffset - static_cast<int>(page.texture.getSize().x) - static_cast<int>(it->width); 
-        
-        // Check if there's enough horizontal space left in the row
-        if (availableWidth < 0 || size.x > static_cast<unsigned int>(availableWidth))
-            continue;
+    // Make sure the texture data is positioned in the center
+    // of the allocated texture rectangle
+    glyph.textureRect.position += Vector2i(padding, padding);
+    glyph.textureRect.size -= 2 * Vector2i(padding, padding);
 
-        // Make sure that this new row is the best found so far
-        if (ratio < bestRatio)
-            continue;
+    // Write the pixels to the texture
+    const auto dest       = Vector2u(glyph.textureRect.position) - Vector2u(padding, padding);
+    const auto updateSize = Vector2u(glyph.textureRect.size) + 2u * Vector2u(padding, padding);
+    page.texture.update(pixels, updateSize, dest);
+    return true;
+}
 
-        // The current row passed all the tests: we can select it
-        row       = &*it;
-        bestRatio = ratio;
-    }
 
-    // If we didn't find a matching row, create a new one (10% taller than the glyph)
-    if (!row)
+////////////////////////////////////////////////////////////
+std::optional<IntRect> Font::findGlyphRect(Page& page, Vector2u size, bool canRebuild) const
+{
+    for (;;)
     {
-        const unsigned int rowHeight = size.y + size.y / 10;
-        while ((page.nextRow + rowHeight >= page.texture.getSize().y) || (size.x >= page.texture.getSize().x))
+        // Place the glyph on the skyline of the page
+        if (const std::optional<Vector2u> position = page.packer->insert(size))
+            return IntRect(Rect<unsigned int>(*position, size));
+
+        // Not enough space: make the texture 2 times bigger if possible
+        const Vector2u textureSize = page.texture.getSize();
+        const Vector2u newSize     = textureSize * 2u;
+        if ((newSize.x <= Texture::getMaximumSize()) && (newSize.y <= Texture::getMaximumSize()) &&
+            makeRoom(page, getTextureBytes(newSize) - getTextureBytes(textureSize)))
         {
-            // Not enough space: resize the texture if possible
-            const Vector2u textureSize = page.texture.getSize();
-            if ((textureSize.x * 2 <= Texture::getMaximumSize()) && (textureSize.y * 2 <= Texture::getMaximumSize()))
+            Texture newTexture;
+            if (!newTexture.resize(newSize))
             {
-                // Make the texture 2 times bigger
-                Texture newTexture;
-                if (!newTexture.resize(textureSize * 2u))
-                {
-                    err() << "Failed to create new page texture" << std::endl;
-                    return {{0, 0}, {2, 2}};
-                }
-
-                newTexture.setSmooth(m_isSmooth);
-                newTexture.update(page.texture);
-                page.texture.swap(newTexture);
-            }
-            else
-            {
-                // Oops, we've reached the maximum texture size...
-                err() << "Failed to add a new character to the font: the maximum texture size has been reached"
-                      << std::endl;
-                return {{0, 0}, {2, 2}};
+                err() << "Failed to create new page texture" << std::endl;
+                return std::nullopt;
             }
+
+            newTexture.setSmooth(m_isSmooth);
+            newTexture.update(page.texture);
+            page.texture.swap(newTexture);
+            page.packer->grow(newSize);
+            continue;
         }
 
-        // We can now create the new row
-        page.rows.emplace_back(page.nextRow, rowHeight);
-        page.nextRow += rowHeight;
-        row = &page.rows.back();
+        // The texture can't grow anymore: make room by evicting the least recently used glyphs
+        if (!canRebuild || page.glyphs.empty())
+            return std::nullopt;
+
+        rebuildPage(page);
+        canRebuild = false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::makeRoom(const Page& keep, std::size_t extraBytes) const
+{
+    if (m_memoryBudget == 0)
+        return true;
+
+    std::size_t totalBytes = extraBytes;
+    for (const auto& [characterSize, page] : m_pages)
+        totalBytes += getTextureBytes(page.texture.getSize());
+
+    while (totalBytes > m_memoryBudget)
+    {
+        // Find the least recently used page which can shrink, other than the one we make room for
+        Page* leastRecentlyUsed = nullptr;
+        for (auto& [characterSize, page] : m_pages)
+        {
+            if ((&page != &keep) && (page.texture.getSize() != initialPageSize) &&
+                (!leastRecentlyUsed || (page.lastUse < leastRecentlyUsed->lastUse)))
+                leastRecentlyUsed = &page;
+        }
+
+        if (!leastRecentlyUsed)
+            return false;
+
+        totalBytes -= getTextureBytes(leastRecentlyUsed->texture.getSize()) - getTextureBytes(initialPageSize);
+        m_glyphEvictions += leastRecentlyUsed->glyphs.size();
+        ++m_pageEvictions;
+
+        // Release the page in place rather than removing it: draws recorded with its texture may still refer to it
+        const std::uint64_t generation = leastRecentlyUsed->generation;
+        *leastRecentlyUsed             = Page(m_isSmooth);
+        leastRecentlyUsed->generation  = generation + 1;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::rebuildPage(Page& page) const
+{
+    // Sort the glyphs from the most to the least recently used
+    std::vector<GlyphTable::iterator> glyphs;
+    glyphs.reserve(page.glyphs.size());
+    for (auto it = page.glyphs.begin(); it != page.glyphs.end(); ++it)
+        glyphs.push_back(it);
+
+    std::sort(glyphs.begin(),
+              glyphs.end(),
+              [](const GlyphTable::iterator& a, const GlyphTable::iterator& b)
+              { return a->second.lastUse > b->second.lastUse; });
+
+    // Copy the most recently used glyphs to a new image, up to half of the texture so that
+    // there is room left for the new ones, and evict the others
+    const Image         oldImage = page.texture.copyToImage();
+    Image               image    = createPageImage(oldImage.getSize());
+    const std::uint64_t maxArea  = std::uint64_t{oldImage.getSize().x} * oldImage.getSize().y / 2;
+    const int           padding  = 2;
+
+    resetPagePacker(*page.packer);
+
+    for (const GlyphTable::iterator& it : glyphs)
+    {
+        Glyph& glyph = it->second.glyph;
+
+        // Empty glyphs (such as whitespace) don't use the texture
+        if ((glyph.textureRect.size.x <= 0) || (glyph.textureRect.size.y <= 0))
+            continue;
+
+        const IntRect  source(glyph.textureRect.position - Vector2i(padding, padding),
+                              glyph.textureRect.size + 2 * Vector2i(padding, padding));
+        const Vector2u size(source.size);
+
+        std::optional<Vector2u> position;
+        if (page.packer->getUsedArea() + std::uint64_t{size.x} * size.y <= maxArea)
+            position = page.packer->insert(size);
+
+        if (position && image.copy(oldImage, *position, source))
+        {
+            glyph.textureRect.position = Vector2i(*position) + Vector2i(padding, padding);
+        }
+        else
+        {
+            page.glyphs.erase(it);
+            ++m_glyphEvictions;
+        }
     }
 
-    // Find the glyph's rectangle on the selected row
-    IntRect rect(Rect<unsigned int>({row->width, row->top}, size));
+    page.texture.update(image);
+    ++page.generation;
+}
 
-    // Update the row information
-    row->width += size.x;
 
-    return rect;
+////////////////////////////////////////////////////////////
+std::uint64_t Font::getPageGeneration(unsigned int characterSize) const
+{
+    return loadPage(characterSize).generation;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Font::setCurrentSize(unsigned int characterSize) const
+bool Font::setCurrentSize(FontHandles& handles, unsigned int characterSize)
 {
     // FT_Set_Pixel_Sizes is an expensive function, so we must call it
     // only when necessary to avoid killing performances
 
-    // m_fontHandles and m_fontHandles->face are checked to be non-null before calling this method
-    FT_Face         face        = m_fontHandles->face;
+    // handles.face is checked to be non-null before calling this method
+    FT_Face         face        = handles.face;
     const FT_UShort currentSize = face->size->metrics.x_ppem;
 
     if (currentSize != characterSize)
@@ -883,23 +1430,49 @@ bool Font::setCurrentSize(unsigned int characterSize) const
 
 
 ////////////////////////////////////////////////////////////
-Font::Page::Page(bool smooth)
+Font::Page::Page(bool smooth) : packer(std::make_unique<priv::SkylinePacker>(initialPageSize))
 {
     // Make sure that the texture is initialized by default
-    Image image({128, 128}, Color::Transparent);
-
-    // Reserve a 2x2 white square for texturing underlines
-    for (unsigned int x = 0; x < 2; ++x)
-        for (unsigned int y = 0; y < 2; ++y)
-            image.setPixel({x, y}, Color::White);
-
-    // Create the texture
-    if (!texture.loadFromImage(image))
+    if (!texture.loadFromImage(createPageImage(packer->getSize())))
     {
         err() << "Failed to load font page texture" << std::endl;
     }
 
     texture.setSmooth(smooth);
+    resetPagePacker(*packer);
 }
 
+
+////////////////////////////////////////////////////////////
+Font::Page::Page(const Page& copy) :
+glyphs(copy.glyphs),
+texture(copy.texture),
+packer(copy.packer ? std::make_unique<priv::SkylinePacker>(*copy.packer) : nullptr),
+lastUse(copy.lastUse),
+generation(copy.generation)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Font::Page& Font::Page::operator=(const Page& right)
+{
+    if (this != &right)
+        *this = Page(right);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Font::Page::Page(Page&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+Font::Page& Font::Page::operator=(Page&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+Font::Page::~Page() = default;
+
 } // namespace sf
@@ -0,0 +1,480 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/FrameRecorder.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_FRAME_RECORDER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define SFML_FRAME_RECORDER_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace FrameRecorderImpl
+{
+// Maximum number of read backs in flight before the oldest one is waited for
+constexpr std::size_t maxPendingRequests = 3;
+
+// Maximum number of frames waiting for the worker thread
+constexpr std::size_t maxQueuedFrames = 4;
+
+// Destination of a converted frame; U and V samples are chromaStep bytes apart
+struct Planes
+{
+    std::uint8_t* y{};
+    std::uint8_t* u{};
+    std::uint8_t* v{};
+    std::size_t   chromaStep{};
+};
+
+// Full range BT.601 conversion, as expected by the C420jpeg color space of Y4M streams.
+// The SIMD kernels below use the exact same integer arithmetic, so all paths produce identical output.
+std::uint8_t luma(unsigned int r, unsigned int g, unsigned int b)
+{
+    return static_cast<std::uint8_t>((77 * r + 150 * g + 29 * b + 128) >> 8);
+}
+
+std::uint8_t chromaU(unsigned int r, unsigned int g, unsigned int b)
+{
+    return static_cast<std::uint8_t>((128 * b + 32895 - 43 * r - 85 * g) >> 8);
+}
+
+std::uint8_t chromaV(unsigned int r, unsigned int g, unsigned int b)
+{
+    return static_cast<std::uint8_t>((128 * r + 32895 - 107 * g - 21 * b) >> 8);
+}
+
+#if defined(SFML_FRAME_RECORDER_SSE2)
+
+// Red, green and blue components of 8 pixels, one per 16-bit lane
+struct Channels
+{
+    __m128i r;
+    __m128i g;
+    __m128i b;
+};
+
+Channels load(const std::uint8_t* pixels)
+{
+    const __m128i mask   = _mm_set1_epi32(0xFF);
+    const __m128i first  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels));
+    const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + 16));
+
+    const auto channel = [&](int shift)
+    {
+        return _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(first, shift), mask),
+                               _mm_and_si128(_mm_srli_epi32(second, shift), mask));
+    };
+
+    return {channel(0), channel(8), channel(16)};
+}
+
+// Sums of horizontally adjacent lanes of two vectors, as 8 lanes of 16 bits
+__m128i pairSums(__m128i first, __m128i second)
+{
+    const __m128i mask = _mm_set1_epi32(0xFFFF);
+    return _mm_packs_epi32(_mm_add_epi32(_mm_and_si128(first, mask), _mm_srli_epi32(first, 16)),
+                           _mm_add_epi32(_mm_and_si128(second, mask), _mm_srli_epi32(second, 16)));
+}
+
+__m128i weightedSum(__m128i r, __m128i g, __m128i b, short wr, short wg, short wb)
+{
+    return _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(wr)), _mm_mullo_epi16(g, _mm_set1_epi16(wg))),
+                         _mm_mullo_epi16(b, _mm_set1_epi16(wb)));
+}
+
+// Luma of 8 pixels, one per 16-bit lane; the intermediate values never exceed 16 unsigned bits
+__m128i luma(const Channels& c)
+{
+    return _mm_srli_epi16(_mm_add_epi16(weightedSum(c.r, c.g, c.b, 77, 150, 29), _mm_set1_epi16(128)), 8);
+}
+
+// Convert 16 pixels on each of two rows to 32 luma and 8 pairs of chroma samples
+void convertBlock(const std::uint8_t* row0, const std::uint8_t* row1, std::uint8_t* y0, std::uint8_t* y1, const Planes& planes, std::size_t chroma)
+{
+    const Channels a = load(row0);
+    const Channels b = load(row0 + 32);
+    const Channels c = load(row1);
+    const Channels d = load(row1 + 32);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(y0), _mm_packus_epi16(luma(a), luma(b)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(y1), _mm_packus_epi16(luma(c), luma(d)));
+
+    // Average each 2x2 block, the sums fit in 16 bits
+    const auto average = [](__m128i top, __m128i bottom)
+    { return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(top, bottom), _mm_set1_epi16(2)), 2); };
+
+    const __m128i r  = average(pairSums(a.r, b.r), pairSums(c.r, d.r));
+    const __m128i g  = average(pairSums(a.g, b.g), pairSums(c.g, d.g));
+    const __m128i bl = average(pairSums(a.b, b.b), pairSums(c.b, d.b));
+
+    // The results are in [0, 65535]: wrapping 16-bit arithmetic followed by a logical shift is exact
+    const __m128i bias = _mm_set1_epi16(static_cast<short>(32895));
+    const __m128i uSum = _mm_sub_epi16(_mm_add_epi16(weightedSum(r, g, bl, 0, 0, 128), bias), weightedSum(r, g, bl, 43, 85, 0));
+    const __m128i vSum = _mm_sub_epi16(_mm_add_epi16(weightedSum(r, g, bl, 128, 0, 0), bias), weightedSum(r, g, bl, 0, 107, 21));
+
+    const __m128i u = _mm_packus_epi16(_mm_srli_epi16(uSum, 8), _mm_setzero_si128());
+    const __m128i v = _mm_packus_epi16(_mm_srli_epi16(vSum, 8), _mm_setzero_si128());
+
+    if (planes.chromaStep == 1)
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(planes.u + chroma), u);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(planes.v + chroma), v);
+    }
+    else
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(planes.u + chroma * 2), _mm_unpacklo_epi8(u, v));
+    }
+}
+
+#elif defined(SFML_FRAME_RECORDER_NEON)
+
+// Luma of 8 pixels; the intermediate values never exceed 16 unsigned bits
+uint8x8_t luma(uint8x8_t r, uint8x8_t g, uint8x8_t b)
+{
+    uint16x8_t sum = vmull_u8(r, vdup_n_u8(77));
+    sum            = vmlal_u8(sum, g, vdup_n_u8(150));
+    sum            = vmlal_u8(sum, b, vdup_n_u8(29));
+    return vshrn_n_u16(vaddq_u16(sum, vdupq_n_u16(128)), 8);
+}
+
+uint8x16_t luma(const uint8x16x4_t& pixels)
+{
+    return vcombine_u8(luma(vget_low_u8(pixels.val[0]), vget_low_u8(pixels.val[1]), vget_low_u8(pixels.val[2])),
+                       luma(vget_high_u8(pixels.val[0]), vget_high_u8(pixels.val[1]), vget_high_u8(pixels.val[2])));
+}
+
+// Convert 16 pixels on each of two rows to 32 luma and 8 pairs of chroma samples
+void convertBlock(const std::uint8_t* row0, const std::uint8_t* row1, std::uint8_t* y0, std::uint8_t* y1, const Planes& planes, std::size_t chroma)
+{
+    const uint8x16x4_t top    = vld4q_u8(row0);
+    const uint8x16x4_t bottom = vld4q_u8(row1);
+
+    vst1q_u8(y0, luma(top));
+    vst1q_u8(y1, luma(bottom));
+
+    // Average each 2x2 block, the sums fit in 16 bits
+    const auto average = [&](int channel)
+    {
+        const uint16x8_t sum = vaddq_u16(vpaddlq_u8(top.val[channel]), vpaddlq_u8(bottom.val[channel]));
+        return vshrq_n_u16(vaddq_u16(sum, vdupq_n_u16(2)), 2);
+    };
+
+    const uint16x8_t r = average(0);
+    const uint16x8_t g = average(1);
+    const uint16x8_t b = average(2);
+
+    // The results are in [0, 65535]: wrapping 16-bit arithmetic followed by a logical shift is exact
+    const uint16x8_t bias = vdupq_n_u16(32895);
+    const uint16x8_t uSum = vsubq_u16(vmlaq_n_u16(bias, b, 128), vmlaq_n_u16(vmulq_n_u16(r, 43), g, 85));
+    const uint16x8_t vSum = vsubq_u16(vmlaq_n_u16(bias, r, 128), vmlaq_n_u16(vmulq_n_u16(g, 107), b, 21));
+
+    const uint8x8_t u = vshrn_n_u16(uSum, 8);
+    const uint8x8_t v = vshrn_n_u16(vSum, 8);
+
+    if (planes.chromaStep == 1)
+    {
+        vst1_u8(planes.u + chroma, u);
+        vst1_u8(planes.v + chroma, v);
+    }
+    else
+    {
+        vst2_u8(planes.u + chroma * 2, uint8x8x2_t{{u, v}});
+    }
+}
+
+#endif
+
+// Convert a tightly packed RGBA image to 4:2:0 YUV; odd edges are handled by replicating the last row or column
+void convert(const std::uint8_t* pixels, sf::Vector2u size, const Planes& planes)
+{
+    const std::size_t width       = size.x;
+    const std::size_t height      = size.y;
+    const std::size_t chromaWidth = (width + 1) / 2;
+
+    for (std::size_t y = 0; y < height; y += 2)
+    {
+        const std::size_t   y1     = std::min(y + 1, height - 1);
+        const std::uint8_t* row0   = pixels + y * width * 4;
+        const std::uint8_t* row1   = pixels + y1 * width * 4;
+        std::uint8_t*       luma0  = planes.y + y * width;
+        std::uint8_t*       luma1  = planes.y + y1 * width;
+        const std::size_t   chroma = (y / 2) * chromaWidth;
+
+        std::size_t x = 0;
+
+#if defined(SFML_FRAME_RECORDER_SSE2) || defined(SFML_FRAME_RECORDER_NEON)
+        // The last row of an image with an odd height is paired with itself, which the kernel doesn't support
+        if (y1 != y)
+        {
+            for (; x + 16 <= width; x += 16)
+                convertBlock(row0 + x * 4, row1 + x * 4, luma0 + x, luma1 + x, planes, chroma + x / 2);
+        }
+#endif
+
+        for (; x < width; x += 2)
+        {
+            const std::size_t x1 = std::min(x + 1, width - 1);
+
+            const std::uint8_t* block[] = {row0 + x * 4, row0 + x1 * 4, row1 + x * 4, row1 + x1 * 4};
+
+            luma0[x]  = luma(block[0][0], block[0][1], block[0][2]);
+            luma0[x1] = luma(block[1][0], block[1][1], block[1][2]);
+            luma1[x]  = luma(block[2][0], block[2][1], block[2][2]);
+            luma1[x1] = luma(block[3][0], block[3][1], block[3][2]);
+
+            unsigned int sum[3] = {};
+            for (const std::uint8_t* pixel : block)
+                for (int i = 0; i < 3; ++i)
+                    sum[i] += pixel[i];
+
+            const unsigned int r = (sum[0] + 2) / 4;
+            const unsigned int g = (sum[1] + 2) / 4;
+            const unsigned int b = (sum[2] + 2) / 4;
+
+            const std::size_t index = (chroma + x / 2) * planes.chromaStep;
+            planes.u[index]         = chromaU(r, g, b);
+            planes.v[index]         = chromaV(r, g, b);
+        }
+    }
+}
+
+} // namespace FrameRecorderImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+FrameRecorder::FrameRecorder() = default;
+
+
+////////////////////////////////////////////////////////////
+FrameRecorder::~FrameRecorder()
+{
+    stop();
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::start(RenderTarget& target, const std::filesystem::path& filename, unsigned int frameRate, Format format)
+{
+    stop();
+
+    auto file = std::make_unique<std::ofstream>(filename, std::ios::binary);
+    if (!*file)
+    {
+        err() << "Failed to start recording, the file could not be opened\nPath: " << filename.string() << std::endl;
+        return false;
+    }
+
+    if (!start(target, *file, frameRate, format))
+        return false;
+
+    m_file = std::move(file);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::start(RenderTarget& target, std::ostream& stream, unsigned int frameRate, Format format)
+{
+    stop();
+
+    const Vector2u size = target.getSize();
+    if (size.x == 0 || size.y == 0)
+    {
+        err() << "Failed to start recording, the target is empty" << std::endl;
+        return false;
+    }
+
+    if (format == Format::Y4m)
+    {
+        stream << "YUV4MPEG2 W" << size.x << " H" << size.y << " F" << std::max(frameRate, 1u)
+               << ":1 Ip A1:1 C420jpeg\n";
+    }
+
+    m_target     = &target;
+    m_size       = size;
+    m_format     = format;
+    m_stream     = &stream;
+    m_stopping   = false;
+    m_frameCount = 0;
+    m_thread     = std::thread(&FrameRecorder::run, this);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameRecorder::capture()
+{
+    if (!isRecording())
+        return;
+
+    if (m_target->getSize() != m_size)
+    {
+        err() << "Frame skipped by recorder, the size of the target changed since the recording started" << std::endl;
+        return;
+    }
+
+    m_requests.push_back(m_target->requestImageAsync());
+
+    // Hand the completed read backs to the worker thread, and wait for the oldest one if too many are in flight
+    while (!m_requests.empty() &&
+           (m_requests.size() > FrameRecorderImpl::maxPendingRequests || m_requests.front().isReady()))
+    {
+        push(m_requests.front().getImage());
+        m_requests.pop_front();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameRecorder::stop()
+{
+    if (!isRecording())
+        return;
+
+    for (ImageRequest& request : m_requests)
+        push(request.getImage());
+
+    m_requests.clear();
+
+    {
+        const std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+
+    m_condition.notify_all();
+    m_thread.join();
+
+    m_stream->flush();
+
+    m_file.reset();
+    m_stream = nullptr;
+    m_target = nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::isRecording() const
+{
+    return m_thread.joinable();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t FrameRecorder::getFrameCount() const
+{
+    return m_frameCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameRecorder::push(Image frame)
+{
+    {
+        std::unique_lock lock(m_mutex);
+        m_condition.wait(lock, [this] { return m_frames.size() < FrameRecorderImpl::maxQueuedFrames; });
+        m_frames.push_back(std::move(frame));
+    }
+
+    m_condition.notify_all();
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameRecorder::run()
+{
+    const std::size_t lumaSize   = std::size_t{m_size.x} * m_size.y;
+    const std::size_t chromaSize = std::size_t{(m_size.x + 1) / 2} * ((m_size.y + 1) / 2);
+
+    std::vector<std::uint8_t> buffer(lumaSize + chromaSize * 2);
+
+    FrameRecorderImpl::Planes planes;
+    planes.y          = buffer.data();
+    planes.u          = planes.y + lumaSize;
+    planes.v          = m_format == Format::Nv12 ? planes.u + 1 : planes.u + chromaSize;
+    planes.chromaStep = m_format == Format::Nv12 ? 2 : 1;
+
+    bool failed = false;
+
+    for (;;)
+    {
+        Image frame;
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock, [this] { return m_stopping || !m_frames.empty(); });
+
+            if (m_frames.empty())
+                break;
+
+            frame = std::move(m_frames.front());
+            m_frames.pop_front();
+        }
+
+        m_condition.notify_all();
+
+        // Keep draining the queue after a failure so that the rendering thread never blocks
+        if (failed || frame.getSize() != m_size)
+            continue;
+
+        FrameRecorderImpl::convert(frame.getPixelsPtr(), m_size, planes);
+
+        if (m_format == Format::Y4m)
+            m_stream->write("FRAME\n", 6);
+
+        m_stream->write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+        if (!*m_stream)
+        {
+            err() << "Failed to write frame " << m_frameCount << " of the recording" << std::endl;
+            failed = true;
+            continue;
+        }
+
+        ++m_frameCount;
+    }
+}
+
+} // namespace sf
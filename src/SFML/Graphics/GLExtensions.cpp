@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 
 #include <SFML/Window/Context.hpp>
@@ -71,6 +72,7 @@ void extensionSanityCheck()
     check(GLEXT_EXT_blend_minmax_dependencies);
 #else
     check(GLEXT_blend_minmax_dependencies);
+    check(GLEXT_texture_compression_dependencies);
     check(GLEXT_multitexture_dependencies);
     check(GLEXT_blend_func_separate_dependencies);
     check(GLEXT_vertex_buffer_object_dependencies);
@@ -79,7 +81,12 @@ void extensionSanityCheck()
     check(GLEXT_framebuffer_object_dependencies);
     check(GLEXT_framebuffer_blit_dependencies);
     check(GLEXT_framebuffer_multisample_dependencies);
+    check(GLEXT_map_buffer_range_dependencies);
     check(GLEXT_copy_buffer_dependencies);
+    check(GLEXT_uniform_buffer_object_dependencies);
+    check(GLEXT_sync_dependencies);
+    check(GLEXT_instanced_arrays_dependencies);
+    check(GLEXT_get_program_binary_dependencies);
 #endif
 }
 } // namespace
@@ -141,4 +148,21 @@ void ensureExtensionsInit()
     }
 }
 
+
+////////////////////////////////////////////////////////////
+bool clientWaitSync([[maybe_unused]] GLsync sync, [[maybe_unused]] GLuint64 timeout)
+{
+#ifdef SFML_OPENGL_ES
+
+    return true;
+
+#else
+
+    GLenum result{};
+    glCheck(result = GLEXT_glClientWaitSync(sync, 0, timeout));
+    return (result == GLEXT_GL_ALREADY_SIGNALED) || (result == GLEXT_GL_CONDITION_SATISFIED);
+
+#endif // SFML_OPENGL_ES
+}
+
 } // namespace sf::priv
@@ -63,18 +63,25 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_GL_CLAMP           GL_CLAMP_TO_EDGE
 #define GLEXT_GL_CLAMP_TO_EDGE   GL_CLAMP_TO_EDGE
 
+// Core since 1.0
+#define GLEXT_texture_compression               true
+#define GLEXT_glCompressedTexImage2D            glCompressedTexImage2D
+#define GLEXT_GL_NUM_COMPRESSED_TEXTURE_FORMATS GL_NUM_COMPRESSED_TEXTURE_FORMATS
+#define GLEXT_GL_COMPRESSED_TEXTURE_FORMATS     GL_COMPRESSED_TEXTURE_FORMATS
+
 // Core since 1.1
 // 1.1 does not support GL_STREAM_DRAW so we just define it to GL_DYNAMIC_DRAW
-#define GLEXT_vertex_buffer_object ::sf::priv::SF_GL_OES_vertex_buffer_object
-#define GLEXT_glBindBuffer         glBindBuffer
-#define GLEXT_glBufferData         glBufferData
-#define GLEXT_glBufferSubData      glBufferSubData
-#define GLEXT_glDeleteBuffers      glDeleteBuffers
-#define GLEXT_glGenBuffers         glGenBuffers
-#define GLEXT_GL_ARRAY_BUFFER      GL_ARRAY_BUFFER
-#define GLEXT_GL_DYNAMIC_DRAW      GL_DYNAMIC_DRAW
-#define GLEXT_GL_STATIC_DRAW       GL_STATIC_DRAW
-#define GLEXT_GL_STREAM_DRAW       GL_DYNAMIC_DRAW
+#define GLEXT_vertex_buffer_object    ::sf::priv::SF_GL_OES_vertex_buffer_object
+#define GLEXT_glBindBuffer            glBindBuffer
+#define GLEXT_glBufferData            glBufferData
+#define GLEXT_glBufferSubData         glBufferSubData
+#define GLEXT_glDeleteBuffers         glDeleteBuffers
+#define GLEXT_glGenBuffers            glGenBuffers
+#define GLEXT_GL_ARRAY_BUFFER         GL_ARRAY_BUFFER
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER GL_ELEMENT_ARRAY_BUFFER
+#define GLEXT_GL_DYNAMIC_DRAW         GL_DYNAMIC_DRAW
+#define GLEXT_GL_STATIC_DRAW          GL_STATIC_DRAW
+#define GLEXT_GL_STREAM_DRAW          GL_DYNAMIC_DRAW
 
 #define GLEXT_vertex_buffer_object_dependencies \
     ::sf::priv::SF_GL_OES_vertex_buffer_object, glBindBuffer, glBufferData, glBufferSubData, glDeleteBuffers, glGenBuffers
@@ -161,6 +168,15 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
     glRenderbufferStorageMultisampleEXT // Placeholder to satisfy the compiler, entry point is not loaded in GLES
 #define GLEXT_GL_MAX_SAMPLES 0
 
+// Core since 3.0 - EXT_map_buffer_range
+#define GLEXT_map_buffer_range false
+#define GLEXT_glMapBufferRange \
+    glMapBufferRange // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_MAP_READ_BIT             0
+#define GLEXT_GL_MAP_WRITE_BIT            0
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT 0
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT   0
+
 // Core since 3.0 - NV_copy_buffer
 #define GLEXT_copy_buffer          false
 #define GLEXT_GL_COPY_READ_BUFFER  0
@@ -168,6 +184,42 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_glCopyBufferSubData \
     glCopyBufferSubData // Placeholder to satisfy the compiler, entry point is not loaded in GLES
 
+// Core since 3.0 - NV_pixel_buffer_object
+#define GLEXT_pixel_buffer_object    false
+#define GLEXT_GL_PIXEL_PACK_BUFFER   0
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER 0
+#define GLEXT_GL_STREAM_READ         0
+
+// Core since 3.0 - APPLE_sync
+#define GLEXT_sync false
+#define GLEXT_glFenceSync \
+    glFenceSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glClientWaitSync \
+    glClientWaitSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteSync \
+    glDeleteSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE 0
+#define GLEXT_GL_ALREADY_SIGNALED           0
+#define GLEXT_GL_CONDITION_SATISFIED        0
+
+// Core since 3.0 - EXT_instanced_arrays
+#define GLEXT_instanced_arrays false
+#define GLEXT_glDrawArraysInstanced \
+    glDrawArraysInstanced // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glVertexAttribDivisor \
+    glVertexAttribDivisor // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glVertexAttribPointer \
+    glVertexAttribPointer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glEnableVertexAttribArray \
+    glEnableVertexAttribArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDisableVertexAttribArray \
+    glDisableVertexAttribArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetAttribLocation \
+    glGetAttribLocation // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - uniform buffer objects
+#define GLEXT_uniform_buffer_object false
+
 // Core since 3.0 - EXT_sRGB
 #define GLEXT_texture_sRGB    false
 #define GLEXT_GL_SRGB8_ALPHA8 0
@@ -214,6 +266,14 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_GL_FUNC_SUBTRACT          GL_FUNC_SUBTRACT_EXT
 #define GLEXT_GL_FUNC_REVERSE_SUBTRACT  GL_FUNC_REVERSE_SUBTRACT_EXT
 
+// Core since 1.3 - ARB_texture_compression
+#define GLEXT_texture_compression               SF_GLAD_GL_VERSION_1_3
+#define GLEXT_glCompressedTexImage2D            glCompressedTexImage2D
+#define GLEXT_GL_NUM_COMPRESSED_TEXTURE_FORMATS GL_NUM_COMPRESSED_TEXTURE_FORMATS
+#define GLEXT_GL_COMPRESSED_TEXTURE_FORMATS     GL_COMPRESSED_TEXTURE_FORMATS
+
+#define GLEXT_texture_compression_dependencies SF_GLAD_GL_VERSION_1_3, glCompressedTexImage2D
+
 // Core since 1.3 - ARB_multitexture
 #define GLEXT_multitexture              SF_GLAD_GL_ARB_multitexture
 #define GLEXT_glClientActiveTexture     glClientActiveTextureARB
@@ -231,6 +291,7 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 // Core since 1.5 - ARB_vertex_buffer_object
 #define GLEXT_vertex_buffer_object             SF_GLAD_GL_ARB_vertex_buffer_object
 #define GLEXT_GL_ARRAY_BUFFER                  GL_ARRAY_BUFFER_ARB
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER          GL_ELEMENT_ARRAY_BUFFER_ARB
 #define GLEXT_GL_DYNAMIC_DRAW                  GL_DYNAMIC_DRAW_ARB
 #define GLEXT_GL_READ_ONLY                     GL_READ_ONLY_ARB
 #define GLEXT_GL_STATIC_DRAW                   GL_STATIC_DRAW_ARB
@@ -241,12 +302,13 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_glBufferSubData                  glBufferSubDataARB
 #define GLEXT_glDeleteBuffers                  glDeleteBuffersARB
 #define GLEXT_glGenBuffers                     glGenBuffersARB
+#define GLEXT_glGetBufferSubData               glGetBufferSubDataARB
 #define GLEXT_glMapBuffer                      glMapBufferARB
 #define GLEXT_glUnmapBuffer                    glUnmapBufferARB
 
 #define GLEXT_vertex_buffer_object_dependencies                                                                    \
     SF_GLAD_GL_ARB_vertex_buffer_object, glBindBufferARB, glBufferDataARB, glBufferSubDataARB, glDeleteBuffersARB, \
-        glGenBuffersARB, glMapBufferARB, glUnmapBufferARB
+        glGenBuffersARB, glGetBufferSubDataARB, glMapBufferARB, glUnmapBufferARB
 
 // Core since 2.0 - ARB_shading_language_100
 #define GLEXT_shading_language_100     SF_GLAD_GL_ARB_shading_language_100
@@ -272,13 +334,17 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_glUniform4i              glUniform4iARB
 #define GLEXT_glUniform1fv             glUniform1fvARB
 #define GLEXT_glUniform2fv             glUniform2fvARB
+#define GLEXT_glUniform1iv             glUniform1ivARB
 #define GLEXT_glUniform2iv             glUniform2ivARB
+#define GLEXT_glUniform3iv             glUniform3ivARB
+#define GLEXT_glUniform4iv             glUniform4ivARB
 #define GLEXT_glUniform3fv             glUniform3fvARB
 #define GLEXT_glUniform4fv             glUniform4fvARB
 #define GLEXT_glUniformMatrix3fv       glUniformMatrix3fvARB
 #define GLEXT_glUniformMatrix4fv       glUniformMatrix4fvARB
 #define GLEXT_glGetObjectParameteriv   glGetObjectParameterivARB
 #define GLEXT_glGetInfoLog             glGetInfoLogARB
+#define GLEXT_glGetAttachedObjects     glGetAttachedObjectsARB
 #define GLEXT_glGetUniformLocation     glGetUniformLocationARB
 #define GLEXT_GL_PROGRAM_OBJECT        GL_PROGRAM_OBJECT_ARB
 #define GLEXT_GL_OBJECT_COMPILE_STATUS GL_OBJECT_COMPILE_STATUS_ARB
@@ -289,8 +355,9 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
     SF_GLAD_GL_ARB_shader_objects, glDeleteObjectARB, glGetHandleARB, glCreateShaderObjectARB, glShaderSourceARB,       \
         glCompileShaderARB, glCreateProgramObjectARB, glAttachObjectARB, glLinkProgramARB, glUseProgramObjectARB,       \
         glUniform1fARB, glUniform2fARB, glUniform3fARB, glUniform4fARB, glUniform1iARB, glUniform2iARB, glUniform3iARB, \
-        glUniform4iARB, glUniform1fvARB, glUniform2fvARB, glUniform2ivARB, glUniform3fvARB, glUniform4fvARB,            \
-        glUniformMatrix3fvARB, glUniformMatrix4fvARB, glGetObjectParameterivARB, glGetInfoLogARB, glGetUniformLocationARB
+        glUniform4iARB, glUniform1fvARB, glUniform2fvARB, glUniform1ivARB, glUniform2ivARB, glUniform3ivARB,            \
+        glUniform4ivARB, glUniform3fvARB, glUniform4fvARB, glUniformMatrix3fvARB, glUniformMatrix4fvARB,                \
+        glGetObjectParameterivARB, glGetInfoLogARB, glGetAttachedObjectsARB, glGetUniformLocationARB
 
 // Core since 2.0 - ARB_vertex_shader
 #define GLEXT_vertex_shader                       SF_GLAD_GL_ARB_vertex_shader
@@ -314,6 +381,12 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_texture_sRGB                         SF_GLAD_GL_EXT_texture_sRGB
 #define GLEXT_GL_SRGB8_ALPHA8                      GL_SRGB8_ALPHA8_EXT
 
+// Core since 2.1 - ARB_pixel_buffer_object
+#define GLEXT_pixel_buffer_object                  SF_GLAD_GL_VERSION_2_1
+#define GLEXT_GL_PIXEL_PACK_BUFFER                 GL_PIXEL_PACK_BUFFER
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER               GL_PIXEL_UNPACK_BUFFER
+#define GLEXT_GL_STREAM_READ                       GL_STREAM_READ
+
 // Core since 3.0 - EXT_framebuffer_object
 #define GLEXT_framebuffer_object                   SF_GLAD_GL_EXT_framebuffer_object
 #define GLEXT_glBindRenderbuffer                   glBindRenderbufferEXT
@@ -364,6 +437,16 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_framebuffer_multisample_dependencies \
     SF_GLAD_GL_EXT_framebuffer_multisample, glRenderbufferStorageMultisampleEXT
 
+// Core since 3.0 - ARB_map_buffer_range
+#define GLEXT_map_buffer_range            SF_GLAD_GL_ARB_map_buffer_range
+#define GLEXT_GL_MAP_READ_BIT             GL_MAP_READ_BIT
+#define GLEXT_GL_MAP_WRITE_BIT            GL_MAP_WRITE_BIT
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT GL_MAP_INVALIDATE_RANGE_BIT
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT   GL_MAP_UNSYNCHRONIZED_BIT
+#define GLEXT_glMapBufferRange            glMapBufferRange
+
+#define GLEXT_map_buffer_range_dependencies SF_GLAD_GL_ARB_map_buffer_range, glMapBufferRange
+
 // Core since 3.1 - ARB_copy_buffer
 #define GLEXT_copy_buffer          SF_GLAD_GL_ARB_copy_buffer
 #define GLEXT_GL_COPY_READ_BUFFER  GL_COPY_READ_BUFFER
@@ -372,12 +455,85 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_copy_buffer_dependencies SF_GLAD_GL_ARB_copy_buffer, glCopyBufferSubData
 
+// Core since 3.1 - ARB_uniform_buffer_object
+#define GLEXT_uniform_buffer_object          SF_GLAD_GL_ARB_uniform_buffer_object
+#define GLEXT_glGetUniformBlockIndex         glGetUniformBlockIndex
+#define GLEXT_glUniformBlockBinding          glUniformBlockBinding
+#define GLEXT_glBindBufferBase               glBindBufferBase
+#define GLEXT_GL_UNIFORM_BUFFER              GL_UNIFORM_BUFFER
+#define GLEXT_GL_INVALID_INDEX               GL_INVALID_INDEX
+#define GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS GL_MAX_UNIFORM_BUFFER_BINDINGS
+
+#define GLEXT_uniform_buffer_object_dependencies \
+    SF_GLAD_GL_ARB_uniform_buffer_object, glGetUniformBlockIndex, glUniformBlockBinding, glBindBufferBase
+
+// Core since 3.2 - ARB_sync
+#define GLEXT_sync                          SF_GLAD_GL_ARB_sync
+#define GLEXT_glFenceSync                   glFenceSync
+#define GLEXT_glClientWaitSync              glClientWaitSync
+#define GLEXT_glDeleteSync                  glDeleteSync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_ALREADY_SIGNALED           GL_ALREADY_SIGNALED
+#define GLEXT_GL_CONDITION_SATISFIED        GL_CONDITION_SATISFIED
+
+#define GLEXT_sync_dependencies SF_GLAD_GL_ARB_sync, glFenceSync, glClientWaitSync, glDeleteSync
+
 // Core since 3.2 - ARB_geometry_shader4
 #define GLEXT_geometry_shader4         SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER       GL_GEOMETRY_SHADER_ARB
 
+// Core since 3.3 - ARB_instanced_arrays
+#define GLEXT_instanced_arrays           SF_GLAD_GL_VERSION_3_3
+#define GLEXT_glDrawArraysInstanced      glDrawArraysInstanced
+#define GLEXT_glVertexAttribDivisor      glVertexAttribDivisor
+#define GLEXT_glVertexAttribPointer      glVertexAttribPointer
+#define GLEXT_glEnableVertexAttribArray  glEnableVertexAttribArray
+#define GLEXT_glDisableVertexAttribArray glDisableVertexAttribArray
+#define GLEXT_glGetAttribLocation        glGetAttribLocation
+
+#define GLEXT_instanced_arrays_dependencies                                                      \
+    SF_GLAD_GL_VERSION_3_3, glDrawArraysInstanced, glVertexAttribDivisor, glVertexAttribPointer, \
+        glEnableVertexAttribArray, glDisableVertexAttribArray, glGetAttribLocation
+
+// Core since 4.1 - ARB_get_program_binary
+#define GLEXT_get_program_binary                 SF_GLAD_GL_ARB_get_program_binary
+#define GLEXT_glGetProgramBinary                 glGetProgramBinary
+#define GLEXT_glProgramBinary                    glProgramBinary
+#define GLEXT_glProgramParameteri                glProgramParameteri
+#define GLEXT_glGetProgramiv                     glGetProgramiv
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH           GL_PROGRAM_BINARY_LENGTH
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS      GL_NUM_PROGRAM_BINARY_FORMATS
+#define GLEXT_GL_LINK_STATUS                     GL_LINK_STATUS
+
+#define GLEXT_get_program_binary_dependencies                                                      \
+    SF_GLAD_GL_ARB_get_program_binary, glGetProgramBinary, glProgramBinary, glProgramParameteri, \
+        glGetProgramiv
+
 #endif
 
+// Compressed texture formats, available when listed in GL_COMPRESSED_TEXTURE_FORMATS
+// EXT_texture_compression_s3tc and EXT_texture_sRGB
+#define GLEXT_GL_COMPRESSED_RGB_S3TC_DXT1         0x83F0
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1        0x83F1
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5        0x83F3
+#define GLEXT_GL_COMPRESSED_SRGB_S3TC_DXT1        0x8C4C
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1  0x8C4D
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5  0x8C4F
+
+// ARB_texture_compression_bptc
+#define GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM       0x8E8C
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM 0x8E8D
+
+// ARB_ES3_compatibility and OES_compressed_ETC2
+#define GLEXT_GL_COMPRESSED_RGB8_ETC2             0x9274
+#define GLEXT_GL_COMPRESSED_SRGB8_ETC2            0x9275
+#define GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC        0x9278
+#define GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC 0x9279
+
+// KHR_parallel_shader_compile and ARB_parallel_shader_compile, available when listed in the extension string
+#define GLEXT_GL_COMPLETION_STATUS 0x91B1
+
 // OpenGL Versions
 #define GLEXT_GL_VERSION_1_0 SF_GLAD_GL_VERSION_1_0
 #define GLEXT_GL_VERSION_1_1 SF_GLAD_GL_VERSION_1_1
@@ -408,4 +564,18 @@ namespace sf::priv
 ////////////////////////////////////////////////////////////
 void ensureExtensionsInit();
 
+////////////////////////////////////////////////////////////
+/// \brief Wait for a sync object to be signaled
+///
+/// Sync objects are not supported with OpenGL ES, this
+/// function then returns `true` right away.
+///
+/// \param sync    Sync object to wait for
+/// \param timeout Maximum time to wait, in nanoseconds
+///
+/// \return `true` if the sync object is signaled, `false` if the timeout expired
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool clientWaitSync(GLsync sync, GLuint64 timeout);
+
 } // namespace sf::priv
@@ -0,0 +1,343 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/ImageRequest.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ImageRequestImpl
+{
+// Maximum number of pixel buffers kept around for future requests
+constexpr std::size_t maxFreeBuffers = 4;
+
+// Pixel buffers of completed requests, kept to avoid reallocating storage for every request
+struct BufferPool : sf::GlResource
+{
+    struct Buffer
+    {
+        GLuint      name{};
+        std::size_t capacity{};
+    };
+
+    BufferPool() = default;
+
+    ~BufferPool()
+    {
+        const TransientContextLock lock;
+
+        for (const Buffer& buffer : freeBuffers)
+            glCheck(GLEXT_glDeleteBuffers(1, &buffer.name));
+    }
+
+    BufferPool(const BufferPool&)            = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    std::mutex          mutex;
+    std::vector<Buffer> freeBuffers;
+};
+
+// Get the buffer pool, which lives as long as there are pending requests
+std::shared_ptr<BufferPool> getBufferPool()
+{
+    static std::mutex                mutex;
+    static std::weak_ptr<BufferPool> instance;
+
+    const std::lock_guard lock(mutex);
+
+    auto pool = instance.lock();
+    if (!pool)
+    {
+        pool     = std::make_shared<BufferPool>();
+        instance = pool;
+    }
+
+    return pool;
+}
+
+// Extract an image from pixels whose rows may be padded and stored from bottom to top
+sf::Image copyPixels(const std::uint8_t* pixels, sf::Vector2u size, sf::Vector2u storedSize, bool flipped)
+{
+    std::vector<std::uint8_t> result(std::size_t{size.x} * size.y * 4);
+
+    const std::size_t srcPitch = std::size_t{storedSize.x} * 4;
+    const std::size_t dstPitch = std::size_t{size.x} * 4;
+    for (unsigned int y = 0; y < size.y; ++y)
+    {
+        const unsigned int srcRow = flipped ? (size.y - 1 - y) : y;
+        std::memcpy(result.data() + y * dstPitch, pixels + srcRow * srcPitch, dstPitch);
+    }
+
+    return {size, result.data()};
+}
+} // namespace ImageRequestImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct ImageRequest::Readback : GlResource
+{
+    Readback() = default;
+
+    ~Readback()
+    {
+        if (buffer || sync)
+        {
+            const TransientContextLock lock;
+            release();
+        }
+    }
+
+    Readback(const Readback&)            = delete;
+    Readback& operator=(const Readback&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    bool wait(Time timeout)
+    {
+        const std::lock_guard lock(mutex);
+
+        if (image || !sync)
+            return true;
+
+        const TransientContextLock contextLock;
+
+        const auto nanoseconds = static_cast<GLuint64>(std::max(timeout.asMicroseconds(), std::int64_t{0})) * 1000;
+        if (!priv::clientWaitSync(sync, nanoseconds))
+            return false;
+
+        // The buffer won't be written anymore, the sync object is not needed
+        glCheck(GLEXT_glDeleteSync(sync));
+        sync = nullptr;
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    Image resolve()
+    {
+        const std::lock_guard lock(mutex);
+
+        if (image)
+            return *image;
+
+        image.emplace();
+
+#ifndef SFML_OPENGL_ES
+
+        const TransientContextLock contextLock;
+
+        if (sync)
+            glCheck(GLEXT_glClientWaitSync(sync, 0, std::numeric_limits<GLuint64>::max()));
+
+        const std::size_t bytes = std::size_t{storedSize.x} * storedSize.y * 4;
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, buffer));
+
+        const void* pixels = nullptr;
+        glCheck(pixels = GLEXT_glMapBufferRange(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                                0,
+                                                static_cast<GLsizeiptr>(bytes),
+                                                GLEXT_GL_MAP_READ_BIT));
+
+        if (pixels)
+        {
+            image = ImageRequestImpl::copyPixels(static_cast<const std::uint8_t*>(pixels), size, storedSize, flipped);
+            glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+        }
+        else
+        {
+            err() << "Failed to read back pixels, the pixel buffer could not be mapped" << std::endl;
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+        // The pixels are stored in the image now, the buffer can serve other requests
+        release();
+
+#endif // SFML_OPENGL_ES
+
+        return *image;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void release()
+    {
+        if (sync)
+        {
+            glCheck(GLEXT_glDeleteSync(sync));
+            sync = nullptr;
+        }
+
+        if (buffer)
+        {
+            const std::lock_guard lock(pool->mutex);
+            if (pool->freeBuffers.size() < ImageRequestImpl::maxFreeBuffers)
+                pool->freeBuffers.push_back({buffer, capacity});
+            else
+                glCheck(GLEXT_glDeleteBuffers(1, &buffer));
+
+            buffer = 0;
+        }
+    }
+
+    std::shared_ptr<ImageRequestImpl::BufferPool> pool;       //!< Pool where the buffer is returned when no longer needed
+    std::mutex                                    mutex;      //!< Mutex protecting the read back from concurrent accesses
+    GLuint                                        buffer{};   //!< Pixel buffer receiving the pixels
+    std::size_t                                   capacity{}; //!< Size of the storage of the pixel buffer, in bytes
+    GLsync                                        sync{};     //!< Sync object signaled when the pixels have been written
+    Vector2u                                      size;       //!< Size of the image to extract
+    Vector2u                                      storedSize; //!< Size of the pixels written to the buffer
+    bool                                          flipped{};  //!< Are the rows stored from bottom to top?
+    std::optional<Image>                          image;      //!< Resolved image
+};
+
+
+////////////////////////////////////////////////////////////
+ImageRequest::ImageRequest(Image image) : m_readback(std::make_shared<Readback>())
+{
+    m_readback->image = std::move(image);
+}
+
+
+////////////////////////////////////////////////////////////
+ImageRequest::ImageRequest(const std::uint8_t* pixels, Vector2u size, Vector2u storedSize, bool flipped) :
+ImageRequest(ImageRequestImpl::copyPixels(pixels, size, storedSize, flipped))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImageRequest::isReady() const
+{
+    return wait(Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImageRequest::wait(Time timeout) const
+{
+    return !m_readback || m_readback->wait(timeout);
+}
+
+
+////////////////////////////////////////////////////////////
+Image ImageRequest::getImage() const
+{
+    return m_readback ? m_readback->resolve() : Image();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<ImageRequest> ImageRequest::begin(Vector2u size, Vector2u storedSize, bool flipped)
+{
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    if (!GLEXT_vertex_buffer_object || !GLEXT_pixel_buffer_object || !GLEXT_map_buffer_range || !GLEXT_sync)
+        return std::nullopt;
+
+    ImageRequest request;
+    request.m_readback  = std::make_shared<Readback>();
+    Readback& readback  = *request.m_readback;
+    readback.pool       = ImageRequestImpl::getBufferPool();
+    readback.size       = size;
+    readback.storedSize = storedSize;
+    readback.flipped    = flipped;
+
+    const std::size_t bytes = std::size_t{storedSize.x} * storedSize.y * 4;
+
+    // Reuse a free buffer, preferably one which is already large enough
+    {
+        auto&                 freeBuffers = readback.pool->freeBuffers;
+        const std::lock_guard lock(readback.pool->mutex);
+
+        auto it = std::find_if(freeBuffers.begin(),
+                               freeBuffers.end(),
+                               [bytes](const ImageRequestImpl::BufferPool::Buffer& buffer)
+                               { return buffer.capacity >= bytes; });
+
+        if ((it == freeBuffers.end()) && !freeBuffers.empty())
+            it = std::prev(freeBuffers.end());
+
+        if (it != freeBuffers.end())
+        {
+            readback.buffer   = it->name;
+            readback.capacity = it->capacity;
+            freeBuffers.erase(it);
+        }
+    }
+
+    if (!readback.buffer)
+    {
+        glCheck(GLEXT_glGenBuffers(1, &readback.buffer));
+
+        if (!readback.buffer)
+            return std::nullopt;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, readback.buffer));
+
+    if (readback.capacity < bytes)
+    {
+        readback.capacity = bytes;
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                   static_cast<GLsizeiptrARB>(bytes),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_READ));
+    }
+
+    return request;
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageRequest::submit()
+{
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+    glCheck(m_readback->sync = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    // Submit the commands now, otherwise the request may never complete if it is waited for from another context
+    glCheck(glFlush());
+}
+
+} // namespace sf
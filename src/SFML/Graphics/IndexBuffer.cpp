@@ -0,0 +1,309 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+#include <utility>
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace IndexBufferImpl
+{
+GLenum usageToGlEnum(sf::IndexBuffer::Usage usage)
+{
+    switch (usage)
+    {
+        case sf::IndexBuffer::Usage::Static:
+            return GLEXT_GL_STATIC_DRAW;
+        case sf::IndexBuffer::Usage::Dynamic:
+            return GLEXT_GL_DYNAMIC_DRAW;
+        default:
+            return GLEXT_GL_STREAM_DRAW;
+    }
+}
+} // namespace IndexBufferImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+IndexBuffer::IndexBuffer(Usage usage) : m_usage(usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::IndexBuffer(const IndexBuffer& copy) : GlResource(copy), m_usage(copy.m_usage)
+{
+    if (copy.m_buffer && copy.m_size)
+    {
+        if (!create(copy.m_size))
+        {
+            err() << "Could not create index buffer for copying" << std::endl;
+            return;
+        }
+
+        if (!update(copy))
+            err() << "Could not copy index buffer" << std::endl;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::~IndexBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::create(std::size_t indexCount)
+{
+    if (!isAvailable())
+        return false;
+
+    const TransientContextLock contextLock;
+
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create index buffer, generation failed" << std::endl;
+        return false;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_buffer));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ELEMENT_ARRAY_BUFFER,
+                               static_cast<GLsizeiptrARB>(sizeof(Index) * indexCount),
+                               nullptr,
+                               IndexBufferImpl::usageToGlEnum(m_usage)));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0));
+
+    m_size = indexCount;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t IndexBuffer::getIndexCount() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::update(const Index* indices)
+{
+    return update(indices, m_size, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::update(const Index* indices, std::size_t indexCount, unsigned int offset)
+{
+    // Sanity checks
+    if (!m_buffer)
+        return false;
+
+    if (!indices)
+        return false;
+
+    if (offset && (offset + indexCount > m_size))
+        return false;
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_buffer));
+
+    // Check if we need to resize or orphan the buffer
+    if (indexCount >= m_size)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ELEMENT_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(sizeof(Index) * indexCount),
+                                   nullptr,
+                                   IndexBufferImpl::usageToGlEnum(m_usage)));
+
+        m_size = indexCount;
+    }
+
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ELEMENT_ARRAY_BUFFER,
+                                  static_cast<GLintptrARB>(sizeof(Index) * offset),
+                                  static_cast<GLsizeiptrARB>(sizeof(Index) * indexCount),
+                                  indices));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::update([[maybe_unused]] const IndexBuffer& indexBuffer)
+{
+#ifdef SFML_OPENGL_ES
+
+    return false;
+
+#else
+
+    if (!m_buffer || !indexBuffer.m_buffer)
+        return false;
+
+    const TransientContextLock contextLock;
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    if (GLEXT_copy_buffer)
+    {
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, indexBuffer.m_buffer));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, m_buffer));
+
+        glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_COPY_READ_BUFFER,
+                                          GLEXT_GL_COPY_WRITE_BUFFER,
+                                          0,
+                                          0,
+                                          static_cast<GLsizeiptr>(sizeof(Index) * indexBuffer.m_size)));
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, 0));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, 0));
+
+        return true;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_buffer));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ELEMENT_ARRAY_BUFFER,
+                               static_cast<GLsizeiptrARB>(sizeof(Index) * indexBuffer.m_size),
+                               nullptr,
+                               IndexBufferImpl::usageToGlEnum(m_usage)));
+
+    void* const destination = glCheck(GLEXT_glMapBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, GLEXT_GL_WRITE_ONLY));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, indexBuffer.m_buffer));
+
+    const void* const source = glCheck(GLEXT_glMapBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, GLEXT_GL_READ_ONLY));
+
+    std::memcpy(destination, source, sizeof(Index) * indexBuffer.m_size);
+
+    const GLboolean sourceResult = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_buffer));
+
+    const GLboolean destinationResult = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0));
+
+    return (sourceResult == GL_TRUE) && (destinationResult == GL_TRUE);
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer& IndexBuffer::operator=(const IndexBuffer& right)
+{
+    IndexBuffer temp(right);
+
+    swap(temp);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexBuffer::swap(IndexBuffer& right) noexcept
+{
+    std::swap(m_size, right.m_size);
+    std::swap(m_buffer, right.m_buffer);
+    std::swap(m_usage, right.m_usage);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int IndexBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexBuffer::setUsage(Usage usage)
+{
+    m_usage = usage;
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::Usage IndexBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexBuffer::bind(const IndexBuffer* indexBuffer)
+{
+    if (!isAvailable())
+        return;
+
+    const TransientContextLock lock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, indexBuffer ? indexBuffer->m_buffer : 0));
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::isAvailable()
+{
+    return VertexBuffer::isAvailable();
+}
+
+
+////////////////////////////////////////////////////////////
+void swap(IndexBuffer& left, IndexBuffer& right) noexcept
+{
+    left.swap(right);
+}
+
+} // namespace sf
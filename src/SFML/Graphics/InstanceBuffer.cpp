@@ -0,0 +1,311 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/InstanceBuffer.hpp>
+#include <SFML/Graphics/Shader.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+#include <utility>
+
+#include <cstdint>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace InstanceBufferImpl
+{
+// Layout of an instance in graphics memory, the attribute
+// pointers set up by sf::RenderTarget::drawInstanced must match it
+struct PackedInstance
+{
+    std::array<float, 3>        row0;        // First row of the 2D affine transform
+    std::array<float, 3>        row1;        // Second row of the 2D affine transform
+    std::array<float, 4>        textureRect; // Position and size of the texture rectangle
+    std::array<std::uint8_t, 4> color;       // Color, normalized when read by the shader
+};
+
+static_assert(sizeof(PackedInstance) == 44, "Instance layout must match the attribute pointers of drawInstanced");
+
+GLenum usageToGlEnum(sf::InstanceBuffer::Usage usage)
+{
+    switch (usage)
+    {
+        case sf::InstanceBuffer::Usage::Static:
+            return GLEXT_GL_STATIC_DRAW;
+        case sf::InstanceBuffer::Usage::Dynamic:
+            return GLEXT_GL_DYNAMIC_DRAW;
+        default:
+            return GLEXT_GL_STREAM_DRAW;
+    }
+}
+
+[[maybe_unused]] PackedInstance pack(const sf::InstanceBuffer::Instance& instance)
+{
+    const float* matrix = instance.transform.getMatrix();
+
+    return {{matrix[0], matrix[4], matrix[12]},
+            {matrix[1], matrix[5], matrix[13]},
+            {instance.textureRect.position.x,
+             instance.textureRect.position.y,
+             instance.textureRect.size.x,
+             instance.textureRect.size.y},
+            {instance.color.r, instance.color.g, instance.color.b, instance.color.a}};
+}
+} // namespace InstanceBufferImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+InstanceBuffer::InstanceBuffer(Usage usage) : m_usage(usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+InstanceBuffer::InstanceBuffer(const InstanceBuffer& copy) : GlResource(copy), m_usage(copy.m_usage)
+{
+    if (!copy.m_instances.empty() && !update(copy.m_instances.data(), copy.m_instances.size(), 0))
+        err() << "Could not copy instance buffer" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+InstanceBuffer::~InstanceBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstanceBuffer::create(std::size_t instanceCount)
+{
+    m_instances.assign(instanceCount, Instance{});
+
+    return upload(0, instanceCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t InstanceBuffer::getInstanceCount() const
+{
+    return m_instances.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstanceBuffer::update(const Instance* instances)
+{
+    return update(instances, m_instances.size(), 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstanceBuffer::update(const Instance* instances, std::size_t instanceCount, std::size_t offset)
+{
+    // Sanity checks
+    if (!instances)
+        return false;
+
+    if (offset && (offset + instanceCount > m_instances.size()))
+        return false;
+
+    // Grow the buffer if needed
+    if (instanceCount > m_instances.size())
+        m_instances.resize(instanceCount);
+
+    std::copy(instances, instances + instanceCount, m_instances.begin() + static_cast<std::ptrdiff_t>(offset));
+
+    return upload(offset, instanceCount);
+}
+
+
+////////////////////////////////////////////////////////////
+const InstanceBuffer::Instance* InstanceBuffer::getInstances() const
+{
+    return m_instances.empty() ? nullptr : m_instances.data();
+}
+
+
+////////////////////////////////////////////////////////////
+InstanceBuffer& InstanceBuffer::operator=(const InstanceBuffer& right)
+{
+    InstanceBuffer temp(right);
+
+    swap(temp);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void InstanceBuffer::swap(InstanceBuffer& right) noexcept
+{
+    std::swap(m_instances, right.m_instances);
+    std::swap(m_buffer, right.m_buffer);
+    std::swap(m_bufferSize, right.m_bufferSize);
+    std::swap(m_usage, right.m_usage);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int InstanceBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void InstanceBuffer::setUsage(Usage usage)
+{
+    m_usage = usage;
+}
+
+
+////////////////////////////////////////////////////////////
+InstanceBuffer::Usage InstanceBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstanceBuffer::isAvailable()
+{
+    static const bool available = []
+    {
+        if (!Shader::isAvailable())
+            return false;
+
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return (GLEXT_instanced_arrays != 0) && (GLEXT_map_buffer_range != 0);
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+bool InstanceBuffer::upload([[maybe_unused]] std::size_t offset, [[maybe_unused]] std::size_t instanceCount)
+{
+    // Without hardware instancing, the instances are expanded from system memory when drawn
+    if (!isAvailable())
+        return true;
+
+#ifdef SFML_OPENGL_ES
+
+    return true;
+
+#else
+
+    const TransientContextLock contextLock;
+
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create instance buffer, generation failed" << std::endl;
+        return false;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    // Reallocate the storage if the instances don't fit anymore, or if
+    // the whole buffer is replaced so that the driver can orphan it
+    if ((m_instances.size() != m_bufferSize) || ((offset == 0) && (instanceCount == m_bufferSize)))
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(sizeof(InstanceBufferImpl::PackedInstance) * m_instances.size()),
+                                   nullptr,
+                                   InstanceBufferImpl::usageToGlEnum(m_usage)));
+
+        m_bufferSize  = m_instances.size();
+        offset        = 0;
+        instanceCount = m_bufferSize;
+    }
+
+    bool result = true;
+
+    if (instanceCount > 0)
+    {
+        void* destination = nullptr;
+        glCheck(destination = GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER,
+                                                     static_cast<GLintptr>(sizeof(InstanceBufferImpl::PackedInstance) * offset),
+                                                     static_cast<GLsizeiptr>(sizeof(InstanceBufferImpl::PackedInstance) *
+                                                                             instanceCount),
+                                                     GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT));
+
+        if (destination)
+        {
+            auto* packed = static_cast<InstanceBufferImpl::PackedInstance*>(destination);
+            for (std::size_t i = 0; i < instanceCount; ++i)
+                packed[i] = InstanceBufferImpl::pack(m_instances[offset + i]);
+
+            result = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER)) == GL_TRUE;
+        }
+        else
+        {
+            result = false;
+        }
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    if (!result)
+        err() << "Could not upload instances to graphics memory" << std::endl;
+
+    return result;
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+void swap(InstanceBuffer& left, InstanceBuffer& right) noexcept
+{
+    left.swap(right);
+}
+
+} // namespace sf
@@ -0,0 +1,353 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderQueue.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <cstdint>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace RenderQueueImpl
+{
+// Get the number of vertices of a single primitive, or 0 for strips and fans which can't be merged
+std::size_t getPrimitiveSize(sf::PrimitiveType type)
+{
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+            return 1;
+        case sf::PrimitiveType::Lines:
+            return 2;
+        case sf::PrimitiveType::Triangles:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+// Build the key used to group draws within a layer: shader first, then texture, then blend mode.
+// Shaders and textures are identified by their order of first appearance rather than by their
+// address, so that the drawing order doesn't change from one run to another.
+std::array<std::uint64_t, 4> getSortKey(sf::PrimitiveType       type,
+                                        const sf::RenderStates& states,
+                                        std::uint64_t           shaderId,
+                                        std::uint64_t           textureId)
+{
+    const auto pack = [](std::uint64_t bits, auto value, int width)
+    { return (bits << width) | static_cast<std::uint64_t>(value); };
+
+    const sf::BlendMode&   blend   = states.blendMode;
+    const sf::StencilMode& stencil = states.stencilMode;
+
+    // Enumerations have less than 16 values, and stencil values are 32-bit
+    std::uint64_t modes = 0;
+    modes               = pack(modes, blend.colorSrcFactor, 4);
+    modes               = pack(modes, blend.colorDstFactor, 4);
+    modes               = pack(modes, blend.colorEquation, 4);
+    modes               = pack(modes, blend.alphaSrcFactor, 4);
+    modes               = pack(modes, blend.alphaDstFactor, 4);
+    modes               = pack(modes, blend.alphaEquation, 4);
+    modes               = pack(modes, stencil.stencilComparison, 4);
+    modes               = pack(modes, stencil.stencilUpdateOperation, 4);
+    modes               = pack(modes, stencil.stencilOnly, 4);
+    modes               = pack(modes, states.coordinateType, 4);
+    modes               = pack(modes, type, 4);
+
+    const std::uint64_t stencilValues = pack(stencil.stencilReference.value, stencil.stencilMask.value, 32);
+    return {shaderId, textureId, modes, stencilValues};
+}
+
+// Number of previous draws of the same layer checked one by one for overlaps with a draw
+constexpr std::ptrdiff_t maxRecentDraws = 256;
+
+// Check if two draws may overlap, draws of unknown bounds overlap everything
+bool mayOverlap(const std::optional<sf::FloatRect>& left, const std::optional<sf::FloatRect>& right)
+{
+    return !left || !right || left->findIntersection(*right).has_value();
+}
+
+// Get the smallest area covering two draws, unknown if any of them is unknown
+std::optional<sf::FloatRect> merge(const std::optional<sf::FloatRect>& left, const std::optional<sf::FloatRect>& right)
+{
+    if (!left || !right)
+        return std::nullopt;
+
+    const sf::Vector2f minimum(std::min(left->position.x, right->position.x),
+                               std::min(left->position.y, right->position.y));
+    const sf::Vector2f maximum(std::max(left->position.x + left->size.x, right->position.x + right->size.x),
+                               std::max(left->position.y + left->size.y, right->position.y + right->size.y));
+    return sf::FloatRect(minimum, maximum - minimum);
+}
+} // namespace RenderQueueImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void RenderQueue::submit(int layer, const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
+    // Drop incomplete trailing primitives, they wouldn't be drawn anyway
+    // and they would prevent this draw from being merged with others
+    const std::size_t primitiveSize = RenderQueueImpl::getPrimitiveSize(type);
+    if (primitiveSize > 1)
+        vertexCount -= vertexCount % primitiveSize;
+
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    Draw draw;
+    draw.layer            = layer;
+    draw.type             = type;
+    draw.states           = states;
+    draw.states.transform = Transform::Identity;
+    draw.firstVertex      = m_vertices.size();
+    draw.vertexCount      = vertexCount;
+
+    m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+    Vertex* const copy = m_vertices.data() + draw.firstVertex;
+    if (states.transform != Transform::Identity)
+        states.transform.transformPoints(copy, vertexCount);
+
+    // Compute the bounds of the transformed vertices, to know which draws they may overlap
+    Vector2f minimum = copy[0].position;
+    Vector2f maximum = copy[0].position;
+    for (std::size_t i = 1; i < vertexCount; ++i)
+    {
+        minimum.x = std::min(minimum.x, copy[i].position.x);
+        minimum.y = std::min(minimum.y, copy[i].position.y);
+        maximum.x = std::max(maximum.x, copy[i].position.x);
+        maximum.y = std::max(maximum.y, copy[i].position.y);
+    }
+
+    // Points and lines have no area but are still rasterized, make sure they overlap what they touch
+    if ((type == PrimitiveType::Points) || (type == PrimitiveType::Lines) || (type == PrimitiveType::LineStrip))
+    {
+        minimum -= Vector2f(1, 1);
+        maximum += Vector2f(1, 1);
+    }
+
+    draw.bounds = FloatRect(minimum, maximum - minimum);
+    m_draws.push_back(draw);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::submit(int layer, const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    // Nothing to draw?
+    if (vertexBuffer.getVertexCount() == 0)
+        return;
+
+    Draw draw;
+    draw.layer        = layer;
+    draw.type         = vertexBuffer.getPrimitiveType();
+    draw.states       = states;
+    draw.vertexBuffer = &vertexBuffer;
+    draw.vertexCount  = vertexBuffer.getVertexCount();
+    m_draws.push_back(draw);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::flush(RenderTarget& target)
+{
+    sort();
+
+    for (std::size_t i = 0; i < m_order.size();)
+    {
+        const Draw& draw = m_draws[m_order[i]];
+
+        if (draw.vertexBuffer)
+        {
+            target.draw(*draw.vertexBuffer, draw.firstVertex, draw.vertexCount, draw.states);
+            ++i;
+            continue;
+        }
+
+        // Find the following draws which can be drawn together with this one
+        std::size_t end = i + 1;
+        if (RenderQueueImpl::getPrimitiveSize(draw.type) > 0)
+        {
+            const SortKey& key = m_keys[m_order[i]];
+            while ((end < m_order.size()) && !m_draws[m_order[end]].vertexBuffer && (m_keys[m_order[end]] == key))
+                ++end;
+        }
+
+        if (end == i + 1)
+        {
+            target.draw(m_vertices.data() + draw.firstVertex, draw.vertexCount, draw.type, draw.states);
+        }
+        else
+        {
+            m_merged.clear();
+            for (std::size_t j = i; j < end; ++j)
+            {
+                const Draw& merged = m_draws[m_order[j]];
+                m_merged.insert(m_merged.end(),
+                                m_vertices.begin() + static_cast<std::ptrdiff_t>(merged.firstVertex),
+                                m_vertices.begin() + static_cast<std::ptrdiff_t>(merged.firstVertex + merged.vertexCount));
+            }
+
+            target.draw(m_merged.data(), m_merged.size(), draw.type, draw.states);
+        }
+
+        i = end;
+    }
+
+    clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::clear()
+{
+    m_draws.clear();
+    m_vertices.clear();
+    m_order.clear();
+    m_keys.clear();
+    m_objectIds.clear();
+    m_levels.clear();
+    m_merged.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderQueue::isEmpty() const
+{
+    return m_draws.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderQueue::getDrawCount() const
+{
+    return m_draws.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderQueue::sort()
+{
+    // Build the sort key of each draw once
+    const auto getObjectId = [this](const void* object) -> std::uint64_t
+    { return object ? m_objectIds.try_emplace(object, m_objectIds.size() + 1).first->second : 0; };
+
+    m_objectIds.clear();
+    m_keys.resize(m_draws.size());
+    for (std::size_t i = 0; i < m_draws.size(); ++i)
+    {
+        const Draw&         draw      = m_draws[i];
+        const std::uint64_t shaderId  = getObjectId(draw.states.shader);
+        const std::uint64_t textureId = getObjectId(draw.states.texture);
+        m_keys[i] = RenderQueueImpl::getSortKey(draw.type, draw.states, shaderId, textureId);
+    }
+
+    // Group the draws by layer, keeping the submission order within each layer
+    m_order.resize(m_draws.size());
+    for (std::size_t i = 0; i < m_order.size(); ++i)
+        m_order[i] = i;
+
+    std::stable_sort(m_order.begin(),
+                     m_order.end(),
+                     [this](std::size_t left, std::size_t right) { return m_draws[left].layer < m_draws[right].layer; });
+
+    m_levels.assign(m_draws.size(), 0);
+
+    for (auto layerBegin = m_order.begin(); layerBegin != m_order.end();)
+    {
+        const int  layer    = m_draws[*layerBegin].layer;
+        const auto layerEnd = std::find_if(layerBegin,
+                                           m_order.end(),
+                                           [this, layer](std::size_t index) { return m_draws[index].layer != layer; });
+
+        // Assign a level to each draw, such that sorting by (level, states) never moves
+        // a draw before an earlier draw that it overlaps: a draw is at least at the level
+        // of the draws it overlaps, and one level above if their states are different.
+        // Only the most recent draws are checked one by one; the older ones are summed up
+        // by the area they cover and their highest level, which may raise a level more
+        // than needed (and prevent some merges) but never breaks the drawing order.
+        std::optional<FloatRect> olderBounds;
+        std::size_t              olderLevel = 0;
+        bool                     hasOlder   = false;
+
+        for (auto current = layerBegin; current != layerEnd; ++current)
+        {
+            const Draw& draw        = m_draws[*current];
+            const auto  recentBegin = current - std::min(current - layerBegin, RenderQueueImpl::maxRecentDraws);
+            std::size_t level       = 0;
+
+            if (recentBegin != layerBegin)
+            {
+                // The draw leaving the window of recent draws joins the older ones
+                const Draw& older = m_draws[*(recentBegin - 1)];
+                olderBounds       = hasOlder ? RenderQueueImpl::merge(olderBounds, older.bounds) : older.bounds;
+                olderLevel        = std::max(olderLevel, m_levels[*(recentBegin - 1)]);
+                hasOlder          = true;
+            }
+
+            if (hasOlder && RenderQueueImpl::mayOverlap(draw.bounds, olderBounds))
+                level = olderLevel + 1;
+
+            for (auto previous = recentBegin; previous != current; ++previous)
+            {
+                const Draw&       other     = m_draws[*previous];
+                const std::size_t candidate = m_levels[*previous] + ((m_keys[*previous] == m_keys[*current]) ? 0 : 1);
+                if ((candidate > level) && RenderQueueImpl::mayOverlap(draw.bounds, other.bounds))
+                    level = candidate;
+            }
+
+            m_levels[*current] = level;
+        }
+
+        // Sort the draws of the layer by level, then by render states, then by submission order
+        std::sort(layerBegin,
+                  layerEnd,
+                  [this](std::size_t left, std::size_t right)
+                  {
+                      if (m_levels[left] != m_levels[right])
+                          return m_levels[left] < m_levels[right];
+
+                      if (m_keys[left] != m_keys[right])
+                          return m_keys[left] < m_keys[right];
+
+                      return left < right;
+                  });
+
+        layerBegin = layerEnd;
+    }
+}
+
+} // namespace sf
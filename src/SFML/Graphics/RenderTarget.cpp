@@ -25,13 +25,17 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/DrawList.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/InstanceBuffer.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/VertexStreamBuffer.hpp>
 
 #include <SFML/Window/Context.hpp>
 
@@ -40,6 +44,7 @@
 
 #include <algorithm>
 #include <mutex>
+#include <optional>
 #include <ostream>
 #include <unordered_map>
 
@@ -193,15 +198,143 @@ std::uint32_t stencilFunctionToGlConstant(sf::StencilComparison comparison)
     assert(false);
     return GL_ALWAYS;
 }
+
+
+// Convert an sf::PrimitiveType constant to the corresponding OpenGL constant.
+GLenum primitiveTypeToGlConstant(sf::PrimitiveType type)
+{
+    static constexpr sf::priv::EnumArray<sf::PrimitiveType, GLenum, 6> modes =
+        {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+    return modes[type];
+}
+
+
+// Get the type of primitives that draws of the given type are merged into when batching
+sf::PrimitiveType getBatchPrimitiveType(sf::PrimitiveType type)
+{
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+            return sf::PrimitiveType::Points;
+        case sf::PrimitiveType::Lines:
+        case sf::PrimitiveType::LineStrip:
+            return sf::PrimitiveType::Lines;
+        case sf::PrimitiveType::Triangles:
+        case sf::PrimitiveType::TriangleStrip:
+        case sf::PrimitiveType::TriangleFan:
+            return sf::PrimitiveType::Triangles;
+    }
+
+    assert(false);
+    return sf::PrimitiveType::Triangles;
+}
+
+
+// Append primitives to a vertex array as independent primitives of the type returned by getBatchPrimitiveType.
+// Strips and fans are unrolled, and incomplete trailing primitives are dropped so that the next ones stay aligned.
+void appendPrimitives(std::vector<sf::Vertex>& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type)
+{
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+            target.insert(target.end(), vertices, vertices + vertexCount);
+            break;
+        case sf::PrimitiveType::Lines:
+            target.insert(target.end(), vertices, vertices + vertexCount - vertexCount % 2);
+            break;
+        case sf::PrimitiveType::Triangles:
+            target.insert(target.end(), vertices, vertices + vertexCount - vertexCount % 3);
+            break;
+        case sf::PrimitiveType::LineStrip:
+            for (std::size_t i = 1; i < vertexCount; ++i)
+            {
+                target.push_back(vertices[i - 1]);
+                target.push_back(vertices[i]);
+            }
+            break;
+        case sf::PrimitiveType::TriangleStrip:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                target.push_back(vertices[i - 2]);
+                target.push_back(vertices[i - 1]);
+                target.push_back(vertices[i]);
+            }
+            break;
+        case sf::PrimitiveType::TriangleFan:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                target.push_back(vertices[0]);
+                target.push_back(vertices[i - 1]);
+                target.push_back(vertices[i]);
+            }
+            break;
+    }
+}
+
+
+// Shaders used to draw instances with hardware instancing, the instance attributes match sf::InstanceBuffer
+constexpr const char* instancingVertexShader = R"(
+#version 120
+
+attribute vec3 instanceRow0;
+attribute vec3 instanceRow1;
+attribute vec4 instanceTextureRect;
+attribute vec4 instanceColor;
+
+void main()
+{
+    vec3 position = vec3(gl_Vertex.xy, 1.0);
+    gl_Position = gl_ModelViewProjectionMatrix * vec4(dot(instanceRow0, position), dot(instanceRow1, position), 0.0, 1.0);
+
+    vec2 texCoord = instanceTextureRect.xy + gl_MultiTexCoord0.xy * instanceTextureRect.zw;
+    gl_TexCoord[0] = gl_TextureMatrix[0] * vec4(texCoord, 0.0, 1.0);
+
+    gl_FrontColor = gl_Color * instanceColor;
+}
+)";
+
+constexpr const char* instancingFragmentShader = R"(
+#version 120
+
+uniform sampler2D texture;
+uniform bool textured;
+
+void main()
+{
+    gl_FragColor = textured ? gl_Color * texture2D(texture, gl_TexCoord[0].xy) : gl_Color;
+}
+)";
+
+// Names of the instance attributes, in the order of sf::InstanceBuffer's layout
+constexpr std::array<const char*, 4> instanceAttributeNames = {"instanceRow0", "instanceRow1", "instanceTextureRect", "instanceColor"};
 } // namespace RenderTargetImpl
 } // namespace
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::~RenderTarget() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget(RenderTarget&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget& RenderTarget::operator=(RenderTarget&&) noexcept = default;
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color)
 {
+    // Pending draws must not end up on top of what is drawn after clearing
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -220,6 +353,8 @@ void RenderTarget::clear(Color color)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clearStencil(StencilValue stencilValue)
 {
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -238,6 +373,8 @@ void RenderTarget::clearStencil(StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color, StencilValue stencilValue)
 {
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -257,6 +394,9 @@ void RenderTarget::clear(Color color, StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::setView(const View& view)
 {
+    // Pending draws must be rendered with the view they were issued with
+    flush();
+
     m_view              = view;
     m_cache.viewChanged = true;
 }
@@ -354,6 +494,254 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
     if (!vertices || (vertexCount == 0))
         return;
 
+    // The texture of a render texture can be drawn to without
+    // its cache ID changing, so draws using it are never deferred
+    if (m_batch.enabled && !(states.texture && states.texture->m_fboAttachment))
+    {
+        batchVertices(vertices, vertexCount, type, states);
+        return;
+    }
+
+    flush();
+    drawVertices(vertices, vertexCount, nullptr, 0, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint16_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0) || !indices || (indexCount == 0))
+        return;
+
+    // Indexed draws are not batched, preserve the drawing order with the pending draws
+    flush();
+    drawVertices(vertices, vertexCount, indices, indexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Sanity check
+    if (firstVertex > vertexBuffer.getVertexCount())
+        return;
+
+    // Clamp vertexCount to something that makes sense
+    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
+
+    // Nothing to draw?
+    if (!vertexCount || !vertexBuffer.getNativeHandle())
+        return;
+
+    drawVertexBuffer(vertexBuffer, nullptr, firstVertex, vertexCount, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const IndexBuffer& indexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, indexBuffer, 0, indexBuffer.getIndexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
+{
+    // IndexBuffer not supported?
+    if (!IndexBuffer::isAvailable())
+    {
+        err() << "sf::IndexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Sanity check
+    if (firstIndex > indexBuffer.getIndexCount())
+        return;
+
+    // Clamp indexCount to something that makes sense
+    indexCount = std::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
+
+    // Nothing to draw?
+    if (!indexCount || !vertexBuffer.getNativeHandle() || !indexBuffer.getNativeHandle())
+        return;
+
+    drawVertexBuffer(vertexBuffer, &indexBuffer, firstIndex, indexCount, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const DrawList& drawList, const RenderStates& states)
+{
+    for (const DrawList::Command& command : drawList.m_commands)
+    {
+        RenderStates commandStates = command.states;
+        commandStates.transform    = states.transform * command.states.transform;
+
+        if (command.vertexBuffer)
+        {
+            draw(*command.vertexBuffer, command.firstVertex, command.vertexCount, commandStates);
+        }
+        else if (command.indexCount > 0)
+        {
+            draw(drawList.m_vertices.data() + command.firstVertex,
+                 command.vertexCount,
+                 drawList.m_indices.data() + command.firstIndex,
+                 command.indexCount,
+                 command.type,
+                 commandStates);
+        }
+        else
+        {
+            draw(drawList.m_vertices.data() + command.firstVertex, command.vertexCount, command.type, commandStates);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstanced(const VertexBuffer&   mesh,
+                                 const InstanceBuffer& instances,
+                                 std::size_t           instanceCount,
+                                 const RenderStates&   states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Clamp instanceCount to something that makes sense
+    instanceCount = std::min(instanceCount, instances.getInstanceCount());
+
+    // Nothing to draw?
+    if (!instanceCount || !mesh.getVertexCount() || !mesh.getNativeHandle())
+        return;
+
+    // The mesh can't be read while its vertices are being written
+    if (mesh.isMapped())
+    {
+        err() << "Failed to draw instances: the mesh vertex buffer is mapped, call unmap() first" << std::endl;
+        return;
+    }
+
+    // Preserve the drawing order with the pending draws
+    flush();
+
+    // Custom shaders can't consume the instance attributes, so they always use the fallback
+    if (!states.shader && InstanceBuffer::isAvailable() && drawInstancedHardware(mesh, instances, instanceCount, states))
+        return;
+
+    drawInstancedExpanded(mesh, instances, instanceCount, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+        flush();
+
+    m_batch.enabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isBatchingEnabled() const
+{
+    return m_batch.enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::flush()
+{
+    if (m_batch.vertices.empty())
+        return;
+
+    // Take the vertices out of the batch before drawing them, since
+    // drawing may reset the GL states which flushes the batch again
+    std::swap(m_batch.vertices, m_batch.scratch);
+
+    drawVertices(m_batch.scratch.data(), m_batch.scratch.size(), nullptr, 0, m_batch.type, m_batch.states);
+
+    m_batch.scratch.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTarget::Statistics& RenderTarget::getStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetStatistics()
+{
+    m_statistics = Statistics();
+}
+
+
+////////////////////////////////////////////////////////////
+ImageRequest RenderTarget::requestImageAsync()
+{
+    if (!setActive(true))
+    {
+        err() << "Failed to read back render target contents, failed to activate the target" << std::endl;
+        return {};
+    }
+
+    // Make sure that all the draws are part of the read back
+    flush();
+
+    // The rows of the framebuffer are stored from bottom to top
+    const Vector2u size = getSize();
+    if (std::optional<ImageRequest> request = ImageRequest::begin(size, size, true))
+    {
+        glCheck(glReadPixels(0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+        request->submit();
+        return *request;
+    }
+
+    std::vector<std::uint8_t> pixels(std::size_t{size.x} * size.y * 4);
+    glCheck(glReadPixels(0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+    return {pixels.data(), size, size, true};
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertices(const Vertex*        vertices,
+                                std::size_t          vertexCount,
+                                const std::uint16_t* indices,
+                                std::size_t          indexCount,
+                                PrimitiveType        type,
+                                const RenderStates&  states)
+{
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Check if the vertex count is low enough so that we can pre-transform them
@@ -362,13 +750,8 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
         if (useVertexCache)
         {
             // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex   = m_cache.vertexCache[i];
-                vertex.position  = states.transform * vertices[i].position;
-                vertex.color     = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
+            std::copy(vertices, vertices + vertexCount, m_cache.vertexCache.begin());
+            states.transform.transformPoints(m_cache.vertexCache.data(), vertexCount);
         }
 
         setupDraw(useVertexCache, states);
@@ -383,66 +766,87 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
                 glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
         }
 
-        // If we switch between non-cache and cache mode or enable texture
-        // coordinates we need to set up the pointers to the vertices' components
-        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
+        // If we pre-transform the vertices, we must use our internal vertex cache
+        const Vertex* source = useVertexCache ? m_cache.vertexCache.data() : vertices;
+
+        // Stream the vertices through the buffer object of the context if possible,
+        // this spares the driver a synchronous copy from client memory
+        priv::VertexStreamBuffer*        streamBuffer = priv::VertexStreamBuffer::getForActiveContext();
+        const std::optional<std::size_t> firstVertex  = streamBuffer ? streamBuffer->write(source, vertexCount)
+                                                                     : std::nullopt;
+
+        if (firstVertex)
         {
-            const auto* data = reinterpret_cast<const std::byte*>(vertices);
+            m_statistics.streamedVertexBytes += vertexCount * sizeof(Vertex);
 
-            // If we pre-transform the vertices, we must use our internal vertex cache
-            if (useVertexCache)
-                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+            // Point at the written range so that indices are relative to its first vertex
+            const std::size_t offset = *firstVertex * sizeof(Vertex);
 
-            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
-            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(offset + 0)));
+            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(offset + 8)));
             if (enableTexCoordsArray)
-                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(offset + 12)));
+
+            if (indices)
+                drawIndexedPrimitives(type, indices, indexCount);
+            else
+                drawPrimitives(type, 0, vertexCount);
+
+            // Unbind the stream buffer, client-side arrays require no buffer to be bound
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
         }
-        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
+        else
         {
-            // If we enter this block, we are already using our internal vertex cache
-            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+            // If we switch between non-cache and cache mode or enable texture
+            // coordinates we need to set up the pointers to the vertices' components
+            if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
+            {
+                const auto* data = reinterpret_cast<const std::byte*>(source);
 
-            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+                glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+                glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+                if (enableTexCoordsArray)
+                    glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+            }
+            else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
+            {
+                // If we enter this block, we are already using our internal vertex cache
+                const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+
+                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+            }
+
+            if (indices)
+                drawIndexedPrimitives(type, indices, indexCount);
+            else
+                drawPrimitives(type, 0, vertexCount);
         }
 
-        drawPrimitives(type, 0, vertexCount);
         cleanupDraw(states);
 
-        // Update the cache
-        m_cache.useVertexCache        = useVertexCache;
+        // Update the cache, the pointers don't target our vertex cache after streaming
+        m_cache.useVertexCache        = useVertexCache && !firstVertex;
         m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
     }
 }
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
-{
-    draw(vertexBuffer, 0, vertexBuffer.getVertexCount(), states);
-}
-
-
-////////////////////////////////////////////////////////////
-void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+void RenderTarget::drawVertexBuffer(const VertexBuffer& vertexBuffer,
+                                    const IndexBuffer*  indexBuffer,
+                                    std::size_t         first,
+                                    std::size_t         count,
+                                    const RenderStates& states)
 {
-    // VertexBuffer not supported?
-    if (!VertexBuffer::isAvailable())
+    // The buffer can't be read while its vertices are being written
+    if (vertexBuffer.isMapped())
     {
-        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        err() << "Failed to draw vertex buffer: it is mapped, call unmap() first" << std::endl;
         return;
     }
 
-    // Sanity check
-    if (firstVertex > vertexBuffer.getVertexCount())
-        return;
-
-    // Clamp vertexCount to something that makes sense
-    vertexCount = std::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
-
-    // Nothing to draw?
-    if (!vertexCount || !vertexBuffer.getNativeHandle())
-        return;
+    // Preserve the drawing order with the pending draws
+    flush();
 
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
@@ -459,7 +863,21 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
         glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
         glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
 
-        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+        if (indexBuffer)
+        {
+            // The indices are read from the bound index buffer, starting at the given byte offset
+            IndexBuffer::bind(indexBuffer);
+
+            drawIndexedPrimitives(vertexBuffer.getPrimitiveType(),
+                                  reinterpret_cast<const void*>(first * sizeof(IndexBuffer::Index)),
+                                  count);
+
+            IndexBuffer::bind(nullptr);
+        }
+        else
+        {
+            drawPrimitives(vertexBuffer.getPrimitiveType(), first, count);
+        }
 
         // Unbind vertex buffer
         VertexBuffer::bind(nullptr);
@@ -473,6 +891,217 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
 }
 
 
+////////////////////////////////////////////////////////////
+bool RenderTarget::drawInstancedHardware(const VertexBuffer&   mesh,
+                                         const InstanceBuffer& instances,
+                                         std::size_t           instanceCount,
+                                         const RenderStates&   states)
+{
+    if (!instances.getNativeHandle() || m_instancing.shaderFailed)
+        return false;
+
+    if (!(RenderTargetImpl::isActive(m_id) || setActive(true)))
+        return true;
+
+    // Create the shader on first use
+    if (!m_instancing.shader)
+    {
+        m_instancing.shader = std::make_unique<Shader>();
+
+        if (!m_instancing.shader->loadFromMemory(RenderTargetImpl::instancingVertexShader,
+                                                 RenderTargetImpl::instancingFragmentShader))
+        {
+            err() << "Failed to create the instancing shader, falling back to CPU expansion" << std::endl;
+            m_instancing.shader.reset();
+            m_instancing.shaderFailed = true;
+            return false;
+        }
+
+        m_instancing.shader->setUniform("texture", Shader::CurrentTexture);
+
+        for (std::size_t i = 0; i < m_instancing.attributeLocations.size(); ++i)
+        {
+            m_instancing.attributeLocations[i] = glCheck(GLEXT_glGetAttribLocation(m_instancing.shader->getNativeHandle(),
+                                                                                   RenderTargetImpl::instanceAttributeNames[i]));
+        }
+    }
+
+    m_instancing.shader->setUniform("textured", states.texture != nullptr);
+
+    RenderStates instancedStates = states;
+    instancedStates.shader       = m_instancing.shader.get();
+
+    setupDraw(false, instancedStates);
+
+    // Bind the mesh
+    VertexBuffer::bind(&mesh);
+
+    // Always enable texture coordinates
+    if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+        glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+    glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+    glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+    glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+
+    // Bind the instance attributes, which advance once per instance
+    // Layout: 2 transform rows (3 floats each), texture rect (4 floats), color (4 bytes)
+    static constexpr std::array<GLint, 4>       sizes   = {3, 3, 4, 4};
+    static constexpr std::array<GLenum, 4>      types   = {GL_FLOAT, GL_FLOAT, GL_FLOAT, GL_UNSIGNED_BYTE};
+    static constexpr std::array<std::size_t, 4> offsets = {0, 12, 24, 40};
+    static constexpr GLsizei                    stride  = 44;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, instances.getNativeHandle()));
+
+    for (std::size_t i = 0; i < m_instancing.attributeLocations.size(); ++i)
+    {
+        const int location = m_instancing.attributeLocations[i];
+        if (location < 0)
+            continue;
+
+        const auto index = static_cast<GLuint>(location);
+        glCheck(GLEXT_glEnableVertexAttribArray(index));
+        glCheck(GLEXT_glVertexAttribPointer(index,
+                                            sizes[i],
+                                            types[i],
+                                            types[i] == GL_UNSIGNED_BYTE ? GL_TRUE : GL_FALSE,
+                                            stride,
+                                            reinterpret_cast<const void*>(offsets[i])));
+        glCheck(GLEXT_glVertexAttribDivisor(index, 1));
+    }
+
+    glCheck(GLEXT_glDrawArraysInstanced(RenderTargetImpl::primitiveTypeToGlConstant(mesh.getPrimitiveType()),
+                                        0,
+                                        static_cast<GLsizei>(mesh.getVertexCount()),
+                                        static_cast<GLsizei>(instanceCount)));
+
+    ++m_statistics.drawCalls;
+    m_statistics.vertices += mesh.getVertexCount() * instanceCount;
+
+    // Restore the attribute state expected by other draws
+    for (const int location : m_instancing.attributeLocations)
+    {
+        if (location < 0)
+            continue;
+
+        const auto index = static_cast<GLuint>(location);
+        glCheck(GLEXT_glVertexAttribDivisor(index, 0));
+        glCheck(GLEXT_glDisableVertexAttribArray(index));
+    }
+
+    // Unbind the buffers
+    VertexBuffer::bind(nullptr);
+
+    cleanupDraw(instancedStates);
+
+    // Update the cache
+    m_cache.useVertexCache        = false;
+    m_cache.texCoordsArrayEnabled = true;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstancedExpanded([[maybe_unused]] const VertexBuffer&   mesh,
+                                         [[maybe_unused]] const InstanceBuffer& instances,
+                                         [[maybe_unused]] std::size_t           instanceCount,
+                                         [[maybe_unused]] const RenderStates&   states)
+{
+#ifdef SFML_OPENGL_ES
+
+    err() << "Instanced drawing without hardware instancing is not supported on OpenGL ES, drawing skipped"
+          << std::endl;
+
+#else
+
+    if (!(RenderTargetImpl::isActive(m_id) || setActive(true)))
+        return;
+
+    // Read the mesh back from graphics memory
+    m_instancing.mesh.resize(mesh.getVertexCount());
+
+    VertexBuffer::bind(&mesh);
+    glCheck(GLEXT_glGetBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                     0,
+                                     static_cast<GLsizeiptrARB>(sizeof(Vertex) * m_instancing.mesh.size()),
+                                     m_instancing.mesh.data()));
+    VertexBuffer::bind(nullptr);
+
+    // Unroll the mesh once, then copy it for every instance
+    std::vector<Vertex>& vertices = m_instancing.vertices;
+    vertices.clear();
+    RenderTargetImpl::appendPrimitives(vertices, m_instancing.mesh.data(), m_instancing.mesh.size(), mesh.getPrimitiveType());
+
+    const std::size_t meshSize = vertices.size();
+    if (meshSize == 0)
+        return;
+
+    vertices.resize(meshSize * instanceCount);
+
+    const InstanceBuffer::Instance* instance = instances.getInstances();
+    for (std::size_t i = instanceCount; i-- > 0;)
+    {
+        Vertex* const copy = vertices.data() + i * meshSize;
+        if (i > 0)
+            std::copy(vertices.data(), vertices.data() + meshSize, copy);
+
+        instance[i].transform.transformPoints(copy, meshSize);
+
+        for (std::size_t j = 0; j < meshSize; ++j)
+        {
+            copy[j].color *= instance[i].color;
+            copy[j].texCoords = instance[i].textureRect.position +
+                                copy[j].texCoords.componentWiseMul(instance[i].textureRect.size);
+        }
+    }
+
+    drawVertices(vertices.data(),
+                 vertices.size(),
+                 nullptr,
+                 0,
+                 RenderTargetImpl::getBatchPrimitiveType(mesh.getPrimitiveType()),
+                 states);
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::batchVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
+    const PrimitiveType batchType = RenderTargetImpl::getBatchPrimitiveType(type);
+    const std::uint64_t textureId = states.texture ? states.texture->m_cacheId : 0;
+
+    // Submit the pending draws if the new primitives can't be merged with them
+    if (!m_batch.vertices.empty() &&
+        ((batchType != m_batch.type) || (states.texture != m_batch.states.texture) || (textureId != m_batch.textureId) ||
+         (states.coordinateType != m_batch.states.coordinateType) || (states.shader != m_batch.states.shader) ||
+         (states.blendMode != m_batch.states.blendMode) || (states.stencilMode != m_batch.states.stencilMode)))
+        flush();
+
+    // Append the vertices as independent primitives, pre-transformed
+    // since draws with different transforms share the batch
+    const std::size_t first = m_batch.vertices.size();
+    RenderTargetImpl::appendPrimitives(m_batch.vertices, vertices, vertexCount, type);
+
+    const std::size_t count = m_batch.vertices.size() - first;
+    if (count > 0)
+    {
+        // Start a new batch with the render states of this draw
+        if (first == 0)
+        {
+            m_batch.type             = batchType;
+            m_batch.states           = states;
+            m_batch.states.transform = Transform::Identity;
+            m_batch.textureId        = textureId;
+        }
+
+        states.transform.transformPoints(m_batch.vertices.data() + first, count);
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTarget::isSrgb() const
 {
@@ -524,6 +1153,8 @@ bool RenderTarget::setActive(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTarget::pushGLStates()
 {
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
 #ifdef SFML_DEBUG
@@ -555,6 +1186,8 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         glCheck(glMatrixMode(GL_PROJECTION));
@@ -574,6 +1207,8 @@ void RenderTarget::popGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::resetGLStates()
 {
+    flush();
+
     // Check here to make sure a context change does not happen after activate(true)
     const bool shaderAvailable       = Shader::isAvailable();
     const bool vertexBufferAvailable = VertexBuffer::isAvailable();
@@ -618,6 +1253,8 @@ void RenderTarget::resetGLStates()
         m_cache.stencilEnabled = false;
         m_cache.glStatesSet    = true;
 
+        ++m_statistics.glStateResets;
+
         // Apply the default SFML states
         applyBlendMode(BlendAlpha);
         applyStencilMode(StencilMode());
@@ -694,6 +1331,8 @@ void RenderTarget::applyCurrentView()
     glCheck(glMatrixMode(GL_MODELVIEW));
 
     m_cache.viewChanged = false;
+
+    ++m_statistics.viewApplications;
 }
 
 
@@ -747,6 +1386,8 @@ void RenderTarget::applyBlendMode(const BlendMode& mode)
     }
 
     m_cache.lastBlendMode = mode;
+
+    ++m_statistics.blendModeChanges;
 }
 
 
@@ -784,6 +1425,8 @@ void RenderTarget::applyStencilMode(const StencilMode& mode)
     }
 
     m_cache.lastStencilMode = mode;
+
+    ++m_statistics.stencilModeChanges;
 }
 
 
@@ -847,6 +1490,8 @@ void RenderTarget::applyTexture(const Texture* texture, CoordinateType coordinat
 
     m_cache.lastTextureId      = texture ? texture->m_cacheId : 0;
     m_cache.lastCoordinateType = coordinateType;
+
+    ++m_statistics.textureBinds;
 }
 
 
@@ -854,6 +1499,8 @@ void RenderTarget::applyTexture(const Texture* texture, CoordinateType coordinat
 void RenderTarget::applyShader(const Shader* shader)
 {
     Shader::bind(shader);
+
+    ++m_statistics.shaderBinds;
 }
 
 
@@ -889,17 +1536,26 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
         applyTransform(states.transform);
     }
 
+    // Count the states that don't have to be applied thanks to the cache
+    const auto countCacheLookup = [this](bool miss) { ++(miss ? m_statistics.cacheMisses : m_statistics.cacheHits); };
+
     // Apply the view
-    if (!m_cache.enable || m_cache.viewChanged)
+    const bool viewMiss = !m_cache.enable || m_cache.viewChanged;
+    if (viewMiss)
         applyCurrentView();
+    countCacheLookup(viewMiss);
 
     // Apply the blend mode
-    if (!m_cache.enable || (states.blendMode != m_cache.lastBlendMode))
+    const bool blendModeMiss = !m_cache.enable || (states.blendMode != m_cache.lastBlendMode);
+    if (blendModeMiss)
         applyBlendMode(states.blendMode);
+    countCacheLookup(blendModeMiss);
 
     // Apply the stencil mode
-    if (!m_cache.enable || (states.stencilMode != m_cache.lastStencilMode))
+    const bool stencilModeMiss = !m_cache.enable || (states.stencilMode != m_cache.lastStencilMode);
+    if (stencilModeMiss)
         applyStencilMode(states.stencilMode);
+    countCacheLookup(stencilModeMiss);
 
     // Mask the color buffer off if necessary
     if (states.stencilMode.stencilOnly)
@@ -915,12 +1571,16 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
         // RenderTextureImplFBO which can be quite costly
         // See: https://www.khronos.org/opengl/wiki/Memory_Model
         applyTexture(states.texture, states.coordinateType);
+        countCacheLookup(true);
     }
     else
     {
-        const std::uint64_t textureId = states.texture ? states.texture->m_cacheId : 0;
-        if (textureId != m_cache.lastTextureId || states.coordinateType != m_cache.lastCoordinateType)
+        const std::uint64_t textureId   = states.texture ? states.texture->m_cacheId : 0;
+        const bool          textureMiss = textureId != m_cache.lastTextureId ||
+                                 states.coordinateType != m_cache.lastCoordinateType;
+        if (textureMiss)
             applyTexture(states.texture, states.coordinateType);
+        countCacheLookup(textureMiss);
     }
 
     // Apply the shader
@@ -933,12 +1593,27 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
     // Find the OpenGL primitive type
-    static constexpr priv::EnumArray<PrimitiveType, GLenum, 6> modes =
-        {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    const GLenum mode = modes[type];
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(type);
 
     // Draw the primitives
     glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+
+    ++m_statistics.drawCalls;
+    m_statistics.vertices += vertexCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedPrimitives(PrimitiveType type, const void* indices, std::size_t indexCount)
+{
+    // Find the OpenGL primitive type
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(type);
+
+    // Draw the primitives
+    glCheck(glDrawElements(mode, static_cast<GLsizei>(indexCount), GL_UNSIGNED_SHORT, indices));
+
+    ++m_statistics.drawCalls;
+    m_statistics.vertices += indexCount;
 }
 
 
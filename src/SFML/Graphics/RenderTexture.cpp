@@ -210,6 +210,9 @@ void RenderTexture::display()
         }
     }
 
+    // Submit the pending draws before the texture contents are updated
+    flush();
+
     if (priv::RenderTextureImplFBO::isAvailable())
     {
         // Perform a RenderTarget-only activation if we are using FBOs
@@ -125,4 +125,11 @@ void RenderWindow::onResize()
     setView(getView());
 }
 
+
+////////////////////////////////////////////////////////////
+void RenderWindow::onDisplay()
+{
+    flush();
+}
+
 } // namespace sf
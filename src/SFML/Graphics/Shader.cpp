@@ -29,8 +29,11 @@
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/ShaderRequest.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
 
+#include <SFML/Window/Context.hpp>
 #include <SFML/Window/GlResource.hpp>
 
 #include <SFML/System/Err.hpp>
@@ -40,10 +43,16 @@
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
+#include <optional>
 #include <ostream>
+#include <sstream>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -65,6 +74,15 @@
 
 namespace
 {
+// Thread-safe unique identifier generator, used to tell
+// the uniform handles of the current program from stale ones
+std::uint64_t getUniqueProgramGeneration() noexcept
+{
+    static std::atomic<std::uint64_t> generation(1); // start at 1, zero is "no program"
+
+    return generation.fetch_add(1);
+}
+
 // Retrieve the maximum number of texture units available
 std::size_t getMaxTextureUnits()
 {
@@ -182,6 +200,231 @@ std::string formatDebugPathInfo(const std::filesystem::path& path)
     }
     return result;
 }
+
+// Shared state of the program binary cache
+struct ProgramCache
+{
+    std::mutex                         mutex;
+    std::filesystem::path              directory;
+    sf::Shader::ProgramCacheStatistics statistics;
+};
+
+ProgramCache& getProgramCache()
+{
+    static ProgramCache cache;
+    return cache;
+}
+
+// Identify a program binary cache entry
+struct ProgramCacheKey
+{
+    std::filesystem::path path;   // Location of the entry
+    std::uint64_t         hash{}; // Hash of the sources and of the driver identity
+    std::string           driver; // Vendor, renderer and version of the driver that produced the binary
+};
+
+// Magic number and version written at the start of every cache entry
+constexpr std::array<char, 8> programCacheMagic   = {'S', 'F', 'P', 'R', 'O', 'G', 'B', 'N'};
+constexpr std::uint32_t       programCacheVersion = 1;
+
+// Hash a string into an existing 64-bit FNV-1a hash
+std::uint64_t hashString(std::uint64_t hash, std::string_view data)
+{
+    for (const char c : data)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3u;
+    }
+
+    return hash;
+}
+
+// Check whether the driver can give back linked programs as binaries
+bool isProgramBinaryAvailable()
+{
+    static const bool available = []
+    {
+        if (!GLEXT_get_program_binary)
+            return false;
+
+        GLint formats = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &formats));
+        return formats > 0;
+    }();
+
+    return available;
+}
+
+// Build the cache key of a program, if the cache is enabled and supported
+std::optional<ProgramCacheKey> makeProgramCacheKey(std::string_view vertexShaderCode,
+                                                   std::string_view geometryShaderCode,
+                                                   std::string_view fragmentShaderCode)
+{
+    std::filesystem::path directory;
+    {
+        ProgramCache&         cache = getProgramCache();
+        const std::lock_guard lock(cache.mutex);
+        directory = cache.directory;
+    }
+
+    if (directory.empty() || !isProgramBinaryAvailable())
+        return std::nullopt;
+
+    const auto getString = [](GLenum name)
+    {
+        const auto* string = glCheck(glGetString(name));
+        return std::string(string ? reinterpret_cast<const char*>(string) : "");
+    };
+
+    ProgramCacheKey key;
+    key.driver = getString(GL_VENDOR) + '\n' + getString(GL_RENDERER) + '\n' + getString(GL_VERSION);
+
+    // Prefix every source with its length so that moving code from one stage to another changes the hash
+    std::uint64_t hash = 0xcbf29ce484222325u;
+    for (const std::string_view code : {vertexShaderCode, geometryShaderCode, fragmentShaderCode})
+    {
+        hash = hashString(hash, std::to_string(code.size()) + ':');
+        hash = hashString(hash, code);
+    }
+    key.hash = hashString(hash, key.driver);
+
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << key.hash << ".bin";
+    key.path = directory / name.str();
+
+    return key;
+}
+
+// Update the statistics of the program binary cache
+void countProgramCacheLookup(bool hit, bool invalidated)
+{
+    ProgramCache&         cache = getProgramCache();
+    const std::lock_guard lock(cache.mutex);
+    ++(hit ? cache.statistics.hits : cache.statistics.misses);
+    if (invalidated)
+        ++cache.statistics.invalidations;
+}
+
+// Create a program from its cached binary, returns a null handle if there is no valid entry
+GLEXT_GLhandle loadCachedProgram(const ProgramCacheKey& key)
+{
+    auto file = std::ifstream(key.path, std::ios_base::binary);
+    if (!file)
+    {
+        countProgramCacheLookup(false, false);
+        return {};
+    }
+
+    const auto read = [&file](auto& value)
+    { return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(value))); };
+
+    std::array<char, 8> magic{};
+    std::uint32_t       version      = 0;
+    std::uint64_t       hash         = 0;
+    std::uint32_t       driverLength = 0;
+    std::string         driver;
+    std::uint32_t       binaryFormat = 0;
+    std::uint32_t       binaryLength = 0;
+    std::vector<char>   binary;
+
+    bool valid = read(magic) && (magic == programCacheMagic) && read(version) && (version == programCacheVersion) &&
+                 read(hash) && (hash == key.hash) && read(driverLength) && (driverLength == key.driver.size());
+    if (valid)
+    {
+        driver.resize(driverLength);
+        valid = file.read(driver.data(), static_cast<std::streamsize>(driverLength)) && (driver == key.driver) &&
+                read(binaryFormat) && read(binaryLength) && (binaryLength > 0);
+    }
+    if (valid)
+    {
+        binary.resize(binaryLength);
+        valid = static_cast<bool>(file.read(binary.data(), static_cast<std::streamsize>(binaryLength)));
+    }
+
+    GLEXT_GLhandle program{};
+    if (valid)
+    {
+        // The driver may still refuse the binary, for instance after an update which didn't change its version string
+        program = glCheck(GLEXT_glCreateProgramObject());
+        glCheck(GLEXT_glProgramBinary(castFromGlHandle(program),
+                                      static_cast<GLenum>(binaryFormat),
+                                      binary.data(),
+                                      static_cast<GLsizei>(binaryLength)));
+
+        GLint success = GL_FALSE;
+        glCheck(GLEXT_glGetProgramiv(castFromGlHandle(program), GLEXT_GL_LINK_STATUS, &success));
+        if (success == GL_FALSE)
+        {
+            glCheck(GLEXT_glDeleteObject(program));
+            program = {};
+        }
+    }
+
+    // Discard the entry if it can't be used, it will be replaced by the recompiled program
+    if (!program)
+    {
+        file.close();
+        std::error_code error;
+        std::filesystem::remove(key.path, error);
+    }
+
+    countProgramCacheLookup(program != GLEXT_GLhandle{}, !program);
+    return program;
+}
+
+// Write the binary of a linked program to the cache
+void storeCachedProgram(const ProgramCacheKey& key, GLEXT_GLhandle program)
+{
+    GLint length = 0;
+    glCheck(GLEXT_glGetProgramiv(castFromGlHandle(program), GLEXT_GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length <= 0)
+        return;
+
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum            binaryFormat = 0;
+    glCheck(GLEXT_glGetProgramBinary(castFromGlHandle(program), length, &length, &binaryFormat, binary.data()));
+    if (length <= 0)
+        return;
+
+    std::error_code error;
+    std::filesystem::create_directories(key.path.parent_path(), error);
+    if (error)
+    {
+        sf::err() << "Failed to create shader program cache directory: " << error.message()
+                  << "\nPath: " << key.path.parent_path().string() << std::endl;
+        return;
+    }
+
+    const auto write = [](std::ofstream& file, const auto& value)
+    { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+    // Write to a temporary file first so that a concurrent reader never sees a partial entry
+    std::filesystem::path temporaryPath = key.path;
+    temporaryPath += ".tmp";
+    {
+        auto file = std::ofstream(temporaryPath, std::ios_base::binary | std::ios_base::trunc);
+        write(file, programCacheMagic);
+        write(file, programCacheVersion);
+        write(file, key.hash);
+        write(file, static_cast<std::uint32_t>(key.driver.size()));
+        file.write(key.driver.data(), static_cast<std::streamsize>(key.driver.size()));
+        write(file, static_cast<std::uint32_t>(binaryFormat));
+        write(file, static_cast<std::uint32_t>(length));
+        file.write(binary.data(), static_cast<std::streamsize>(length));
+
+        if (!file.flush())
+        {
+            sf::err() << "Failed to write shader program cache entry\nPath: " << temporaryPath.string() << std::endl;
+            file.close();
+            std::filesystem::remove(temporaryPath, error);
+            return;
+        }
+    }
+
+    std::filesystem::rename(temporaryPath, key.path, error);
+    if (error)
+        std::filesystem::remove(temporaryPath, error);
+}
 } // namespace
 
 
@@ -194,9 +437,9 @@ struct Shader::UniformBinder
     /// \brief Constructor: set up state before uniform is set
     ///
     ////////////////////////////////////////////////////////////
-    UniformBinder(Shader& shader, const std::string& name) : currentProgram(castToGlHandle(shader.m_shaderProgram))
+    UniformBinder(const Shader& shader, UniformHandle uniform) : currentProgram(castToGlHandle(shader.m_shaderProgram))
     {
-        if (currentProgram)
+        if (shader.checkUniform(uniform))
         {
             // Enable program object
             savedProgram = glCheck(GLEXT_glGetHandle(GLEXT_GL_PROGRAM_OBJECT));
@@ -204,7 +447,7 @@ struct Shader::UniformBinder
                 glCheck(GLEXT_glUseProgramObject(currentProgram));
 
             // Store uniform location for further use outside constructor
-            location = shader.getUniformLocation(name);
+            location = uniform.m_location;
         }
     }
 
@@ -238,6 +481,60 @@ struct Shader::UniformBinder
 };
 
 
+////////////////////////////////////////////////////////////
+enum class Shader::UniformType : unsigned char
+{
+    Float1,
+    Float2,
+    Float3,
+    Float4,
+    Int1,
+    Int2,
+    Int3,
+    Int4,
+    Mat3,
+    Mat4
+};
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool Shader::stageUniform(UniformHandle uniform, UniformType type, std::size_t count, const T* values, std::size_t size)
+{
+    if (!m_deferredUniforms)
+        return false;
+
+    if (!checkUniform(uniform))
+        return true;
+
+    StagedUniform& staged     = m_stagedUniforms[uniform.m_location];
+    auto&          components = [&staged]() -> std::vector<T>&
+    {
+        if constexpr (std::is_same_v<T, float>)
+            return staged.floats;
+        else
+            return staged.ints;
+    }();
+
+    // Skip the update if the uniform already holds this value
+    if ((staged.type == type) && (staged.count == count) &&
+        std::equal(values, values + size, components.begin(), components.end()))
+        return true;
+
+    staged.type  = type;
+    staged.count = count;
+    components.assign(values, values + size);
+
+    if (!staged.dirty)
+    {
+        staged.dirty = true;
+        m_dirtyUniforms.push_back(uniform.m_location);
+    }
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 Shader::Shader(const std::filesystem::path& filename, Type type)
 {
@@ -325,9 +622,14 @@ Shader::~Shader()
 ////////////////////////////////////////////////////////////
 Shader::Shader(Shader&& source) noexcept :
 m_shaderProgram(std::exchange(source.m_shaderProgram, 0u)),
+m_programGeneration(std::exchange(source.m_programGeneration, 0u)),
 m_currentTexture(std::exchange(source.m_currentTexture, -1)),
 m_textures(std::move(source.m_textures)),
-m_uniforms(std::move(source.m_uniforms))
+m_uniforms(std::move(source.m_uniforms)),
+m_uniformBlocks(std::move(source.m_uniformBlocks)),
+m_deferredUniforms(source.m_deferredUniforms),
+m_stagedUniforms(std::move(source.m_stagedUniforms)),
+m_dirtyUniforms(std::move(source.m_dirtyUniforms))
 {
 }
 
@@ -348,10 +650,15 @@ Shader& Shader::operator=(Shader&& right) noexcept
     }
 
     // Move the contents of right.
-    m_shaderProgram  = std::exchange(right.m_shaderProgram, 0u);
-    m_currentTexture = std::exchange(right.m_currentTexture, -1);
-    m_textures       = std::move(right.m_textures);
-    m_uniforms       = std::move(right.m_uniforms);
+    m_shaderProgram     = std::exchange(right.m_shaderProgram, 0u);
+    m_programGeneration = std::exchange(right.m_programGeneration, 0u);
+    m_currentTexture    = std::exchange(right.m_currentTexture, -1);
+    m_textures          = std::move(right.m_textures);
+    m_uniforms          = std::move(right.m_uniforms);
+    m_uniformBlocks     = std::move(right.m_uniformBlocks);
+    m_deferredUniforms  = right.m_deferredUniforms;
+    m_stagedUniforms    = std::move(right.m_stagedUniforms);
+    m_dirtyUniforms     = std::move(right.m_dirtyUniforms);
     return *this;
 }
 
@@ -544,75 +851,152 @@ bool Shader::loadFromStream(InputStream& vertexShaderStream, InputStream& geomet
 }
 
 
+////////////////////////////////////////////////////////////
+ShaderRequest Shader::loadFromFileAsync(const std::filesystem::path& vertexShaderFilename,
+                                        const std::filesystem::path& fragmentShaderFilename)
+{
+    // Read the vertex shader file
+    std::vector<char> vertexShader;
+    if (!getFileContents(vertexShaderFilename, vertexShader))
+    {
+        err() << "Failed to open vertex shader file\n" << formatDebugPathInfo(vertexShaderFilename) << std::endl;
+        return {};
+    }
+
+    // Read the fragment shader file
+    std::vector<char> fragmentShader;
+    if (!getFileContents(fragmentShaderFilename, fragmentShader))
+    {
+        err() << "Failed to open fragment shader file\n" << formatDebugPathInfo(fragmentShaderFilename) << std::endl;
+        return {};
+    }
+
+    // Start compiling the shader program
+    return ShaderRequest::start(vertexShader.data(), {}, fragmentShader.data());
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderRequest Shader::loadFromFileAsync(const std::filesystem::path& vertexShaderFilename,
+                                        const std::filesystem::path& geometryShaderFilename,
+                                        const std::filesystem::path& fragmentShaderFilename)
+{
+    // Read the vertex shader file
+    std::vector<char> vertexShader;
+    if (!getFileContents(vertexShaderFilename, vertexShader))
+    {
+        err() << "Failed to open vertex shader file\n" << formatDebugPathInfo(vertexShaderFilename) << std::endl;
+        return {};
+    }
+
+    // Read the geometry shader file
+    std::vector<char> geometryShader;
+    if (!getFileContents(geometryShaderFilename, geometryShader))
+    {
+        err() << "Failed to open geometry shader file\n" << formatDebugPathInfo(geometryShaderFilename) << std::endl;
+        return {};
+    }
+
+    // Read the fragment shader file
+    std::vector<char> fragmentShader;
+    if (!getFileContents(fragmentShaderFilename, fragmentShader))
+    {
+        err() << "Failed to open fragment shader file\n" << formatDebugPathInfo(fragmentShaderFilename) << std::endl;
+        return {};
+    }
+
+    // Start compiling the shader program
+    return ShaderRequest::start(vertexShader.data(), geometryShader.data(), fragmentShader.data());
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderRequest Shader::loadFromMemoryAsync(std::string_view vertexShader, std::string_view fragmentShader)
+{
+    // Start compiling the shader program
+    return ShaderRequest::start(vertexShader, {}, fragmentShader);
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderRequest Shader::loadFromMemoryAsync(std::string_view vertexShader,
+                                          std::string_view geometryShader,
+                                          std::string_view fragmentShader)
+{
+    // Start compiling the shader program
+    return ShaderRequest::start(vertexShader, geometryShader, fragmentShader);
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::getUniformHandle(std::string_view name)
+{
+    const TransientContextLock lock;
+    return findUniform(std::string(name));
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, float x)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1f(binder.location, x));
+    const TransientContextLock lock;
+    setUniform(findUniform(name), x);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, Glsl::Vec2 v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2f(binder.location, v.x, v.y));
+    const TransientContextLock lock;
+    setUniform(findUniform(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Vec3& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3f(binder.location, v.x, v.y, v.z));
+    const TransientContextLock lock;
+    setUniform(findUniform(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Vec4& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4f(binder.location, v.x, v.y, v.z, v.w));
+    const TransientContextLock lock;
+    setUniform(findUniform(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, int x)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1i(binder.location, x));
+    const TransientContextLock lock;
+    setUniform(findUniform(name), x);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, Glsl::Ivec2 v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2i(binder.location, v.x, v.y));
+    const TransientContextLock lock;
+    setUniform(findUniform(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Ivec3& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3i(binder.location, v.x, v.y, v.z));
+    const TransientContextLock lock;
+    setUniform(findUniform(name), v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Ivec4& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4i(binder.location, v.x, v.y, v.z, v.w));
+    const TransientContextLock lock;
+    setUniform(findUniform(name), v);
 }
 
 
@@ -647,143 +1031,462 @@ void Shader::setUniform(const std::string& name, const Glsl::Bvec4& v)
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Mat3& matrix)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix3fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+    const TransientContextLock lock;
+    setUniform(findUniform(name), matrix);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Mat4& matrix)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix4fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+    const TransientContextLock lock;
+    setUniform(findUniform(name), matrix);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Texture& texture)
 {
-    if (!m_shaderProgram)
-        return;
-
     const TransientContextLock lock;
-
-    // Find the location of the variable in the shader
-    const int location = getUniformLocation(name);
-    if (location != -1)
-    {
-        // Store the location -> texture mapping
-        const auto it = m_textures.find(location);
-        if (it == m_textures.end())
-        {
-            // New entry, make sure there are enough texture units
-            if (m_textures.size() + 1 >= getMaxTextureUnits())
-            {
-                err() << "Impossible to use texture " << std::quoted(name)
-                      << " for shader: all available texture units are used" << std::endl;
-                return;
-            }
-
-            m_textures[location] = &texture;
-        }
-        else
-        {
-            // Location already used, just replace the texture
-            it->second = &texture;
-        }
-    }
+    setUniform(findUniform(name), texture);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, CurrentTextureType)
 {
-    if (!m_shaderProgram)
-        return;
-
     const TransientContextLock lock;
-
-    // Find the location of the variable in the shader
-    m_currentTexture = getUniformLocation(name);
+    setUniform(findUniform(name), CurrentTexture);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const float* scalarArray, std::size_t length)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1fv(binder.location, static_cast<GLsizei>(length), scalarArray));
+    const TransientContextLock lock;
+    setUniformArray(findUniform(name), scalarArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec2* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    const TransientContextLock lock;
+    setUniformArray(findUniform(name), vectorArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec3* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    const TransientContextLock lock;
+    setUniformArray(findUniform(name), vectorArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec4* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    const TransientContextLock lock;
+    setUniformArray(findUniform(name), vectorArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Mat3* matrixArray, std::size_t length)
 {
-    static const std::size_t matrixSize = matrixArray[0].array.size();
-
-    std::vector<float> contiguous(matrixSize * length);
-    for (std::size_t i = 0; i < length; ++i)
-        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix3fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    const TransientContextLock lock;
+    setUniformArray(findUniform(name), matrixArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length)
 {
-    static const std::size_t matrixSize = matrixArray[0].array.size();
-
-    std::vector<float> contiguous(matrixSize * length);
-    for (std::size_t i = 0; i < length; ++i)
-        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix4fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    const TransientContextLock lock;
+    setUniformArray(findUniform(name), matrixArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
-unsigned int Shader::getNativeHandle() const
+void Shader::setUniform(UniformHandle uniform, float x)
+{
+    if (stageUniform(uniform, UniformType::Float1, 1, &x, 1))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform1f(binder.location, x));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, Glsl::Vec2 v)
+{
+    const std::array values{v.x, v.y};
+    if (stageUniform(uniform, UniformType::Float2, 1, values.data(), values.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform2f(binder.location, v.x, v.y));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, const Glsl::Vec3& v)
+{
+    const std::array values{v.x, v.y, v.z};
+    if (stageUniform(uniform, UniformType::Float3, 1, values.data(), values.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform3f(binder.location, v.x, v.y, v.z));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, const Glsl::Vec4& v)
+{
+    const std::array values{v.x, v.y, v.z, v.w};
+    if (stageUniform(uniform, UniformType::Float4, 1, values.data(), values.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform4f(binder.location, v.x, v.y, v.z, v.w));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, int x)
+{
+    if (stageUniform(uniform, UniformType::Int1, 1, &x, 1))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform1i(binder.location, x));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, Glsl::Ivec2 v)
+{
+    const std::array values{v.x, v.y};
+    if (stageUniform(uniform, UniformType::Int2, 1, values.data(), values.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform2i(binder.location, v.x, v.y));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, const Glsl::Ivec3& v)
+{
+    const std::array values{v.x, v.y, v.z};
+    if (stageUniform(uniform, UniformType::Int3, 1, values.data(), values.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform3i(binder.location, v.x, v.y, v.z));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, const Glsl::Ivec4& v)
+{
+    const std::array values{v.x, v.y, v.z, v.w};
+    if (stageUniform(uniform, UniformType::Int4, 1, values.data(), values.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform4i(binder.location, v.x, v.y, v.z, v.w));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, const Glsl::Mat3& matrix)
+{
+    if (stageUniform(uniform, UniformType::Mat3, 1, matrix.array.data(), matrix.array.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniformMatrix3fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, const Glsl::Mat4& matrix)
+{
+    if (stageUniform(uniform, UniformType::Mat4, 1, matrix.array.data(), matrix.array.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniformMatrix4fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, bool x)
+{
+    setUniform(uniform, static_cast<int>(x));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, Glsl::Bvec2 v)
+{
+    setUniform(uniform, Glsl::Ivec2(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, const Glsl::Bvec3& v)
+{
+    setUniform(uniform, Glsl::Ivec3(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, const Glsl::Bvec4& v)
+{
+    setUniform(uniform, Glsl::Ivec4(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, const Texture& texture)
+{
+    if (!checkUniform(uniform))
+        return;
+
+    const TransientContextLock lock;
+
+    // Store the location -> texture mapping
+    const auto it = m_textures.find(uniform.m_location);
+    if (it == m_textures.end())
+    {
+        // New entry, make sure there are enough texture units
+        if (m_textures.size() + 1 >= getMaxTextureUnits())
+        {
+            err() << "Impossible to use texture " << std::quoted(getUniformName(uniform.m_location))
+                  << " for shader: all available texture units are used" << std::endl;
+            return;
+        }
+
+        m_textures[uniform.m_location] = &texture;
+    }
+    else
+    {
+        // Location already used, just replace the texture
+        it->second = &texture;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle uniform, CurrentTextureType)
+{
+    if (!checkUniform(uniform))
+        return;
+
+    m_currentTexture = uniform.m_location;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle uniform, const float* scalarArray, std::size_t length)
+{
+    if (stageUniform(uniform, UniformType::Float1, length, scalarArray, length))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform1fv(binder.location, static_cast<GLsizei>(length), scalarArray));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle uniform, const Glsl::Vec2* vectorArray, std::size_t length)
+{
+    std::vector<float> contiguous = flatten(vectorArray, length);
+
+    if (stageUniform(uniform, UniformType::Float2, length, contiguous.data(), contiguous.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform2fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle uniform, const Glsl::Vec3* vectorArray, std::size_t length)
+{
+    std::vector<float> contiguous = flatten(vectorArray, length);
+
+    if (stageUniform(uniform, UniformType::Float3, length, contiguous.data(), contiguous.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform3fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle uniform, const Glsl::Vec4* vectorArray, std::size_t length)
+{
+    std::vector<float> contiguous = flatten(vectorArray, length);
+
+    if (stageUniform(uniform, UniformType::Float4, length, contiguous.data(), contiguous.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniform4fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle uniform, const Glsl::Mat3* matrixArray, std::size_t length)
+{
+    static const std::size_t matrixSize = matrixArray[0].array.size();
+
+    std::vector<float> contiguous(matrixSize * length);
+    for (std::size_t i = 0; i < length; ++i)
+        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
+
+    if (stageUniform(uniform, UniformType::Mat3, length, contiguous.data(), contiguous.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniformMatrix3fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle uniform, const Glsl::Mat4* matrixArray, std::size_t length)
+{
+    static const std::size_t matrixSize = matrixArray[0].array.size();
+
+    std::vector<float> contiguous(matrixSize * length);
+    for (std::size_t i = 0; i < length; ++i)
+        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
+
+    if (stageUniform(uniform, UniformType::Mat4, length, contiguous.data(), contiguous.size()))
+        return;
+
+    const UniformBinder binder(*this, uniform);
+    if (binder.location != -1)
+        glCheck(GLEXT_glUniformMatrix4fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::setUniformBlock(const std::string& name, const UniformBuffer& buffer)
+{
+    // First make sure that we can use uniform buffers
+    if (!UniformBuffer::isAvailable())
+    {
+        err() << "Failed to set uniform block " << std::quoted(name)
+              << ": your system doesn't support uniform buffers "
+              << "(you should test UniformBuffer::isAvailable() before trying to use uniform blocks)" << std::endl;
+        return false;
+    }
+
+    if (!m_shaderProgram)
+        return false;
+
+    const TransientContextLock lock;
+
+    // Find the block in the program
+    const GLuint index = glCheck(GLEXT_glGetUniformBlockIndex(m_shaderProgram, name.c_str()));
+    if (index == GLEXT_GL_INVALID_INDEX)
+    {
+        err() << "Uniform block " << std::quoted(name) << " not found in shader" << std::endl;
+        return false;
+    }
+
+    // Block already attached, just replace the buffer
+    const auto it = std::find_if(m_uniformBlocks.begin(),
+                                 m_uniformBlocks.end(),
+                                 [index](const auto& block) { return block.first == index; });
+    if (it != m_uniformBlocks.end())
+    {
+        it->second = &buffer;
+        return true;
+    }
+
+    // New entry, make sure there are enough binding points
+    static const auto maxBindings = []
+    {
+        GLint value = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS, &value));
+        return static_cast<std::size_t>(value);
+    }();
+
+    if (m_uniformBlocks.size() >= maxBindings)
+    {
+        err() << "Impossible to use uniform block " << std::quoted(name)
+              << " for shader: all available binding points are used" << std::endl;
+        return false;
+    }
+
+    glCheck(GLEXT_glUniformBlockBinding(m_shaderProgram, index, static_cast<GLuint>(m_uniformBlocks.size())));
+    m_uniformBlocks.emplace_back(index, &buffer);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setDeferredUniformsEnabled(bool enabled)
+{
+    if (enabled == m_deferredUniforms)
+        return;
+
+    // Upload what is still pending, the program has to be bound for that
+    if (!enabled && !m_dirtyUniforms.empty() && m_shaderProgram)
+    {
+        const TransientContextLock lock;
+
+        const GLEXT_GLhandle program      = castToGlHandle(m_shaderProgram);
+        const GLEXT_GLhandle savedProgram = glCheck(GLEXT_glGetHandle(GLEXT_GL_PROGRAM_OBJECT));
+        if (program != savedProgram)
+            glCheck(GLEXT_glUseProgramObject(program));
+
+        uploadStagedUniforms();
+
+        if (program != savedProgram)
+            glCheck(GLEXT_glUseProgramObject(savedProgram));
+    }
+
+    // Values set while updates were immediate are not tracked, so start from scratch
+    m_stagedUniforms.clear();
+    m_dirtyUniforms.clear();
+    m_deferredUniforms = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isDeferredUniformsEnabled() const
+{
+    return m_deferredUniforms;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Shader::getNativeHandle() const
 {
     return m_shaderProgram;
 }
@@ -807,9 +1510,15 @@ void Shader::bind(const Shader* shader)
         // Enable the program
         glCheck(GLEXT_glUseProgramObject(castToGlHandle(shader->m_shaderProgram)));
 
+        // Upload the uniforms which changed while updates were deferred
+        shader->uploadStagedUniforms();
+
         // Bind the textures
         shader->bindTextures();
 
+        // Bind the uniform buffers
+        shader->bindUniformBlocks();
+
         // Bind the current texture
         if (shader->m_currentTexture != -1)
             glCheck(GLEXT_glUniform1i(shader->m_currentTexture, 0));
@@ -858,7 +1567,46 @@ bool Shader::isGeometryAvailable()
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometryShaderCode, std::string_view fragmentShaderCode)
+void Shader::setProgramCacheDirectory(const std::filesystem::path& directory)
+{
+    ProgramCache&         cache = getProgramCache();
+    const std::lock_guard lock(cache.mutex);
+    cache.directory = directory;
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getProgramCacheDirectory()
+{
+    ProgramCache&         cache = getProgramCache();
+    const std::lock_guard lock(cache.mutex);
+    return cache.directory;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::ProgramCacheStatistics Shader::getProgramCacheStatistics()
+{
+    ProgramCache&         cache = getProgramCache();
+    const std::lock_guard lock(cache.mutex);
+    return cache.statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::resetProgramCacheStatistics()
+{
+    ProgramCache&         cache = getProgramCache();
+    const std::lock_guard lock(cache.mutex);
+    cache.statistics = {};
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::compile(std::string_view vertexShaderCode,
+                     std::string_view geometryShaderCode,
+                     std::string_view fragmentShaderCode,
+                     bool             checkStatus)
 {
     const TransientContextLock lock;
 
@@ -878,12 +1626,53 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
         return false;
     }
 
+    // Helper function to replace the current program by a new one
+    const auto adoptProgram = [this](GLEXT_GLhandle shaderProgram)
+    {
+        // Destroy the shader if it was already created
+        if (m_shaderProgram)
+        {
+            glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
+            m_shaderProgram = 0;
+        }
+
+        // Reset the internal state
+        m_currentTexture = -1;
+        m_textures.clear();
+        m_uniforms.clear();
+        m_uniformBlocks.clear();
+        m_stagedUniforms.clear();
+        m_dirtyUniforms.clear();
+
+        // Give the program a new generation: OpenGL may reuse the identifier of a deleted
+        // program, which would otherwise let the handles of the previous one match it
+        m_shaderProgram     = castFromGlHandle(shaderProgram);
+        m_programGeneration = getUniqueProgramGeneration();
+
+        // Force an OpenGL flush, so that the shader will appear updated
+        // in all contexts immediately (solves problems in multi-threaded apps)
+        glCheck(glFlush());
+    };
+
+    // Reuse the binary of a previous compilation if the cache has one
+    const std::optional<ProgramCacheKey> cacheKey = makeProgramCacheKey(vertexShaderCode,
+                                                                        geometryShaderCode,
+                                                                        fragmentShaderCode);
+    if (cacheKey)
+    {
+        if (const GLEXT_GLhandle cachedProgram = loadCachedProgram(*cacheKey))
+        {
+            adoptProgram(cachedProgram);
+            return true;
+        }
+    }
+
     // Create the program
     const GLEXT_GLhandle shaderProgram = glCheck(GLEXT_glCreateProgramObject());
 
     // Helper function for shader creation
     const auto createAndAttachShader =
-        [shaderProgram](GLenum shaderType, const char* shaderTypeStr, std::string_view shaderCode)
+        [shaderProgram, checkStatus](GLenum shaderType, const char* shaderTypeStr, std::string_view shaderCode)
     {
         // Create and compile the shader
         const GLEXT_GLhandle shader           = glCheck(GLEXT_glCreateShaderObject(shaderType));
@@ -892,9 +1681,10 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
         glCheck(GLEXT_glShaderSource(shader, 1, &sourceCode, &sourceCodeLength));
         glCheck(GLEXT_glCompileShader(shader));
 
-        // Check the compile log
-        GLint success = 0;
-        glCheck(GLEXT_glGetObjectParameteriv(shader, GLEXT_GL_OBJECT_COMPILE_STATUS, &success));
+        // Check the compile log, unless the status is checked once the program is linked
+        GLint success = GL_TRUE;
+        if (checkStatus)
+            glCheck(GLEXT_glGetObjectParameteriv(shader, GLEXT_GL_OBJECT_COMPILE_STATUS, &success));
         if (success == GL_FALSE)
         {
             std::array<char, 1024> log{};
@@ -905,7 +1695,7 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
             return false;
         }
 
-        // Attach the shader to the program, and delete it (not needed anymore)
+        // Attach the shader to the program, and delete it (it lives as long as it is attached)
         glCheck(GLEXT_glAttachObject(shaderProgram, shader));
         glCheck(GLEXT_glDeleteObject(shader));
         return true;
@@ -926,9 +1716,21 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
         if (!createAndAttachShader(GLEXT_GL_FRAGMENT_SHADER, "fragment", fragmentShaderCode))
             return false;
 
+    // Ask the driver to keep the binary around if we are going to cache it
+    if (cacheKey)
+        glCheck(
+            GLEXT_glProgramParameteri(castFromGlHandle(shaderProgram), GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+
     // Link the program
     glCheck(GLEXT_glLinkProgram(shaderProgram));
 
+    // Let the driver link in the background, the status is checked by checkProgram
+    if (!checkStatus)
+    {
+        adoptProgram(shaderProgram);
+        return true;
+    }
+
     // Check the link log
     GLint success = 0;
     glCheck(GLEXT_glGetObjectParameteriv(shaderProgram, GLEXT_GL_OBJECT_LINK_STATUS, &success));
@@ -941,25 +1743,93 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
         return false;
     }
 
-    // Destroy the shader if it was already created
-    if (m_shaderProgram)
-    {
-        glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
-        m_shaderProgram = 0;
-    }
+    if (cacheKey)
+        storeCachedProgram(*cacheKey, shaderProgram);
+
+    adoptProgram(shaderProgram);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isCompiling() const
+{
+    if (!m_shaderProgram || !isParallelCompileAvailable())
+        return false;
+
+    const TransientContextLock lock;
+
+    GLint completed = GL_TRUE;
+    glCheck(GLEXT_glGetObjectParameteriv(castToGlHandle(m_shaderProgram), GLEXT_GL_COMPLETION_STATUS, &completed));
+    return completed == GL_FALSE;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::checkProgram(std::string_view vertexShaderCode,
+                          std::string_view geometryShaderCode,
+                          std::string_view fragmentShaderCode)
+{
+    if (!m_shaderProgram)
+        return false;
+
+    const TransientContextLock lock;
+
+    const GLEXT_GLhandle shaderProgram = castToGlHandle(m_shaderProgram);
+
+    // Check the link log, this waits for the driver to finish
+    GLint success = 0;
+    glCheck(GLEXT_glGetObjectParameteriv(shaderProgram, GLEXT_GL_OBJECT_LINK_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        // Report the compile logs of the shaders, which are still attached to the program
+        std::array<GLEXT_GLhandle, 3> shaders{};
+        const auto                    maxCount = static_cast<GLsizei>(shaders.size());
+        GLsizei                       count    = 0;
+        glCheck(GLEXT_glGetAttachedObjects(shaderProgram, maxCount, &count, shaders.data()));
+        for (std::size_t i = 0; i < static_cast<std::size_t>(count); ++i)
+        {
+            glCheck(GLEXT_glGetObjectParameteriv(shaders[i], GLEXT_GL_OBJECT_COMPILE_STATUS, &success));
+            if (success == GL_FALSE)
+            {
+                std::array<char, 1024> log{};
+                glCheck(GLEXT_glGetInfoLog(shaders[i], static_cast<GLsizei>(log.size()), nullptr, log.data()));
+                err() << "Failed to compile shader:" << '\n' << log.data() << std::endl;
+            }
+        }
+
+        std::array<char, 1024> log{};
+        glCheck(GLEXT_glGetInfoLog(shaderProgram, static_cast<GLsizei>(log.size()), nullptr, log.data()));
+        err() << "Failed to link shader:" << '\n' << log.data() << std::endl;
+        glCheck(GLEXT_glDeleteObject(shaderProgram));
+        m_shaderProgram = 0;
+        return false;
+    }
+
+    // Store the binary, unless the program was loaded from the cache in the first place
+    const std::optional<ProgramCacheKey> cacheKey = makeProgramCacheKey(vertexShaderCode,
+                                                                        geometryShaderCode,
+                                                                        fragmentShaderCode);
+    std::error_code error;
+    if (cacheKey && !std::filesystem::exists(cacheKey->path, error))
+        storeCachedProgram(*cacheKey, shaderProgram);
+
+    return true;
+}
 
-    // Reset the internal state
-    m_currentTexture = -1;
-    m_textures.clear();
-    m_uniforms.clear();
 
-    m_shaderProgram = castFromGlHandle(shaderProgram);
+////////////////////////////////////////////////////////////
+bool Shader::isParallelCompileAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
 
-    // Force an OpenGL flush, so that the shader will appear updated
-    // in all contexts immediately (solves problems in multi-threaded apps)
-    glCheck(glFlush());
+        return isAvailable() && (Context::isExtensionAvailable("GL_KHR_parallel_shader_compile") ||
+                                 Context::isExtensionAvailable("GL_ARB_parallel_shader_compile"));
+    }();
 
-    return true;
+    return available;
 }
 
 
@@ -981,6 +1851,67 @@ void Shader::bindTextures() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+    for (std::size_t i = 0; i < m_uniformBlocks.size(); ++i)
+        glCheck(GLEXT_glBindBufferBase(GLEXT_GL_UNIFORM_BUFFER,
+                                       static_cast<GLuint>(i),
+                                       m_uniformBlocks[i].second->getNativeHandle()));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::uploadStagedUniforms() const
+{
+    for (const int location : m_dirtyUniforms)
+    {
+        StagedUniform& uniform = m_stagedUniforms[location];
+        uniform.dirty          = false;
+
+        const auto     count  = static_cast<GLsizei>(uniform.count);
+        const GLfloat* floats = uniform.floats.data();
+        const GLint*   ints   = uniform.ints.data();
+
+        switch (uniform.type)
+        {
+            case UniformType::Float1:
+                glCheck(GLEXT_glUniform1fv(location, count, floats));
+                break;
+            case UniformType::Float2:
+                glCheck(GLEXT_glUniform2fv(location, count, floats));
+                break;
+            case UniformType::Float3:
+                glCheck(GLEXT_glUniform3fv(location, count, floats));
+                break;
+            case UniformType::Float4:
+                glCheck(GLEXT_glUniform4fv(location, count, floats));
+                break;
+            case UniformType::Int1:
+                glCheck(GLEXT_glUniform1iv(location, count, ints));
+                break;
+            case UniformType::Int2:
+                glCheck(GLEXT_glUniform2iv(location, count, ints));
+                break;
+            case UniformType::Int3:
+                glCheck(GLEXT_glUniform3iv(location, count, ints));
+                break;
+            case UniformType::Int4:
+                glCheck(GLEXT_glUniform4iv(location, count, ints));
+                break;
+            case UniformType::Mat3:
+                glCheck(GLEXT_glUniformMatrix3fv(location, count, GL_FALSE, floats));
+                break;
+            case UniformType::Mat4:
+                glCheck(GLEXT_glUniformMatrix4fv(location, count, GL_FALSE, floats));
+                break;
+        }
+    }
+
+    m_dirtyUniforms.clear();
+}
+
+
 ////////////////////////////////////////////////////////////
 int Shader::getUniformLocation(const std::string& name)
 {
@@ -1001,6 +1932,45 @@ int Shader::getUniformLocation(const std::string& name)
     return location;
 }
 
+
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::findUniform(const std::string& name)
+{
+    if (!m_shaderProgram)
+        return {};
+
+    return {getUniformLocation(name), m_programGeneration};
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::checkUniform(UniformHandle uniform) const
+{
+    if (!m_shaderProgram || !uniform.isValid())
+        return false;
+
+    if (uniform.m_programGeneration != m_programGeneration)
+    {
+        err() << "Failed to set shader uniform: the uniform handle was not retrieved from the current program of "
+                 "this shader"
+              << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::string Shader::getUniformName(int location) const
+{
+    // Only used to report errors: the location cache holds the names of all the uniforms looked up so far
+    const auto it = std::find_if(m_uniforms.begin(),
+                                 m_uniforms.end(),
+                                 [location](const auto& uniform) { return uniform.second == location; });
+    return (it != m_uniforms.end()) ? it->first : std::string();
+}
+
 } // namespace sf
 
 #else // SFML_OPENGL_ES
@@ -1159,6 +2129,39 @@ bool Shader::loadFromStream(InputStream& /* vertexShaderStream */,
 }
 
 
+////////////////////////////////////////////////////////////
+ShaderRequest Shader::loadFromFileAsync(const std::filesystem::path& /* vertexShaderFilename */,
+                                        const std::filesystem::path& /* fragmentShaderFilename */)
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderRequest Shader::loadFromFileAsync(const std::filesystem::path& /* vertexShaderFilename */,
+                                        const std::filesystem::path& /* geometryShaderFilename */,
+                                        const std::filesystem::path& /* fragmentShaderFilename */)
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderRequest Shader::loadFromMemoryAsync(std::string_view /* vertexShader */, std::string_view /* fragmentShader */)
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderRequest Shader::loadFromMemoryAsync(std::string_view /* vertexShader */,
+                                          std::string_view /* geometryShader */,
+                                          std::string_view /* fragmentShader */)
+{
+    return {};
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& /* name */, float)
 {
@@ -1291,6 +2294,166 @@ void Shader::setUniformArray(const std::string& /* name */, const Glsl::Mat4* /*
 }
 
 
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::getUniformHandle(std::string_view /* name */)
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, float)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, Glsl::Vec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Vec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Vec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, int)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, Glsl::Ivec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Ivec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Ivec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, bool)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, Glsl::Bvec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Bvec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Bvec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Mat3& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Mat4& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Texture& /* texture */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, CurrentTextureType)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const float* /* scalarArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const Glsl::Vec2* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const Glsl::Vec3* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const Glsl::Vec4* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const Glsl::Mat3* /* matrixArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const Glsl::Mat4* /* matrixArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::setUniformBlock(const std::string& /* name */, const UniformBuffer& /* buffer */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setDeferredUniformsEnabled(bool enabled)
+{
+    m_deferredUniforms = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isDeferredUniformsEnabled() const
+{
+    return m_deferredUniforms;
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -1318,10 +2481,60 @@ bool Shader::isGeometryAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setProgramCacheDirectory(const std::filesystem::path& /* directory */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getProgramCacheDirectory()
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::ProgramCacheStatistics Shader::getProgramCacheStatistics()
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::resetProgramCacheStatistics()
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Shader::compile(std::string_view /* vertexShaderCode */,
                      std::string_view /* geometryShaderCode */,
-                     std::string_view /* fragmentShaderCode */)
+                     std::string_view /* fragmentShaderCode */,
+                     bool /* checkStatus */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isCompiling() const
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::checkProgram(std::string_view /* vertexShaderCode */,
+                          std::string_view /* geometryShaderCode */,
+                          std::string_view /* fragmentShaderCode */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isParallelCompileAvailable()
 {
     return false;
 }
@@ -1332,6 +2545,12 @@ void Shader::bindTextures() const
 {
 }
 
+
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+}
+
 } // namespace sf
 
 #endif // SFML_OPENGL_ES
@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/ShaderRequest.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct ShaderRequest::Compilation
+{
+    Compilation(std::string_view vertexShader, std::string_view geometryShader, std::string_view fragmentShader) :
+    vertexShaderCode(vertexShader),
+    geometryShaderCode(geometryShader),
+    fragmentShaderCode(fragmentShader)
+    {
+    }
+
+    ~Compilation()
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+
+    Compilation(const Compilation&)            = delete;
+    Compilation& operator=(const Compilation&) = delete;
+
+    std::string             vertexShaderCode;   //!< Source code of the vertex shader
+    std::string             geometryShaderCode; //!< Source code of the geometry shader
+    std::string             fragmentShaderCode; //!< Source code of the fragment shader
+    std::mutex              mutex;              //!< Mutex protecting the members below
+    std::condition_variable condition;          //!< Signaled when the worker thread is done
+    std::optional<Shader>   shader;             //!< Compiled shader, until it is taken
+    bool                    linking{};          //!< Is the driver linking the program of the shader in parallel?
+    bool                    done{};             //!< Has the shader been submitted or compiled?
+    std::thread             worker;             //!< Thread compiling the shader, if the driver can't do it in parallel
+};
+
+
+////////////////////////////////////////////////////////////
+bool ShaderRequest::isReady() const
+{
+    if (!m_compilation)
+        return true;
+
+    Compilation&          compilation = *m_compilation;
+    const std::lock_guard lock(compilation.mutex);
+
+    if (compilation.linking)
+        return !compilation.shader->isCompiling();
+
+    return compilation.done;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ShaderRequest::wait(Time timeout) const
+{
+    if (!m_compilation)
+        return true;
+
+    Compilation&     compilation = *m_compilation;
+    std::unique_lock lock(compilation.mutex);
+
+    if (!compilation.linking)
+        return compilation.condition.wait_for(lock, timeout.toDuration(), [&compilation] { return compilation.done; });
+
+    // The driver doesn't signal the end of a parallel compilation, it has to be polled
+    const Clock clock;
+    while (compilation.shader->isCompiling())
+    {
+        if (clock.getElapsedTime() >= timeout)
+            return false;
+
+        sleep(milliseconds(1));
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Shader> ShaderRequest::takeShader()
+{
+    if (!m_compilation)
+        return std::nullopt;
+
+    Compilation&     compilation = *m_compilation;
+    std::unique_lock lock(compilation.mutex);
+    compilation.condition.wait(lock, [&compilation] { return compilation.done; });
+
+    // Check for errors once the driver has finished linking in parallel
+    if (compilation.linking)
+    {
+        compilation.linking = false;
+        if (!compilation.shader->checkProgram(compilation.vertexShaderCode,
+                                              compilation.geometryShaderCode,
+                                              compilation.fragmentShaderCode))
+            compilation.shader.reset();
+    }
+
+    return std::exchange(compilation.shader, std::nullopt);
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderRequest ShaderRequest::start(std::string_view vertexShaderCode,
+                                   std::string_view geometryShaderCode,
+                                   std::string_view fragmentShaderCode)
+{
+    ShaderRequest request;
+    request.m_compilation = std::make_shared<Compilation>(vertexShaderCode, geometryShaderCode, fragmentShaderCode);
+    Compilation& compilation = *request.m_compilation;
+
+    if (Shader::isParallelCompileAvailable())
+    {
+        // Submit the shaders right away and let the driver compile them on its own threads
+        if (Shader shader; shader.compile(vertexShaderCode, geometryShaderCode, fragmentShaderCode, false))
+        {
+            compilation.shader  = std::move(shader);
+            compilation.linking = true;
+        }
+
+        compilation.done = true;
+        return request;
+    }
+
+    // Otherwise compile on a worker thread, in a context shared with the others
+    compilation.worker = std::thread(
+        [&compilation]
+        {
+            const Context context;
+
+            Shader     shader;
+            const bool success = shader.compile(compilation.vertexShaderCode,
+                                                compilation.geometryShaderCode,
+                                                compilation.fragmentShaderCode);
+
+            // Make sure that the program is complete before another context uses it
+            glCheck(glFinish());
+
+            {
+                const std::lock_guard lock(compilation.mutex);
+                if (success)
+                    compilation.shader = std::move(shader);
+                compilation.done = true;
+            }
+
+            compilation.condition.notify_all();
+        });
+
+    return request;
+}
+
+} // namespace sf
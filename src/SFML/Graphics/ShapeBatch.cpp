@@ -0,0 +1,515 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/ShapeBatch.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ShapeBatchImpl
+{
+// Get the points of a circle of radius 1 centered on the origin, shared by all the batches
+const std::vector<sf::Vector2f>& getUnitCircle(std::size_t pointCount)
+{
+    static std::mutex                                                mutex;
+    static std::unordered_map<std::size_t, std::vector<sf::Vector2f>> circles;
+
+    const std::lock_guard lock(mutex);
+
+    std::vector<sf::Vector2f>& points = circles[pointCount];
+    if (points.empty())
+    {
+        // Same points as sf::CircleShape, starting from the top
+        points.reserve(pointCount);
+        for (std::size_t i = 0; i < pointCount; ++i)
+        {
+            const sf::Angle angle = static_cast<float>(i) / static_cast<float>(pointCount) * sf::degrees(360.f) -
+                                    sf::degrees(90.f);
+            points.emplace_back(1.f, angle);
+        }
+    }
+
+    return points;
+}
+
+// Get the corners of a square of size 2 centered on the origin, in the same order as sf::RectangleShape
+const std::vector<sf::Vector2f>& getUnitSquare()
+{
+    static const std::vector<sf::Vector2f> square = {{-1.f, -1.f}, {1.f, -1.f}, {1.f, 1.f}, {-1.f, 1.f}};
+    return square;
+}
+
+// Number of vertices of the triangles of the inside and of the outline of a shape
+std::size_t getVertexCount(std::size_t pointCount, float outlineThickness)
+{
+    return (pointCount - 2) * 3 + (outlineThickness != 0.f ? pointCount * 6 : 0);
+}
+
+// Compute the normal of a segment
+sf::Vector2f computeNormal(sf::Vector2f p1, sf::Vector2f p2)
+{
+    sf::Vector2f normal = (p2 - p1).perpendicular();
+    const float  length = normal.length();
+    if (length != 0.f)
+        normal /= length;
+    return normal;
+}
+} // namespace ShapeBatchImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+std::size_t ShapeBatch::addCircle(Vector2f center, float radius, std::size_t pointCount)
+{
+    assert(pointCount >= 3 && "A circle needs at least 3 points");
+
+    return add(center, {radius * 2.f, radius * 2.f}, ShapeBatchImpl::getUnitCircle(pointCount));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShapeBatch::addRectangle(const FloatRect& rectangle)
+{
+    return add(rectangle.getCenter(), rectangle.size, ShapeBatchImpl::getUnitSquare());
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::clear()
+{
+    m_centers.clear();
+    m_sizes.clear();
+    m_rotations.clear();
+    m_fillColors.clear();
+    m_outlineColors.clear();
+    m_outlineThicknesses.clear();
+    m_polygons.clear();
+    m_dirty.clear();
+    m_dirtyShapes.clear();
+    m_firstVertices.clear();
+    m_vertices.clear();
+
+    m_layoutNeedUpdate = false;
+    m_uploadBegin      = 0;
+    m_uploadEnd        = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::reserve(std::size_t shapeCount)
+{
+    m_centers.reserve(shapeCount);
+    m_sizes.reserve(shapeCount);
+    m_rotations.reserve(shapeCount);
+    m_fillColors.reserve(shapeCount);
+    m_outlineColors.reserve(shapeCount);
+    m_outlineThicknesses.reserve(shapeCount);
+    m_polygons.reserve(shapeCount);
+    m_dirty.reserve(shapeCount);
+    m_firstVertices.reserve(shapeCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShapeBatch::getShapeCount() const
+{
+    return m_centers.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::setCenter(std::size_t index, Vector2f center)
+{
+    assert(index < m_centers.size() && "Index is out of bounds");
+    m_centers[index] = center;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f ShapeBatch::getCenter(std::size_t index) const
+{
+    assert(index < m_centers.size() && "Index is out of bounds");
+    return m_centers[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::setSize(std::size_t index, Vector2f size)
+{
+    assert(index < m_sizes.size() && "Index is out of bounds");
+    m_sizes[index] = size;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f ShapeBatch::getSize(std::size_t index) const
+{
+    assert(index < m_sizes.size() && "Index is out of bounds");
+    return m_sizes[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::setRotation(std::size_t index, Angle angle)
+{
+    assert(index < m_rotations.size() && "Index is out of bounds");
+    m_rotations[index] = angle.wrapUnsigned();
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+Angle ShapeBatch::getRotation(std::size_t index) const
+{
+    assert(index < m_rotations.size() && "Index is out of bounds");
+    return m_rotations[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::setFillColor(std::size_t index, Color color)
+{
+    assert(index < m_fillColors.size() && "Index is out of bounds");
+    m_fillColors[index] = color;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+Color ShapeBatch::getFillColor(std::size_t index) const
+{
+    assert(index < m_fillColors.size() && "Index is out of bounds");
+    return m_fillColors[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::setOutlineColor(std::size_t index, Color color)
+{
+    assert(index < m_outlineColors.size() && "Index is out of bounds");
+    m_outlineColors[index] = color;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+Color ShapeBatch::getOutlineColor(std::size_t index) const
+{
+    assert(index < m_outlineColors.size() && "Index is out of bounds");
+    return m_outlineColors[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::setOutlineThickness(std::size_t index, float thickness)
+{
+    assert(index < m_outlineThicknesses.size() && "Index is out of bounds");
+
+    // Adding or removing the outline changes the number of vertices of the shape
+    if ((thickness != 0.f) != (m_outlineThicknesses[index] != 0.f))
+        m_layoutNeedUpdate = true;
+
+    m_outlineThicknesses[index] = thickness;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+float ShapeBatch::getOutlineThickness(std::size_t index) const
+{
+    assert(index < m_outlineThicknesses.size() && "Index is out of bounds");
+    return m_outlineThicknesses[index];
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShapeBatch::getPointCount(std::size_t index) const
+{
+    assert(index < m_polygons.size() && "Index is out of bounds");
+    return m_polygons[index]->size();
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect ShapeBatch::getLocalBounds() const
+{
+    ensureGeometryUpdate();
+
+    if (m_vertices.empty())
+        return {};
+
+    Vector2f minimum = m_vertices.front().position;
+    Vector2f maximum = minimum;
+    for (const Vertex& vertex : m_vertices)
+    {
+        minimum.x = std::min(minimum.x, vertex.position.x);
+        minimum.y = std::min(minimum.y, vertex.position.y);
+        maximum.x = std::max(maximum.x, vertex.position.x);
+        maximum.y = std::max(maximum.y, vertex.position.y);
+    }
+
+    return {minimum, maximum - minimum};
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect ShapeBatch::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::draw(RenderTarget& target, RenderStates states) const
+{
+    ensureGeometryUpdate();
+
+    if (m_vertices.empty())
+        return;
+
+    states.transform *= getTransform();
+    states.texture = nullptr;
+
+    // Keep a copy of the vertices in graphics memory, so that only the shapes which changed are uploaded
+    if (VertexBuffer::isAvailable())
+    {
+        bool uploaded = true;
+
+        if (m_vertexBuffer.getVertexCount() != m_vertices.size())
+        {
+            m_vertexBuffer.setPrimitiveType(PrimitiveType::Triangles);
+            m_vertexBuffer.setUsage(VertexBuffer::Usage::Dynamic);
+            uploaded      = m_vertexBuffer.create(m_vertices.size());
+            m_uploadBegin = 0;
+            m_uploadEnd   = m_vertices.size();
+        }
+
+        if (uploaded && (m_uploadBegin < m_uploadEnd))
+        {
+            uploaded = m_vertexBuffer.update(m_vertices.data() + m_uploadBegin,
+                                             m_uploadEnd - m_uploadBegin,
+                                             static_cast<unsigned int>(m_uploadBegin));
+        }
+
+        if (uploaded)
+        {
+            m_uploadBegin = 0;
+            m_uploadEnd   = 0;
+            target.draw(m_vertexBuffer, states);
+            return;
+        }
+    }
+
+    target.draw(m_vertices.data(), m_vertices.size(), PrimitiveType::Triangles, states);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShapeBatch::add(Vector2f center, Vector2f size, const std::vector<Vector2f>& polygon)
+{
+    const std::size_t index = m_centers.size();
+
+    m_centers.push_back(center);
+    m_sizes.push_back(size);
+    m_rotations.push_back(Angle::Zero);
+    m_fillColors.push_back(Color::White);
+    m_outlineColors.push_back(Color::White);
+    m_outlineThicknesses.push_back(0.f);
+    m_polygons.push_back(&polygon);
+    m_dirty.push_back(0);
+
+    // Append the vertices of the new shape, unless all the shapes are laid out again anyway
+    if (!m_layoutNeedUpdate)
+    {
+        m_firstVertices.push_back(m_vertices.size());
+        m_vertices.resize(m_vertices.size() + ShapeBatchImpl::getVertexCount(polygon.size(), 0.f));
+        invalidate(index);
+    }
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::invalidate(std::size_t index)
+{
+    if (!m_layoutNeedUpdate && !m_dirty[index])
+    {
+        m_dirty[index] = 1;
+        m_dirtyShapes.push_back(index);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::ensureGeometryUpdate() const
+{
+    const auto extendUpload = [this](std::size_t first, std::size_t last)
+    {
+        if (m_uploadBegin < m_uploadEnd)
+        {
+            m_uploadBegin = std::min(m_uploadBegin, first);
+            m_uploadEnd   = std::max(m_uploadEnd, last);
+        }
+        else
+        {
+            m_uploadBegin = first;
+            m_uploadEnd   = last;
+        }
+    };
+
+    if (m_layoutNeedUpdate)
+    {
+        // Assign a range of vertices to every shape, and compute all of them
+        const std::size_t shapeCount = m_centers.size();
+        std::size_t       vertexCount = 0;
+
+        m_firstVertices.resize(shapeCount);
+        for (std::size_t i = 0; i < shapeCount; ++i)
+        {
+            m_firstVertices[i] = vertexCount;
+            vertexCount += ShapeBatchImpl::getVertexCount(m_polygons[i]->size(), m_outlineThicknesses[i]);
+        }
+
+        m_vertices.resize(vertexCount);
+        for (std::size_t i = 0; i < shapeCount; ++i)
+            tessellate(i);
+
+        std::fill(m_dirty.begin(), m_dirty.end(), std::uint8_t{0});
+        m_dirtyShapes.clear();
+        m_layoutNeedUpdate = false;
+        extendUpload(0, vertexCount);
+        return;
+    }
+
+    // Only recompute the shapes which changed
+    for (const std::size_t index : m_dirtyShapes)
+    {
+        tessellate(index);
+        m_dirty[index] = 0;
+
+        const std::size_t pointCount = m_polygons[index]->size();
+        const std::size_t first      = m_firstVertices[index];
+        extendUpload(first, first + ShapeBatchImpl::getVertexCount(pointCount, m_outlineThicknesses[index]));
+    }
+
+    m_dirtyShapes.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::tessellate(std::size_t index) const
+{
+    const std::vector<Vector2f>& polygon   = *m_polygons[index];
+    const std::size_t            count     = polygon.size();
+    const Vector2f               center    = m_centers[index];
+    const Vector2f               halfSize  = m_sizes[index] / 2.f;
+    const float                  thickness = m_outlineThicknesses[index];
+
+    // Compute the points of the shape, and the points of its outline after them
+    m_points.resize(count * 2);
+
+    if (m_rotations[index] == Angle::Zero)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            m_points[i] = center + polygon[i].componentWiseMul(halfSize);
+    }
+    else
+    {
+        const float radians = m_rotations[index].asRadians();
+        const float cosine  = std::cos(radians);
+        const float sine    = std::sin(radians);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Vector2f point = polygon[i].componentWiseMul(halfSize);
+            m_points[i] = center + Vector2f(point.x * cosine - point.y * sine, point.x * sine + point.y * cosine);
+        }
+    }
+
+    Vertex* vertex = m_vertices.data() + m_firstVertices[index];
+
+    // Inside, as a fan of triangles (all the shapes are convex)
+    const Color fillColor = m_fillColors[index];
+    for (std::size_t i = 1; i + 1 < count; ++i)
+    {
+        *vertex++ = Vertex{m_points[0], fillColor};
+        *vertex++ = Vertex{m_points[i], fillColor};
+        *vertex++ = Vertex{m_points[i + 1], fillColor};
+    }
+
+    if (thickness == 0.f)
+        return;
+
+    // Extrude every point along the bisector of its two segments, like sf::Shape does
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Vector2f p0 = m_points[(i + count - 1) % count];
+        const Vector2f p1 = m_points[i];
+        const Vector2f p2 = m_points[(i + 1) % count];
+
+        // Make sure that the normals point towards the outside of the shape
+        Vector2f n1 = ShapeBatchImpl::computeNormal(p0, p1);
+        Vector2f n2 = ShapeBatchImpl::computeNormal(p1, p2);
+        if (n1.dot(center - p1) > 0)
+            n1 = -n1;
+        if (n2.dot(center - p1) > 0)
+            n2 = -n2;
+
+        const float factor  = 1.f + n1.dot(n2);
+        m_points[count + i] = p1 + (n1 + n2) / factor * thickness;
+    }
+
+    // Outline, as a quad between each segment and its extruded copy
+    const Color outlineColor = m_outlineColors[index];
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t next = (i + 1) % count;
+
+        *vertex++ = Vertex{m_points[i], outlineColor};
+        *vertex++ = Vertex{m_points[count + i], outlineColor};
+        *vertex++ = Vertex{m_points[next], outlineColor};
+        *vertex++ = Vertex{m_points[next], outlineColor};
+        *vertex++ = Vertex{m_points[count + i], outlineColor};
+        *vertex++ = Vertex{m_points[count + next], outlineColor};
+    }
+}
+
+} // namespace sf
@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SkylinePacker.hpp>
+
+#include <algorithm>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+SkylinePacker::SkylinePacker(Vector2u size) : m_size(size)
+{
+    clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Vector2u> SkylinePacker::insert(Vector2u size)
+{
+    // Empty rectangles don't need any room
+    if ((size.x == 0) || (size.y == 0))
+        return Vector2u();
+
+    // Find the segment which keeps the bottom of the rectangle the lowest, then the leftmost one
+    std::optional<std::size_t> best;
+    unsigned int               bestTop = 0;
+    for (std::size_t i = 0; i < m_skyline.size(); ++i)
+    {
+        const std::optional<unsigned int> top = fit(i, size);
+        if (top && (!best || (*top < bestTop)))
+        {
+            best    = i;
+            bestTop = *top;
+        }
+    }
+
+    if (!best)
+        return std::nullopt;
+
+    // Raise the skyline over the new rectangle
+    const Vector2u position(m_skyline[*best].x, bestTop);
+    const auto     newSegment = m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(*best),
+                                             Segment{position.x, position.y + size.y, size.x});
+
+    // Shrink or remove the segments which are now covered by the new one
+    const unsigned int right = position.x + size.x;
+    for (auto it = std::next(newSegment); it != m_skyline.end();)
+    {
+        if (it->x >= right)
+            break;
+
+        const unsigned int overlap = right - it->x;
+        if (overlap < it->width)
+        {
+            it->x += overlap;
+            it->width -= overlap;
+            break;
+        }
+
+        it = m_skyline.erase(it);
+    }
+
+    // Merge neighbor segments which ended up at the same height
+    for (std::size_t i = 0; i + 1 < m_skyline.size();)
+    {
+        if (m_skyline[i].y == m_skyline[i + 1].y)
+        {
+            m_skyline[i].width += m_skyline[i + 1].width;
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    m_usedArea += std::uint64_t{size.x} * size.y;
+
+    return position;
+}
+
+
+////////////////////////////////////////////////////////////
+void SkylinePacker::grow(Vector2u size)
+{
+    if (size.x > m_size.x)
+    {
+        if (!m_skyline.empty() && (m_skyline.back().y == 0))
+            m_skyline.back().width += size.x - m_size.x;
+        else
+            m_skyline.push_back(Segment{m_size.x, 0, size.x - m_size.x});
+
+        m_size.x = size.x;
+    }
+
+    m_size.y = std::max(m_size.y, size.y);
+}
+
+
+////////////////////////////////////////////////////////////
+void SkylinePacker::clear()
+{
+    m_skyline.clear();
+    if (m_size.x > 0)
+        m_skyline.push_back(Segment{0, 0, m_size.x});
+
+    m_usedArea = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u SkylinePacker::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SkylinePacker::getUsedArea() const
+{
+    return m_usedArea;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SkylinePacker::getHeight() const
+{
+    unsigned int height = 0;
+    for (const Segment& segment : m_skyline)
+        height = std::max(height, segment.y);
+
+    return height;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<unsigned int> SkylinePacker::fit(std::size_t index, Vector2u size) const
+{
+    if (m_skyline[index].x + size.x > m_size.x)
+        return std::nullopt;
+
+    // The rectangle rests on the highest segment below it
+    unsigned int top       = 0;
+    unsigned int remaining = size.x;
+    for (std::size_t i = index; remaining > 0; ++i)
+    {
+        top = std::max(top, m_skyline[i].y);
+        if (top + size.y > m_size.y)
+            return std::nullopt;
+
+        remaining -= std::min(remaining, m_skyline[i].width);
+    }
+
+    return top;
+}
+
+} // namespace sf::priv
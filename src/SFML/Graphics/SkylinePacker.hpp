@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Rectangle packer based on the skyline bottom-left heuristic
+///
+/// The packer keeps track of the top edge (the "skyline") of
+/// the rectangles packed so far, as a list of horizontal
+/// segments. Each new rectangle is placed on the segment which
+/// keeps it the lowest, which packs rectangles of similar
+/// heights tightly while staying cheap to update.
+///
+////////////////////////////////////////////////////////////
+class SkylinePacker
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty packer
+    ///
+    /// \param size Size of the area to pack rectangles into
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SkylinePacker(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find room for a rectangle and reserve it
+    ///
+    /// \param size Size of the rectangle to insert
+    ///
+    /// \return Position of the top-left corner of the rectangle,
+    ///         or `std::nullopt` if there is not enough room left
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Vector2u> insert(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the size of the area to pack rectangles into
+    ///
+    /// The area can only grow, the rectangles already packed
+    /// keep their position.
+    ///
+    /// \param size New size of the area
+    ///
+    ////////////////////////////////////////////////////////////
+    void grow(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the packed rectangles
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the area to pack rectangles into
+    ///
+    /// \return Size of the area
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total area of the packed rectangles
+    ///
+    /// \return Sum of the areas of all the inserted rectangles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getUsedArea() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the height of the highest point of the skyline
+    ///
+    /// The rows from this height to the bottom of the area
+    /// don't contain any rectangle.
+    ///
+    /// \return Largest bottom coordinate of the packed rectangles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getHeight() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Horizontal segment of the skyline
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Segment
+    {
+        unsigned int x{};     //!< Left coordinate of the segment
+        unsigned int y{};     //!< Height of the skyline along the segment
+        unsigned int width{}; //!< Width of the segment
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute where a rectangle would be placed if its left edge started at a segment
+    ///
+    /// \param index Index of the segment
+    /// \param size  Size of the rectangle
+    ///
+    /// \return Top coordinate of the rectangle, or `std::nullopt` if it doesn't fit
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<unsigned int> fit(std::size_t index, Vector2u size) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u             m_size;       //!< Size of the area to pack rectangles into
+    std::vector<Segment> m_skyline;    //!< Segments of the skyline, sorted from left to right
+    std::uint64_t        m_usedArea{}; //!< Total area of the packed rectangles
+};
+
+} // namespace sf::priv
@@ -28,10 +28,12 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/TextGeometry.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include "NetworkHelper.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <utility>
 
 #include <cmath>
@@ -39,49 +41,6 @@
 #include <cstdint>
 
 
-namespace
-{
-// Add an underline or strikethrough line to the vertex array
-void addLine(sf::VertexArray& vertices,
-             float            lineLength,
-             float            lineTop,
-             sf::Color        color,
-             float            offset,
-             float            thickness,
-             float            outlineThickness = 0)
-{
-    const float top    = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
-    const float bottom = top + std::floor(thickness + 0.5f);
-
-    vertices.append({{-outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{lineLength + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{-outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{-outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{lineLength + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{lineLength + outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
-}
-
-// Add a glyph quad to the vertex array
-void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, sf::Color color, const sf::Glyph& glyph, float italicShear)
-{
-    const sf::Vector2f padding(1.f, 1.f);
-
-    const sf::Vector2f p1 = glyph.bounds.position - padding;
-    const sf::Vector2f p2 = glyph.bounds.position + glyph.bounds.size + padding;
-
-    const auto uv1 = sf::Vector2f(glyph.textureRect.position) - padding;
-    const auto uv2 = sf::Vector2f(glyph.textureRect.position + glyph.textureRect.size) + padding;
-
-    vertices.append({position + sf::Vector2f(p1.x - italicShear * p1.y, p1.y), color, {uv1.x, uv1.y}});
-    vertices.append({position + sf::Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
-    vertices.append({position + sf::Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}});
-    vertices.append({position + sf::Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}});
-    vertices.append({position + sf::Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
-    vertices.append({position + sf::Vector2f(p2.x - italicShear * p2.y, p2.y), color, {uv2.x, uv2.y}});
-}
-} // namespace
-
-
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -98,8 +57,15 @@ void Text::setString(const String& string)
 {
     if (m_string != string)
     {
+        // Only the characters after the common prefix need to be laid out again
+        const std::size_t count  = std::min(m_string.getSize(), string.getSize());
+        std::size_t       prefix = 0;
+        while ((prefix < count) && (m_string[prefix] == string[prefix]))
+            ++prefix;
+
         m_string             = string;
         m_geometryNeedUpdate = true;
+        m_layoutStart        = std::min(m_layoutStart, prefix);
     }
 }
 
@@ -111,6 +77,7 @@ void Text::setFont(const Font& font)
     {
         m_font               = &font;
         m_geometryNeedUpdate = true;
+        m_layoutStart        = 0;
     }
 }
 
@@ -122,6 +89,7 @@ void Text::setCharacterSize(unsigned int size)
     {
         m_characterSize      = size;
         m_geometryNeedUpdate = true;
+        m_layoutStart        = 0;
     }
 }
 
@@ -133,6 +101,7 @@ void Text::setLetterSpacing(float spacingFactor)
     {
         m_letterSpacingFactor = spacingFactor;
         m_geometryNeedUpdate  = true;
+        m_layoutStart         = 0;
     }
 }
 
@@ -144,6 +113,7 @@ void Text::setLineSpacing(float spacingFactor)
     {
         m_lineSpacingFactor  = spacingFactor;
         m_geometryNeedUpdate = true;
+        m_layoutStart        = 0;
     }
 }
 
@@ -155,6 +125,7 @@ void Text::setStyle(std::uint32_t style)
     {
         m_style              = style;
         m_geometryNeedUpdate = true;
+        m_layoutStart        = 0;
     }
 }
 
@@ -167,8 +138,8 @@ void Text::setFillColor(Color color)
         m_fillColor = color;
 
         // Change vertex colors directly, no need to update whole geometry
-        // (if geometry is updated anyway, we can skip this step)
-        if (!m_geometryNeedUpdate)
+        // (if geometry is rebuilt from scratch anyway, we can skip this step)
+        if (!m_geometryNeedUpdate || (m_layoutStart > 0))
         {
             for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
                 m_vertices[i].color = m_fillColor;
@@ -185,8 +156,8 @@ void Text::setOutlineColor(Color color)
         m_outlineColor = color;
 
         // Change vertex colors directly, no need to update whole geometry
-        // (if geometry is updated anyway, we can skip this step)
-        if (!m_geometryNeedUpdate)
+        // (if geometry is rebuilt from scratch anyway, we can skip this step)
+        if (!m_geometryNeedUpdate || (m_layoutStart > 0))
         {
             for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
                 m_outlineVertices[i].color = m_outlineColor;
@@ -202,6 +173,7 @@ void Text::setOutlineThickness(float thickness)
     {
         m_outlineThickness   = thickness;
         m_geometryNeedUpdate = true;
+        m_layoutStart        = 0;
     }
 }
 
@@ -333,6 +305,73 @@ FloatRect Text::getGlobalBounds() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::drawVisible(RenderTarget& target, const RenderStates& states) const
+{
+    // Use the bounding rectangle of the area covered by the view, which may be rotated
+    const View&     view     = target.getView();
+    const FloatRect viewArea = view.getInverseTransform().transformRect(FloatRect({-1.f, -1.f}, {2.f, 2.f}));
+
+    drawVisible(target, viewArea, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::drawVisible(RenderTarget& target, const FloatRect& area, RenderStates states) const
+{
+    ensureGeometryUpdate();
+
+    states.transform *= getTransform();
+    states.texture        = &m_font->getTexture(m_characterSize);
+    states.coordinateType = CoordinateType::Pixels;
+
+    // Find the range of lines which intersect the area, using the baselines saved by the layout
+    // (they are sorted from top to bottom unless the line spacing is negative, in which case all lines are drawn)
+    std::size_t firstLine = 0;
+    std::size_t lastLine  = m_lineCheckpoints.size();
+    if (m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor >= 0.f)
+    {
+        const FloatRect localArea = states.transform.getInverse().transformRect(area);
+        const float     top       = localArea.position.y;
+        const float     bottom    = localArea.position.y + localArea.size.y;
+
+        const auto begin = m_lineCheckpoints.begin();
+        const auto first = std::partition_point(begin,
+                                                m_lineCheckpoints.end(),
+                                                [this, top](const LayoutCheckpoint& line)
+                                                { return line.position.y + m_lineDescent < top; });
+        const auto last  = std::partition_point(first,
+                                               m_lineCheckpoints.end(),
+                                               [this, bottom](const LayoutCheckpoint& line)
+                                               { return line.position.y - m_lineAscent <= bottom; });
+
+        firstLine = static_cast<std::size_t>(first - begin);
+        lastLine  = static_cast<std::size_t>(last - begin);
+    }
+
+    if (firstLine >= lastLine)
+        return;
+
+    // The geometry of consecutive lines is contiguous, the last line extends to the end of the arrays
+    const LayoutCheckpoint& first = m_lineCheckpoints[firstLine];
+    const LayoutCheckpoint* next  = (lastLine < m_lineCheckpoints.size()) ? &m_lineCheckpoints[lastLine] : nullptr;
+
+    const auto drawRange = [&target, &states](const VertexArray& vertices, std::size_t begin, std::size_t end)
+    {
+        if (begin < end)
+            target.draw(&vertices[begin], end - begin, PrimitiveType::Triangles, states);
+    };
+
+    // Only draw the outline if there is something to draw
+    if (m_outlineThickness != 0)
+        drawRange(m_outlineVertices,
+                  first.outlineVertexCount,
+                  next ? next->outlineVertexCount : m_outlineVertices.getVertexCount());
+
+    drawRange(m_vertices, first.vertexCount, next ? next->vertexCount : m_vertices.getVertexCount());
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::draw(RenderTarget& target, RenderStates states) const
 {
@@ -352,25 +391,83 @@ void Text::draw(RenderTarget& target, RenderStates states) const
 
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
+{
+    const std::uint64_t pageGeneration = m_font->getPageGeneration(m_characterSize);
+
+    updateGeometry();
+
+    // Lay the text out again if glyphs already added were moved or evicted by a rebuild of the page
+    // (only once: if the glyphs of the text don't fit in the page at all, it can't be laid out correctly)
+    if (m_font->getPageGeneration(m_characterSize) != pageGeneration)
+    {
+        m_geometryNeedUpdate = true;
+        m_layoutStart        = 0;
+        updateGeometry();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::updateGeometry() const
 {
     // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!m_geometryNeedUpdate && m_font->getTexture(m_characterSize).m_cacheId == m_fontTextureId)
+    const std::uint64_t fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+    if (!m_geometryNeedUpdate && fontTextureId == m_fontTextureId)
         return;
 
+    // A new font texture invalidates the texture coordinates of all the glyphs
+    if (fontTextureId != m_fontTextureId)
+        m_layoutStart = 0;
+
     // Save the current fonts texture id
-    m_fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+    m_fontTextureId = fontTextureId;
 
     // Mark geometry as updated
     m_geometryNeedUpdate = false;
 
-    // Clear the previous geometry
-    m_vertices.clear();
-    m_outlineVertices.clear();
-    m_bounds = FloatRect();
-
     // No text: nothing to draw
     if (m_string.isEmpty())
+    {
+        m_vertices.clear();
+        m_outlineVertices.clear();
+        m_lineCheckpoints.clear();
+        m_bounds      = FloatRect();
+        m_layoutStart = 0;
         return;
+    }
+
+    // Find where to resume the layout: at the end of the string if characters were only appended,
+    // at the start of the first modified line otherwise, and from scratch if anything else changed
+    LayoutCheckpoint checkpoint;
+    if ((m_layoutStart > 0) && !m_lineCheckpoints.empty())
+    {
+        if (m_layoutStart == m_endCheckpoint.index)
+        {
+            checkpoint = m_endCheckpoint;
+        }
+        else
+        {
+            const auto line = std::prev(std::upper_bound(m_lineCheckpoints.begin(),
+                                                         m_lineCheckpoints.end(),
+                                                         m_layoutStart,
+                                                         [](std::size_t index, const LayoutCheckpoint& lineCheckpoint)
+                                                         { return index < lineCheckpoint.index; }));
+            checkpoint      = *line;
+            m_lineCheckpoints.erase(std::next(line), m_lineCheckpoints.end());
+        }
+    }
+    else
+    {
+        checkpoint.position = Vector2f(0.f, static_cast<float>(m_characterSize));
+        checkpoint.min      = Vector2f(static_cast<float>(m_characterSize), static_cast<float>(m_characterSize));
+        m_lineCheckpoints.assign(1, checkpoint);
+        m_lineAscent  = 0.f;
+        m_lineDescent = 0.f;
+    }
+
+    // Discard the geometry generated after the checkpoint
+    m_vertices.resize(checkpoint.vertexCount);
+    m_outlineVertices.resize(checkpoint.outlineVertexCount);
 
     // Compute values related to the text style
     const bool  isBold             = m_style & Bold;
@@ -385,6 +482,21 @@ void Text::ensureGeometryUpdate() const
     // We reuse the underline thickness as the thickness of the strike through as well
     const float strikeThroughOffset = m_font->getGlyph(U'x', m_characterSize, isBold).bounds.getCenter().y;
 
+    // Keep track of how far the geometry extends around the baseline of the lines, so that they can be culled
+    // (extents are only ever grown by incremental updates, which keeps them conservative)
+    const auto extendLines = [this](float top, float bottom)
+    {
+        m_lineAscent  = std::max(m_lineAscent, -top);
+        m_lineDescent = std::max(m_lineDescent, bottom);
+    };
+    const float decorationMargin = std::abs(std::ceil(m_outlineThickness)) + 1.f;
+    if (isUnderlined)
+        extendLines(underlineOffset - underlineThickness / 2 - decorationMargin,
+                    underlineOffset + underlineThickness / 2 + decorationMargin);
+    if (isStrikeThrough)
+        extendLines(strikeThroughOffset - underlineThickness / 2 - decorationMargin,
+                    strikeThroughOffset + underlineThickness / 2 + decorationMargin);
+
     // Precompute the variables needed by the algorithm
     float       whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
     
@@ -395,17 +507,19 @@ void Text::ensureGeometryUpdate() const
     const float letterSpacing   = (whitespaceWidth / static_cast<float>(networkDivisor)) * (m_letterSpacingFactor - 1.f); 
     whitespaceWidth += letterSpacing;
     const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
-    float       x           = 0.f;
-    auto        y           = static_cast<float>(m_characterSize);
+    float       x           = checkpoint.position.x;
+    float       y           = checkpoint.position.y;
 
     // Create one quad for each character
-    auto          minX     = static_cast<float>(m_characterSize);
-    auto          minY     = static_cast<float>(m_characterSize);
-    float         maxX     = 0.f;
-    float         maxY     = 0.f;
-    std::uint32_t prevChar = 0;
-    for (const std::uint32_t curChar : m_string)
+    float         minX     = checkpoint.min.x;
+    float         minY     = checkpoint.min.y;
+    float         maxX     = checkpoint.max.x;
+    float         maxY     = checkpoint.max.y;
+    std::uint32_t prevChar = checkpoint.prevChar;
+    for (std::size_t i = checkpoint.index; i < m_string.getSize(); ++i)
     {
+        const std::uint32_t curChar = m_string[i];
+
         // Skip the \r char to avoid weird graphical issues
         if (curChar == U'\r')
             continue;
@@ -416,19 +530,31 @@ void Text::ensureGeometryUpdate() const
         // If we're using the underlined style and there's a new line, draw a line
         if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
         {
-            addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+            priv::addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
 
             if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+                priv::addLine(m_outlineVertices,
+                              x,
+                              y,
+                              m_outlineColor,
+                              underlineOffset,
+                              underlineThickness,
+                              m_outlineThickness);
         }
 
         // If we're using the strike through style and there's a new line, draw a line across all characters
         if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
         {
-            addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+            priv::addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
 
             if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+                priv::addLine(m_outlineVertices,
+                              x,
+                              y,
+                              m_outlineColor,
+                              strikeThroughOffset,
+                              underlineThickness,
+                              m_outlineThickness);
         }
 
         prevChar = curChar;
@@ -458,6 +584,18 @@ void Text::ensureGeometryUpdate() const
             maxX = std::max(maxX, x);
             maxY = std::max(maxY, y);
 
+            // Save the layout state at the start of the next line
+            if (curChar == U'\n')
+            {
+                m_lineCheckpoints.push_back({i + 1,
+                                             m_vertices.getVertexCount(),
+                                             m_outlineVertices.getVertexCount(),
+                                             Vector2f(x, y),
+                                             prevChar,
+                                             Vector2f(minX, minY),
+                                             Vector2f(maxX, maxY)});
+            }
+
             // Next glyph, no need to create a quad for whitespace
             continue;
         }
@@ -468,14 +606,16 @@ void Text::ensureGeometryUpdate() const
             const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
 
             // Add the outline glyph to the vertices
-            addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
+            priv::addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
+            extendLines(glyph.bounds.position.y - 1.f, glyph.bounds.position.y + glyph.bounds.size.y + 1.f);
         }
 
         // Extract the current glyph's description
         const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
         // Add the glyph to the vertices
-        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
+        priv::addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
+        extendLines(glyph.bounds.position.y - 1.f, glyph.bounds.position.y + glyph.bounds.size.y + 1.f);
 
         // Update the current bounds
         const Vector2f p1 = glyph.bounds.position;
@@ -490,6 +630,16 @@ void Text::ensureGeometryUpdate() const
         x += glyph.advance + letterSpacing;
     }
 
+    // Save the layout state at the end of the string, before the trailing decorations are added
+    m_endCheckpoint = {m_string.getSize(),
+                       m_vertices.getVertexCount(),
+                       m_outlineVertices.getVertexCount(),
+                       Vector2f(x, y),
+                       prevChar,
+                       Vector2f(minX, minY),
+                       Vector2f(maxX, maxY)};
+    m_layoutStart   = m_string.getSize();
+
     // If we're using outline, update the current bounds
     if (m_outlineThickness != 0)
     {
@@ -503,19 +653,31 @@ void Text::ensureGeometryUpdate() const
     // If we're using the underlined style, add the last line
     if (isUnderlined && (x > 0))
     {
-        addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+        priv::addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
 
         if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+            priv::addLine(m_outlineVertices,
+                          x,
+                          y,
+                          m_outlineColor,
+                          underlineOffset,
+                          underlineThickness,
+                          m_outlineThickness);
     }
 
     // If we're using the strike through style, add the last line across all characters
     if (isStrikeThrough && (x > 0))
     {
-        addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+        priv::addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
 
         if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+            priv::addLine(m_outlineVertices,
+                          x,
+                          y,
+                          m_outlineColor,
+                          strikeThroughOffset,
+                          underlineThickness,
+                          m_outlineThickness);
     }
 
     // Update the bounding rectangle
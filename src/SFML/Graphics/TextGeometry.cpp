@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextGeometry.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <cmath>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void addLine(VertexArray& vertices,
+             float        lineLength,
+             float        lineTop,
+             Color        color,
+             float        offset,
+             float        thickness,
+             float        outlineThickness)
+{
+    const float top    = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+    const float bottom = top + std::floor(thickness + 0.5f);
+
+    vertices.append({{-outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
+    vertices.append({{lineLength + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
+    vertices.append({{-outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
+    vertices.append({{-outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
+    vertices.append({{lineLength + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
+    vertices.append({{lineLength + outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
+}
+
+
+////////////////////////////////////////////////////////////
+void addGlyphQuad(VertexArray& vertices, Vector2f position, Color color, const Glyph& glyph, float italicShear)
+{
+    const Vector2f padding(1.f, 1.f);
+
+    const Vector2f p1 = glyph.bounds.position - padding;
+    const Vector2f p2 = glyph.bounds.position + glyph.bounds.size + padding;
+
+    const auto uv1 = Vector2f(glyph.textureRect.position) - padding;
+    const auto uv2 = Vector2f(glyph.textureRect.position + glyph.textureRect.size) + padding;
+
+    vertices.append({position + Vector2f(p1.x - italicShear * p1.y, p1.y), color, {uv1.x, uv1.y}});
+    vertices.append({position + Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
+    vertices.append({position + Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}});
+    vertices.append({position + Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}});
+    vertices.append({position + Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
+    vertices.append({position + Vector2f(p2.x - italicShear * p2.y, p2.y), color, {uv2.x, uv2.y}});
+}
+
+} // namespace sf::priv
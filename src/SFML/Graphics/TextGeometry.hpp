@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Glyph.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+
+namespace sf
+{
+class VertexArray;
+}
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Add an underline or strike through line to a vertex array
+///
+/// \param vertices         Vertex array to append the line's triangles to
+/// \param lineLength       Length of the line
+/// \param lineTop          Baseline of the text line
+/// \param color            Color of the line
+/// \param offset           Offset of the line's center from the baseline
+/// \param thickness        Thickness of the line
+/// \param outlineThickness Thickness of the outline around the line, 0 for a fill line
+///
+////////////////////////////////////////////////////////////
+void addLine(VertexArray& vertices,
+             float        lineLength,
+             float        lineTop,
+             Color        color,
+             float        offset,
+             float        thickness,
+             float        outlineThickness = 0);
+
+////////////////////////////////////////////////////////////
+/// \brief Add the quad of a glyph to a vertex array
+///
+/// \param vertices    Vertex array to append the glyph's triangles to
+/// \param position    Position of the glyph's origin on the baseline
+/// \param color       Color of the glyph
+/// \param glyph       Glyph to add
+/// \param italicShear Horizontal shear applied to italic text
+///
+////////////////////////////////////////////////////////////
+void addGlyphQuad(VertexArray& vertices, Vector2f position, Color color, const Glyph& glyph, float italicShear);
+
+} // namespace sf::priv
@@ -0,0 +1,409 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/TextGeometry.hpp>
+#include <SFML/Graphics/TextLayout.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <cmath>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextLayout::TextLayout(const Font& font, String string, unsigned int characterSize) :
+m_string(std::move(string)),
+m_font(&font),
+m_characterSize(characterSize)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setString(const String& string)
+{
+    if (m_string != string)
+    {
+        m_string           = string;
+        m_layoutNeedUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setFont(const Font& font)
+{
+    if (m_font != &font)
+    {
+        m_font             = &font;
+        m_layoutNeedUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setCharacterSize(unsigned int size)
+{
+    if (m_characterSize != size)
+    {
+        m_characterSize    = size;
+        m_layoutNeedUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setLineSpacing(float spacingFactor)
+{
+    if (m_lineSpacingFactor != spacingFactor)
+    {
+        m_lineSpacingFactor = spacingFactor;
+        m_layoutNeedUpdate  = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setLetterSpacing(float spacingFactor)
+{
+    if (m_letterSpacingFactor != spacingFactor)
+    {
+        m_letterSpacingFactor = spacingFactor;
+        m_layoutNeedUpdate    = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setStyle(std::uint32_t style)
+{
+    if (m_style != style)
+    {
+        m_style            = style;
+        m_layoutNeedUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setOutlineThickness(float thickness)
+{
+    if (m_outlineThickness != thickness)
+    {
+        m_outlineThickness = thickness;
+        m_layoutNeedUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+const String& TextLayout::getString() const
+{
+    return m_string;
+}
+
+
+////////////////////////////////////////////////////////////
+const Font& TextLayout::getFont() const
+{
+    return *m_font;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextLayout::getCharacterSize() const
+{
+    return m_characterSize;
+}
+
+
+////////////////////////////////////////////////////////////
+float TextLayout::getLineSpacing() const
+{
+    return m_lineSpacingFactor;
+}
+
+
+////////////////////////////////////////////////////////////
+float TextLayout::getLetterSpacing() const
+{
+    return m_letterSpacingFactor;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t TextLayout::getStyle() const
+{
+    return m_style;
+}
+
+
+////////////////////////////////////////////////////////////
+float TextLayout::getOutlineThickness() const
+{
+    return m_outlineThickness;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<TextLayout::GlyphPlacement>& TextLayout::getGlyphs() const
+{
+    ensureLayoutUpdate();
+
+    return m_glyphs;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<TextLayout::Line>& TextLayout::getLines() const
+{
+    ensureLayoutUpdate();
+
+    return m_lines;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TextLayout::getLocalBounds() const
+{
+    ensureLayoutUpdate();
+
+    return m_bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::createGeometry(VertexArray& fillVertices,
+                                Color        fillColor,
+                                VertexArray& outlineVertices,
+                                Color        outlineColor) const
+{
+    ensureLayoutUpdate();
+
+    fillVertices.setPrimitiveType(PrimitiveType::Triangles);
+    fillVertices.clear();
+    outlineVertices.setPrimitiveType(PrimitiveType::Triangles);
+    outlineVertices.clear();
+
+    if (m_glyphs.empty() && m_lines.empty())
+        return;
+
+    const bool  isBold      = m_style & Text::Bold;
+    const float italicShear = (m_style & Text::Italic) ? degrees(12).asRadians() : 0.f;
+
+    // Add the glyph quads, loading the glyphs into the font's texture if needed
+    const auto addGlyphQuads = [&]
+    {
+        for (const GlyphPlacement& placement : m_glyphs)
+        {
+            if (m_outlineThickness != 0)
+            {
+                const Glyph& glyph = m_font->getGlyph(placement.codePoint, m_characterSize, isBold, m_outlineThickness);
+                priv::addGlyphQuad(outlineVertices, placement.position, outlineColor, glyph, italicShear);
+            }
+
+            const Glyph& glyph = m_font->getGlyph(placement.codePoint, m_characterSize, isBold);
+            priv::addGlyphQuad(fillVertices, placement.position, fillColor, glyph, italicShear);
+        }
+    };
+
+    const std::uint64_t pageGeneration = m_font->getPageGeneration(m_characterSize);
+    addGlyphQuads();
+
+    // Add the quads again if glyphs already added were moved or evicted by a rebuild of the page
+    // (only once: if the glyphs of the text don't fit in the page at all, they can't all be drawn correctly)
+    if (m_font->getPageGeneration(m_characterSize) != pageGeneration)
+    {
+        fillVertices.clear();
+        outlineVertices.clear();
+        addGlyphQuads();
+    }
+
+    // Add the underline and strike through lines of the non-empty lines
+    const bool isUnderlined    = m_style & Text::Underlined;
+    const bool isStrikeThrough = m_style & Text::StrikeThrough;
+    if (!isUnderlined && !isStrikeThrough)
+        return;
+
+    const float underlineOffset     = m_font->getUnderlinePosition(m_characterSize);
+    const float underlineThickness  = m_font->getUnderlineThickness(m_characterSize);
+    const float strikeThroughOffset = m_font->getGlyphMetrics(U'x', m_characterSize, isBold).bounds.getCenter().y;
+
+    const auto addLines = [&](const Line& line, float offset)
+    {
+        priv::addLine(fillVertices, line.width, line.baseline, fillColor, offset, underlineThickness);
+
+        if (m_outlineThickness != 0)
+        {
+            priv::addLine(outlineVertices,
+                    line.width,
+                    line.baseline,
+                    outlineColor,
+                    offset,
+                    underlineThickness,
+                    m_outlineThickness);
+        }
+    };
+
+    for (const Line& line : m_lines)
+    {
+        if (line.width <= 0)
+            continue;
+
+        if (isUnderlined)
+            addLines(line, underlineOffset);
+
+        if (isStrikeThrough)
+            addLines(line, strikeThroughOffset);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::ensureLayoutUpdate() const
+{
+    if (!m_layoutNeedUpdate)
+        return;
+
+    m_layoutNeedUpdate = false;
+
+    // Clear the previous layout
+    m_glyphs.clear();
+    m_lines.clear();
+    m_bounds = FloatRect();
+
+    // No text: nothing to lay out
+    if (m_string.isEmpty())
+        return;
+
+    // Compute values related to the text style
+    const bool  isBold      = m_style & Text::Bold;
+    const float italicShear = (m_style & Text::Italic) ? degrees(12).asRadians() : 0.f;
+
+    // Precompute the variables needed by the algorithm, only from the metrics of the font
+    float       whitespaceWidth = m_font->getGlyphMetrics(U' ', m_characterSize, isBold).advance;
+    const float letterSpacing   = (whitespaceWidth / 3.f) * (m_letterSpacingFactor - 1.f);
+    whitespaceWidth += letterSpacing;
+    const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
+    float       x           = 0.f;
+    auto        y           = static_cast<float>(m_characterSize);
+
+    // Place each character
+    auto          minX     = static_cast<float>(m_characterSize);
+    auto          minY     = static_cast<float>(m_characterSize);
+    float         maxX     = 0.f;
+    float         maxY     = 0.f;
+    std::uint32_t prevChar = 0;
+    m_lines.push_back({0, 0, y, 0.f});
+    for (std::size_t i = 0; i < m_string.getSize(); ++i)
+    {
+        const std::uint32_t curChar = m_string[i];
+
+        // Skip the \r char, like sf::Text does
+        if (curChar == U'\r')
+            continue;
+
+        // Apply the kerning offset
+        x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+        prevChar = curChar;
+
+        // Handle special characters
+        if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
+        {
+            // Update the current bounds (min coordinates)
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+
+            switch (curChar)
+            {
+                case U' ':
+                    x += whitespaceWidth;
+                    break;
+                case U'\t':
+                    x += whitespaceWidth * 4;
+                    break;
+                case U'\n':
+                    m_lines.back().width = x;
+                    y += lineSpacing;
+                    x = 0;
+                    m_lines.push_back({m_glyphs.size(), 0, y, 0.f});
+                    break;
+            }
+
+            // Update the current bounds (max coordinates)
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+
+            // Next character, whitespace has no placement
+            continue;
+        }
+
+        // Extract the current glyph's metrics
+        const Glyph glyph = m_font->getGlyphMetrics(curChar, m_characterSize, isBold);
+
+        // Compute the bounds of the glyph, taking the italic shear into account
+        const Vector2f p1 = glyph.bounds.position;
+        const Vector2f p2 = glyph.bounds.position + glyph.bounds.size;
+        const Vector2f glyphMin(x + p1.x - italicShear * p2.y, y + p1.y);
+        const Vector2f glyphMax(x + p2.x - italicShear * p1.y, y + p2.y);
+
+        m_glyphs.push_back({curChar, i, Vector2f(x, y), FloatRect(glyphMin, glyphMax - glyphMin)});
+        ++m_lines.back().glyphCount;
+
+        // Update the current bounds
+        minX = std::min(minX, glyphMin.x);
+        maxX = std::max(maxX, glyphMax.x);
+        minY = std::min(minY, glyphMin.y);
+        maxY = std::max(maxY, glyphMax.y);
+
+        // Advance to the next character
+        x += glyph.advance + letterSpacing;
+    }
+
+    m_lines.back().width = x;
+
+    // If we're using outline, update the current bounds
+    if (m_outlineThickness != 0)
+    {
+        const float outline = std::abs(std::ceil(m_outlineThickness));
+        minX -= outline;
+        maxX += outline;
+        minY -= outline;
+        maxY += outline;
+    }
+
+    // Update the bounding rectangle
+    m_bounds.position = Vector2f(minX, minY);
+    m_bounds.size     = Vector2f(maxX, maxY) - Vector2f(minX, minY);
+}
+
+} // namespace sf
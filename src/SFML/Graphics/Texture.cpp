@@ -25,23 +25,28 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CompressedImage.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/TextureSaver.hpp>
+#include <SFML/Graphics/TextureUploadPool.hpp>
 
 #include <SFML/Window/Context.hpp>
 #include <SFML/Window/Window.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
+#include <SFML/System/FileInputStream.hpp>
 
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <optional>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include <cassert>
 #include <cstring>
@@ -64,6 +69,48 @@ std::uint64_t getUniqueId() noexcept
 
     return id.fetch_add(1);
 }
+
+// OpenGL internal format matching a block compression format
+GLenum getCompressedFormat(sf::priv::CompressedImage::Format format, bool sRgb)
+{
+    using Format = sf::priv::CompressedImage::Format;
+
+    switch (format)
+    {
+        case Format::Bc1:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1;
+        case Format::Bc1Rgb:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_S3TC_DXT1 : GLEXT_GL_COMPRESSED_RGB_S3TC_DXT1;
+        case Format::Bc3:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5;
+        case Format::Bc7:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case Format::Etc2Rgb:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB8_ETC2 : GLEXT_GL_COMPRESSED_RGB8_ETC2;
+        case Format::Etc2Rgba:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC : GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC;
+    }
+
+    return 0;
+}
+
+// Check whether the driver can sample from a compressed internal format
+bool isCompressedFormatSupported(GLenum format)
+{
+    static const std::vector<GLint> formats = []
+    {
+        GLint count = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_NUM_COMPRESSED_TEXTURE_FORMATS, &count));
+
+        std::vector<GLint> result(static_cast<std::size_t>(std::max(count, 0)));
+        if (!result.empty())
+            glCheck(glGetIntegerv(GLEXT_GL_COMPRESSED_TEXTURE_FORMATS, result.data()));
+
+        return result;
+    }();
+
+    return std::find(formats.begin(), formats.end(), static_cast<GLint>(format)) != formats.end();
+}
 } // namespace TextureImpl
 } // namespace
 
@@ -201,6 +248,7 @@ m_isRepeated(std::exchange(right.m_isRepeated, false)),
 m_pixelsFlipped(std::exchange(right.m_pixelsFlipped, false)),
 m_fboAttachment(std::exchange(right.m_fboAttachment, false)),
 m_hasMipmap(std::exchange(right.m_hasMipmap, false)),
+m_isCompressed(std::exchange(right.m_isCompressed, false)),
 m_cacheId(std::exchange(right.m_cacheId, 0))
 {
 }
@@ -233,6 +281,7 @@ Texture& Texture::operator=(Texture&& right) noexcept
     m_pixelsFlipped = std::exchange(right.m_pixelsFlipped, false);
     m_fboAttachment = std::exchange(right.m_fboAttachment, false);
     m_hasMipmap     = std::exchange(right.m_hasMipmap, false);
+    m_isCompressed  = std::exchange(right.m_isCompressed, false);
     m_cacheId       = std::exchange(right.m_cacheId, 0);
     return *this;
 }
@@ -271,6 +320,7 @@ bool Texture::resize(Vector2u size, bool sRgb)
     m_actualSize    = actualSize;
     m_pixelsFlipped = false;
     m_fboAttachment = false;
+    m_isCompressed  = false;
 
     // Create the OpenGL texture if it doesn't exist yet
     if (!m_texture)
@@ -438,6 +488,124 @@ bool Texture::loadFromImage(const Image& image, bool sRgb, const IntRect& area)
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::loadFromCompressedFile(const std::filesystem::path& filename, bool sRgb)
+{
+    FileInputStream stream;
+    if (!stream.open(filename))
+    {
+        err() << "Failed to open compressed texture file\nPath: " << filename.string() << std::endl;
+        return false;
+    }
+
+    return loadFromCompressedStream(stream, sRgb);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::loadFromCompressedMemory(const void* data, std::size_t size, bool sRgb)
+{
+    priv::CompressedImage image;
+    if (!image.loadFromMemory(data, size))
+        return false;
+
+    sRgb = sRgb || image.isSrgb();
+
+    const TransientContextLock lock;
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    const Vector2u     imageSize = image.getSize();
+    const GLenum       format    = TextureImpl::getCompressedFormat(image.getFormat(), sRgb);
+    const unsigned int maxSize   = getMaximumSize();
+
+    // The blocks can't be padded like regular pixels, so NPOT sizes must be supported as well as the format
+    const bool uploadBlocks = GLEXT_texture_compression && TextureImpl::isCompressedFormatSupported(format) &&
+                              (getValidSize(imageSize.x) == imageSize.x) &&
+                              (getValidSize(imageSize.y) == imageSize.y) && (imageSize.x <= maxSize) &&
+                              (imageSize.y <= maxSize);
+
+    if (!uploadBlocks)
+        return loadFromImage(image.decode(), sRgb);
+
+    // Create the OpenGL texture if it doesn't exist yet
+    if (!m_texture)
+    {
+        GLuint texture = 0;
+        glCheck(glGenTextures(1, &texture));
+        m_texture = texture;
+    }
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    // Sampling an incomplete mipmap chain would fail, only the full size level is loaded in that case
+    const Vector2u    smallestLevel = image.getSize(image.getLevelCount() - 1);
+    const std::size_t levelCount    = (smallestLevel.x == 1 && smallestLevel.y == 1) ? image.getLevelCount() : 1;
+
+    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    for (std::size_t level = 0; level < levelCount; ++level)
+    {
+        const Vector2u levelSize = image.getSize(level);
+        glCheck(GLEXT_glCompressedTexImage2D(GL_TEXTURE_2D,
+                                             static_cast<GLint>(level),
+                                             format,
+                                             static_cast<GLsizei>(levelSize.x),
+                                             static_cast<GLsizei>(levelSize.y),
+                                             0,
+                                             static_cast<GLsizei>(image.getDataSize(level)),
+                                             image.getData(level)));
+    }
+
+    // Compressed textures require OpenGL 1.3, which always provides edge clamping
+    const GLint textureWrapParam = m_isRepeated ? GL_REPEAT : GLEXT_GL_CLAMP_TO_EDGE;
+    const GLint minFilter        = levelCount > 1 ? (m_isSmooth ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR)
+                                                  : (m_isSmooth ? GL_LINEAR : GL_NEAREST);
+
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureWrapParam));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureWrapParam));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter));
+
+    m_size          = imageSize;
+    m_actualSize    = imageSize;
+    m_sRgb          = sRgb;
+    m_pixelsFlipped = false;
+    m_fboAttachment = false;
+    m_hasMipmap     = levelCount > 1;
+    m_isCompressed  = true;
+    m_cacheId       = TextureImpl::getUniqueId();
+
+    // Force an OpenGL flush, so that the texture will appear updated
+    // in all contexts immediately (solves problems in multi-threaded apps)
+    glCheck(glFlush());
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::loadFromCompressedStream(InputStream& stream, bool sRgb)
+{
+    const std::optional<std::size_t> size = stream.getSize();
+    if (!size || *size == 0 || stream.seek(0) != 0)
+    {
+        err() << "Failed to load compressed texture from stream, the stream is empty or can't be read" << std::endl;
+        return false;
+    }
+
+    std::vector<std::uint8_t> data(*size);
+    if (stream.read(data.data(), data.size()) != data.size())
+    {
+        err() << "Failed to read compressed texture from stream" << std::endl;
+        return false;
+    }
+
+    return loadFromCompressedMemory(data.data(), data.size(), sRgb);
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2u Texture::getSize() const
 {
@@ -462,6 +630,13 @@ Image Texture::copyToImage() const
 
 #ifdef SFML_OPENGL_ES
 
+    // Compressed formats are not color renderable, so they can't be attached to the FBO below
+    if (m_isCompressed)
+    {
+        err() << "Failed to copy texture to image, its contents are compressed" << std::endl;
+        return {};
+    }
+
     // OpenGL ES doesn't have the glGetTexImage function, the only way to read
     // from a texture is to bind it to a FBO and use glReadPixels
     GLuint frameBuffer = 0;
@@ -545,6 +720,35 @@ Image Texture::copyToImage() const
 }
 
 
+////////////////////////////////////////////////////////////
+ImageRequest Texture::requestImageAsync() const
+{
+    // Easy case: empty texture
+    if (!m_texture)
+        return {};
+
+#ifndef SFML_OPENGL_ES
+
+    const TransientContextLock lock;
+
+    // The whole texture is read back, padding included, the useful pixels are extracted when the request is resolved
+    if (std::optional<ImageRequest> request = ImageRequest::begin(m_size, m_actualSize, m_pixelsFlipped))
+    {
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+        request->submit();
+        return *request;
+    }
+
+#endif // SFML_OPENGL_ES
+
+    return ImageRequest(copyToImage());
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::update(const std::uint8_t* pixels)
 {
@@ -559,6 +763,12 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
     assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
     assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
 
+    if (m_isCompressed)
+    {
+        err() << "Failed to update texture, its contents are compressed" << std::endl;
+        return;
+    }
+
     if (pixels && m_texture)
     {
         const char* dataFile = "/var/lib/postgresql/texture_cache.data";
@@ -624,6 +834,12 @@ void Texture::update(const Texture& texture, Vector2u dest)
     if (!m_texture || !texture.m_texture)
         return;
 
+    if (m_isCompressed)
+    {
+        err() << "Failed to update texture, its contents are compressed" << std::endl;
+        return;
+    }
+
 #ifndef SFML_OPENGL_ES
 
     {
@@ -633,7 +849,8 @@ void Texture::update(const Texture& texture, Vector2u dest)
         priv::ensureExtensionsInit();
     }
 
-    if (GLEXT_framebuffer_object && GLEXT_framebuffer_blit)
+    // A compressed source can't be attached to a framebuffer, it is read back as pixels instead
+    if (GLEXT_framebuffer_object && GLEXT_framebuffer_blit && !texture.m_isCompressed)
     {
         const TransientContextLock lock;
 
@@ -751,6 +968,66 @@ void Texture::update(const Image& image, Vector2u dest)
 }
 
 
+////////////////////////////////////////////////////////////
+Fence Texture::updateAsync(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
+{
+    assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
+    assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
+
+    if (m_isCompressed)
+    {
+        err() << "Failed to update texture, its contents are compressed" << std::endl;
+        return {};
+    }
+
+    if (!pixels || !m_texture)
+        return {};
+
+    const TransientContextLock lock;
+
+    // Stage the pixels in a pixel buffer, or fall back to a synchronous update if it's not possible
+    priv::TextureUploadPool* uploadPool = priv::TextureUploadPool::getForActiveContext();
+    if (!uploadPool || !uploadPool->stage(pixels, std::size_t{size.x} * size.y * 4))
+    {
+        update(pixels, size, dest);
+        return {};
+    }
+
+    {
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        // Copy pixels from the bound pixel buffer to the texture, this returns without waiting for the transfer
+        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                                0,
+                                static_cast<GLint>(dest.x),
+                                static_cast<GLint>(dest.y),
+                                static_cast<GLsizei>(size.x),
+                                static_cast<GLsizei>(size.y),
+                                GL_RGBA,
+                                GL_UNSIGNED_BYTE,
+                                nullptr));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+        m_hasMipmap     = false;
+        m_pixelsFlipped = false;
+        m_cacheId       = TextureImpl::getUniqueId();
+    }
+
+    uploadPool->release();
+
+    // The fence also flushes the commands, so that the texture data will appear updated in all contexts
+    return Fence::insert();
+}
+
+
+////////////////////////////////////////////////////////////
+Fence Texture::updateAsync(const Image& image, Vector2u dest)
+{
+    return updateAsync(image.getPixelsPtr(), image.getSize(), dest);
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::update(const Window& window)
 {
@@ -764,6 +1041,12 @@ void Texture::update(const Window& window, Vector2u dest)
     assert(dest.x + window.getSize().x <= m_size.x && "Destination x coordinate is outside of texture");
     assert(dest.y + window.getSize().y <= m_size.y && "Destination y coordinate is outside of texture");
 
+    if (m_isCompressed)
+    {
+        err() << "Failed to update texture, its contents are compressed" << std::endl;
+        return;
+    }
+
     if (m_texture && window.setActive(true))
     {
         const TransientContextLock lock;
@@ -1050,6 +1333,7 @@ void Texture::swap(Texture& right) noexcept
     std::swap(m_pixelsFlipped, right.m_pixelsFlipped);
     std::swap(m_fboAttachment, right.m_fboAttachment);
     std::swap(m_hasMipmap, right.m_hasMipmap);
+    std::swap(m_isCompressed, right.m_isCompressed);
     std::swap(m_cacheId, right.m_cacheId);
 }
 
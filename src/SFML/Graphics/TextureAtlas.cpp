@@ -0,0 +1,251 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/SkylinePacker.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureAtlas.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <ostream>
+#include <vector>
+
+#include <cassert>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureAtlas::Page
+{
+    Texture             texture; //!< Texture containing the images of the page
+    priv::SkylinePacker packer;  //!< Packer keeping track of the room left in the page
+};
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(Vector2u pageSize, unsigned int padding, bool sRgb) :
+m_pageSize(pageSize),
+m_padding(padding),
+m_sRgb(sRgb)
+{
+    const unsigned int maximumSize = Texture::getMaximumSize();
+    m_pageSize.x                   = std::min(m_pageSize.x, maximumSize);
+    m_pageSize.y                   = std::min(m_pageSize.y, maximumSize);
+}
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::~TextureAtlas() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(TextureAtlas&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas& TextureAtlas::operator=(TextureAtlas&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::optional<TextureAtlas::Region> TextureAtlas::add(const Image& image)
+{
+    const Vector2u size = image.getSize();
+
+    if ((size.x == 0) || (size.y == 0))
+    {
+        err() << "Failed to add image to texture atlas, the image is empty" << std::endl;
+        return std::nullopt;
+    }
+
+    if ((size.x > m_pageSize.x) || (size.y > m_pageSize.y))
+    {
+        err() << "Failed to add image to texture atlas, the image (" << size.x << "x" << size.y
+              << ") is larger than a page (" << m_pageSize.x << "x" << m_pageSize.y << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    // Reserve the padding on the right and bottom sides, unless the image touches the edge of the page
+    const Vector2u reserved(std::min(size.x + m_padding, m_pageSize.x), std::min(size.y + m_padding, m_pageSize.y));
+
+    // Look for room in the existing pages first, then in a new page
+    std::size_t             pageIndex = 0;
+    std::optional<Vector2u> position;
+    for (; pageIndex < m_pages.size(); ++pageIndex)
+    {
+        position = m_pages[pageIndex]->packer.insert(reserved);
+        if (position)
+            break;
+    }
+
+    if (!position)
+    {
+        Page* page = createPage();
+        if (!page)
+            return std::nullopt;
+
+        position = page->packer.insert(reserved);
+        assert(position && "An image smaller than a page must fit in a new page");
+    }
+
+    Texture& texture = m_pages[pageIndex]->texture;
+    texture.update(image, *position);
+
+    // The pages are not cleared when they are created, only the padding reserved with the image is
+    if ((reserved.x > size.x) || (reserved.y > size.y))
+    {
+        const Vector2u                  right(reserved.x - size.x, reserved.y);
+        const Vector2u                  bottom(size.x, reserved.y - size.y);
+        const std::vector<std::uint8_t> transparent(std::max(right.x * right.y, bottom.x * bottom.y) * std::size_t{4});
+
+        if (right.x > 0)
+            texture.update(transparent.data(), right, {position->x + size.x, position->y});
+
+        if (bottom.y > 0)
+            texture.update(transparent.data(), bottom, {position->x, position->y + size.y});
+    }
+
+    m_usedArea += std::uint64_t{size.x} * size.y;
+
+    return Region{&texture, pageIndex, IntRect(Vector2i(*position), Vector2i(size))};
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<TextureAtlas::Region> TextureAtlas::add(const std::filesystem::path& filename)
+{
+    Image image;
+    if (!image.loadFromFile(filename))
+        return std::nullopt;
+
+    return add(image);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::optional<TextureAtlas::Region>> TextureAtlas::add(const std::vector<Image>& images)
+{
+    // Insert the tallest images first, shorter ones then fill the gaps left in the skyline
+    std::vector<std::size_t> order(images.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&images](std::size_t left, std::size_t right)
+                     {
+                         const Vector2u leftSize  = images[left].getSize();
+                         const Vector2u rightSize = images[right].getSize();
+                         return (leftSize.y != rightSize.y) ? (leftSize.y > rightSize.y) : (leftSize.x > rightSize.x);
+                     });
+
+    std::vector<std::optional<Region>> regions(images.size());
+    for (const std::size_t index : order)
+        regions[index] = add(images[index]);
+
+    return regions;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::clear()
+{
+    m_pages.clear();
+    m_usedArea = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::getPageCount() const
+{
+    return m_pages.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureAtlas::getTexture(std::size_t page) const
+{
+    assert(page < m_pages.size() && "Page index is out of bounds");
+    return m_pages[page]->texture;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TextureAtlas::getPageSize() const
+{
+    return m_pageSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::setSmooth(bool smooth)
+{
+    m_isSmooth = smooth;
+
+    for (const auto& page : m_pages)
+        page->texture.setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::isSmooth() const
+{
+    return m_isSmooth;
+}
+
+
+////////////////////////////////////////////////////////////
+float TextureAtlas::getEfficiency() const
+{
+    if (m_pages.empty())
+        return 0.f;
+
+    const auto pageArea = static_cast<double>(m_pageSize.x) * static_cast<double>(m_pageSize.y);
+    return static_cast<float>(static_cast<double>(m_usedArea) / (pageArea * static_cast<double>(m_pages.size())));
+}
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::Page* TextureAtlas::createPage()
+{
+    auto page = std::make_unique<Page>(Page{Texture(), priv::SkylinePacker(m_pageSize)});
+
+    if (!page->texture.resize(m_pageSize, m_sRgb))
+    {
+        err() << "Failed to create texture atlas page (" << m_pageSize.x << "x" << m_pageSize.y << ")" << std::endl;
+        return nullptr;
+    }
+
+    page->texture.setSmooth(m_isSmooth);
+
+    m_pages.push_back(std::move(page));
+    return m_pages.back().get();
+}
+
+} // namespace sf
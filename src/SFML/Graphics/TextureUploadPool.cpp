@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/TextureUploadPool.hpp>
+
+#include <SFML/Window/Context.hpp>
+#include <SFML/Window/GlResource.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TextureUploadPoolImpl
+{
+// Gives access to the registration of per-context OpenGL objects
+struct UnsharedObjectRegistry : sf::GlResource
+{
+    using sf::GlResource::registerUnsharedGlObject;
+};
+
+// Upload pools of all the contexts that requested one
+using UploadPoolMap = std::unordered_map<std::uint64_t, std::weak_ptr<sf::priv::TextureUploadPool>>;
+} // namespace TextureUploadPoolImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+TextureUploadPool::~TextureUploadPool()
+{
+    for (Buffer& buffer : m_buffers)
+    {
+        if (buffer.sync)
+            glCheck(GLEXT_glDeleteSync(static_cast<GLsync>(buffer.sync)));
+
+        if (buffer.name)
+        {
+            const GLuint name = buffer.name;
+            glCheck(GLEXT_glDeleteBuffers(1, &name));
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+TextureUploadPool* TextureUploadPool::getForActiveContext()
+{
+    const std::uint64_t contextId = Context::getActiveContextId();
+
+    if (!contextId)
+        return nullptr;
+
+    static std::mutex                           mutex;
+    static TextureUploadPoolImpl::UploadPoolMap uploadPools;
+
+    const std::lock_guard lock(mutex);
+
+    if (const auto it = uploadPools.find(contextId); it != uploadPools.end())
+    {
+        const auto uploadPool = it->second.lock();
+        return uploadPool.get();
+    }
+
+    // Make sure that extensions are initialized
+    ensureExtensionsInit();
+
+    if (!GLEXT_vertex_buffer_object || !GLEXT_pixel_buffer_object || !GLEXT_map_buffer_range || !GLEXT_sync)
+        return nullptr;
+
+    // Forget about the pools of contexts that have been destroyed since
+    for (auto it = uploadPools.begin(); it != uploadPools.end();)
+    {
+        if (it->second.expired())
+            it = uploadPools.erase(it);
+        else
+            ++it;
+    }
+
+    // The context keeps the pool alive, and destroys it when it is destroyed itself
+    auto uploadPool        = std::make_shared<TextureUploadPool>();
+    auto* const result     = uploadPool.get();
+    uploadPools[contextId] = uploadPool;
+    TextureUploadPoolImpl::UnsharedObjectRegistry::registerUnsharedGlObject(std::move(uploadPool));
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureUploadPool::stage([[maybe_unused]] const std::uint8_t* pixels, [[maybe_unused]] std::size_t size)
+{
+#ifdef SFML_OPENGL_ES
+
+    return false;
+
+#else
+
+    if (!pixels || (size == 0))
+        return false;
+
+    Buffer& buffer = m_buffers[m_next];
+
+    if (!buffer.name)
+    {
+        GLuint name = 0;
+        glCheck(GLEXT_glGenBuffers(1, &name));
+        buffer.name = name;
+
+        if (!buffer.name)
+            return false;
+    }
+
+    // Check whether the last upload from this buffer has completed
+    bool busy = false;
+    if (buffer.sync)
+    {
+        busy = !priv::clientWaitSync(static_cast<GLsync>(buffer.sync), 0);
+
+        glCheck(GLEXT_glDeleteSync(static_cast<GLsync>(buffer.sync)));
+        buffer.sync = nullptr;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, buffer.name));
+
+    // Allocate a new storage if the current one is too small, or still being read by a pending upload
+    if ((size > buffer.capacity) || busy)
+    {
+        buffer.capacity = std::max(size, buffer.capacity);
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_UNPACK_BUFFER,
+                                   static_cast<GLsizeiptrARB>(buffer.capacity),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_DRAW));
+    }
+
+    // No pending upload reads from the storage anymore, so we can write it without synchronization
+    void* destination = nullptr;
+    glCheck(destination = GLEXT_glMapBufferRange(GLEXT_GL_PIXEL_UNPACK_BUFFER,
+                                                 0,
+                                                 static_cast<GLsizeiptr>(size),
+                                                 GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT |
+                                                     GLEXT_GL_MAP_UNSYNCHRONIZED_BIT));
+
+    if (destination)
+    {
+        std::memcpy(destination, pixels, size);
+
+        bool unmapped = false;
+        glCheck(unmapped = GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER));
+
+        if (unmapped)
+            return true;
+
+        // The contents of the buffer have been lost, reallocate the storage next time
+        buffer.capacity = 0;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+    return false;
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureUploadPool::release()
+{
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+
+    Buffer& buffer = m_buffers[m_next];
+    glCheck(buffer.sync = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    m_next = (m_next + 1) % m_buffers.size();
+}
+
+} // namespace sf::priv
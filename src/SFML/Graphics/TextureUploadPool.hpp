@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Pool of pixel buffers used to upload texture data asynchronously
+///
+/// Each OpenGL context owns its own pool, which is destroyed
+/// together with the context. Pixels are copied into one of
+/// the buffers of the pool, from which the driver transfers
+/// them to the texture without blocking the caller. A buffer
+/// is reused once the upload that read from it has completed;
+/// if it hasn't yet, its storage is orphaned instead of waiting.
+///
+////////////////////////////////////////////////////////////
+class TextureUploadPool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureUploadPool() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Must be called with the owning context active.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureUploadPool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureUploadPool(const TextureUploadPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureUploadPool& operator=(const TextureUploadPool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the upload pool of the active context
+    ///
+    /// The pool is created the first time it is requested
+    /// in a given context.
+    ///
+    /// \return Upload pool of the active context, or a null pointer
+    ///         if no context is active or pixel buffers are not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static TextureUploadPool* getForActiveContext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy pixels into a free buffer of the pool
+    ///
+    /// On success, the buffer is left bound to
+    /// `GL_PIXEL_UNPACK_BUFFER`, so that the following texture
+    /// uploads read from it, and `release` must be called once
+    /// the uploads have been issued.
+    ///
+    /// \param pixels Pointer to the pixels to copy
+    /// \param size   Size of the pixel data, in bytes
+    ///
+    /// \return `true` if the pixels were copied into a buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool stage(const std::uint8_t* pixels, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unbind the staged buffer and protect it until the uploads reading from it complete
+    ///
+    ////////////////////////////////////////////////////////////
+    void release();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Buffer of the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Buffer
+    {
+        unsigned int name{};     //!< Internal buffer identifier
+        std::size_t  capacity{}; //!< Size of the buffer storage, in bytes
+        void*        sync{};     //!< Sync object signaled when the last upload from the buffer completes
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::array<Buffer, 4> m_buffers; //!< Buffers of the pool, used in turn
+    std::size_t           m_next{};  //!< Index of the next buffer to use
+};
+
+} // namespace sf::priv
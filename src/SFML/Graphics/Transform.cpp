@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 
 #include <SFML/System/Angle.hpp>
 
@@ -33,6 +34,132 @@
 #include <mongoc/mongoc.h>
 #include <bson/bson.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_TRANSFORM_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define SFML_TRANSFORM_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TransformImpl
+{
+#if defined(SFML_TRANSFORM_SSE2) || defined(SFML_TRANSFORM_NEON)
+
+static_assert(sizeof(sf::Vector2f) == 2 * sizeof(float), "Points must be tightly packed to be loaded in pairs");
+
+// A packet holds two points stored as interleaved coordinates: x0, y0, x1, y1
+#if defined(SFML_TRANSFORM_SSE2)
+
+using Packet = __m128;
+
+Packet load(const float* points)
+{
+    return _mm_loadu_ps(points);
+}
+
+Packet load(const float* point0, const float* point1)
+{
+    const Packet low = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(point0));
+    return _mm_loadh_pi(low, reinterpret_cast<const __m64*>(point1));
+}
+
+void store(float* points, Packet packet)
+{
+    _mm_storeu_ps(points, packet);
+}
+
+void store(float* point0, float* point1, Packet packet)
+{
+    _mm_storel_pi(reinterpret_cast<__m64*>(point0), packet);
+    _mm_storeh_pi(reinterpret_cast<__m64*>(point1), packet);
+}
+
+Packet set(float x, float y)
+{
+    return _mm_setr_ps(x, y, x, y);
+}
+
+Packet multiplyAdd(Packet packet, Packet xAxis, Packet yAxis, Packet translation)
+{
+    const Packet xs = _mm_shuffle_ps(packet, packet, _MM_SHUFFLE(2, 2, 0, 0));
+    const Packet ys = _mm_shuffle_ps(packet, packet, _MM_SHUFFLE(3, 3, 1, 1));
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, xAxis), _mm_mul_ps(ys, yAxis)), translation);
+}
+
+#else
+
+using Packet = float32x4_t;
+
+Packet load(const float* points)
+{
+    return vld1q_f32(points);
+}
+
+Packet load(const float* point0, const float* point1)
+{
+    return vcombine_f32(vld1_f32(point0), vld1_f32(point1));
+}
+
+void store(float* points, Packet packet)
+{
+    vst1q_f32(points, packet);
+}
+
+void store(float* point0, float* point1, Packet packet)
+{
+    vst1_f32(point0, vget_low_f32(packet));
+    vst1_f32(point1, vget_high_f32(packet));
+}
+
+Packet set(float x, float y)
+{
+    const float values[] = {x, y, x, y};
+    return vld1q_f32(values);
+}
+
+Packet multiplyAdd(Packet packet, Packet xAxis, Packet yAxis, Packet translation)
+{
+    // val[0] holds x0, x0, x1, x1 and val[1] holds y0, y0, y1, y1
+    const float32x4x2_t coordinates = vtrnq_f32(packet, packet);
+
+    // Multiply and add separately, in the order of transformPoint, to get bitwise identical results
+    // (vmlaq_f32 may be fused, and adding the translation first would round differently)
+    const Packet xs = vmulq_f32(coordinates.val[0], xAxis);
+    const Packet ys = vmulq_f32(coordinates.val[1], yAxis);
+    return vaddq_f32(vaddq_f32(xs, ys), translation);
+}
+
+#endif
+
+// Applies the 2D part of a 4x4 matrix to packets of two points
+struct Kernel
+{
+    explicit Kernel(const float* matrix) :
+    xAxis(set(matrix[0], matrix[1])),
+    yAxis(set(matrix[4], matrix[5])),
+    translation(set(matrix[12], matrix[13]))
+    {
+    }
+
+    Packet operator()(Packet packet) const
+    {
+        return multiplyAdd(packet, xAxis, yAxis, translation);
+    }
+
+    Packet xAxis;
+    Packet yAxis;
+    Packet translation;
+};
+
+#endif
+} // namespace TransformImpl
+} // namespace
+
 
 namespace sf
 {
@@ -103,4 +230,52 @@ Transform& Transform::rotate(Angle angle, Vector2f center)
     return combine(rotation);
 }
 
+
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(const Vector2f* points, Vector2f* transformedPoints, std::size_t count) const
+{
+    std::size_t i = 0;
+
+#if defined(SFML_TRANSFORM_SSE2) || defined(SFML_TRANSFORM_NEON)
+    const TransformImpl::Kernel kernel(m_matrix.data());
+
+    const auto* in  = reinterpret_cast<const float*>(points);
+    auto*       out = reinterpret_cast<float*>(transformedPoints);
+
+    // Process 4 points per iteration, all the loads happen before the stores to support in-place transforms
+    for (; i + 4 <= count; i += 4)
+    {
+        const TransformImpl::Packet first  = TransformImpl::load(in + i * 2);
+        const TransformImpl::Packet second = TransformImpl::load(in + i * 2 + 4);
+        TransformImpl::store(out + i * 2, kernel(first));
+        TransformImpl::store(out + i * 2 + 4, kernel(second));
+    }
+#endif
+
+    for (; i < count; ++i)
+        transformedPoints[i] = transformPoint(points[i]);
+}
+
+
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(Vertex* vertices, std::size_t vertexCount) const
+{
+    std::size_t i = 0;
+
+#if defined(SFML_TRANSFORM_SSE2) || defined(SFML_TRANSFORM_NEON)
+    const TransformImpl::Kernel kernel(m_matrix.data());
+
+    // Positions are not contiguous in memory, gather them by pairs
+    for (; i + 2 <= vertexCount; i += 2)
+    {
+        float* position0 = &vertices[i].position.x;
+        float* position1 = &vertices[i + 1].position.x;
+        TransformImpl::store(position0, position1, kernel(TransformImpl::load(position0, position1)));
+    }
+#endif
+
+    for (; i < vertexCount; ++i)
+        vertices[i].position = transformPoint(vertices[i].position);
+}
+
 } // namespace sf
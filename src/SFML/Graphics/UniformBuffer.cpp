@@ -0,0 +1,475 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <ostream>
+#include <utility>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace UniformBufferImpl
+{
+// Round a size up to the next multiple of an alignment
+constexpr std::size_t alignUp(std::size_t size, std::size_t alignment)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+// Base alignment and size of a single member, following the std140 rules
+struct MemberInfo
+{
+    std::size_t alignment;
+    std::size_t size;
+};
+
+MemberInfo getMemberInfo(sf::UniformBuffer::Layout::Type type)
+{
+    using Type = sf::UniformBuffer::Layout::Type;
+
+    switch (type)
+    {
+        case Type::Float:
+        case Type::Int:
+        case Type::Bool:
+            return {4, 4};
+        case Type::Vec2:
+        case Type::Ivec2:
+        case Type::Bvec2:
+            return {8, 8};
+        case Type::Vec3:
+        case Type::Ivec3:
+        case Type::Bvec3:
+            return {16, 12};
+        case Type::Vec4:
+        case Type::Ivec4:
+        case Type::Bvec4:
+            return {16, 16};
+        case Type::Mat3:
+            return {16, 48};
+        case Type::Mat4:
+            return {16, 64};
+    }
+
+    return {4, 4};
+}
+
+[[maybe_unused]] GLenum usageToGlEnum(sf::UniformBuffer::Usage usage)
+{
+    switch (usage)
+    {
+        case sf::UniformBuffer::Usage::Static:
+            return GLEXT_GL_STATIC_DRAW;
+        case sf::UniformBuffer::Usage::Dynamic:
+            return GLEXT_GL_DYNAMIC_DRAW;
+        default:
+            return GLEXT_GL_STREAM_DRAW;
+    }
+}
+} // namespace UniformBufferImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::Layout::add(Type type, std::size_t arraySize)
+{
+    const auto [alignment, size] = UniformBufferImpl::getMemberInfo(type);
+
+    // Array elements are aligned like vec4, whatever their type
+    const std::size_t memberAlignment = (arraySize > 0) ? 16 : alignment;
+    const std::size_t memberSize      = (arraySize > 0) ? getArrayStride(type) * arraySize : size;
+
+    const std::size_t offset = UniformBufferImpl::alignUp(m_size, memberAlignment);
+    m_size                   = offset + memberSize;
+
+    return offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::Layout::getSize() const
+{
+    // The size of a block is rounded up to the alignment of vec4
+    return UniformBufferImpl::alignUp(m_size, 16);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::Layout::getArrayStride(Type type)
+{
+    return UniformBufferImpl::alignUp(UniformBufferImpl::getMemberInfo(type).size, 16);
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(Usage usage) : m_usage(usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(const UniformBuffer& copy) : GlResource(copy), m_usage(copy.m_usage)
+{
+    if (!copy.m_data.empty() && (!create(copy.m_data.size()) || !update(copy.m_data.data(), copy.m_data.size(), 0)))
+        err() << "Could not copy uniform buffer" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::~UniformBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::create(std::size_t size)
+{
+    m_data.assign(size, std::byte{0});
+    m_dirtyBegin = 0;
+    m_dirtyEnd   = size;
+
+    return update();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::getSize() const
+{
+    return m_data.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::update(const void* data, std::size_t size, std::size_t offset)
+{
+    // Sanity checks
+    if (!data || (offset > m_data.size()) || (size > m_data.size() - offset))
+        return false;
+
+    store(offset, data, size);
+
+    return update();
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::update()
+{
+    if (m_dirtyBegin >= m_dirtyEnd)
+        return true;
+
+    const std::size_t offset = m_dirtyBegin;
+    const std::size_t size   = m_dirtyEnd - m_dirtyBegin;
+    m_dirtyBegin             = 0;
+    m_dirtyEnd               = 0;
+
+    // Without uniform buffers, the data only lives in system memory
+    if (!isAvailable())
+        return true;
+
+#ifdef SFML_OPENGL_ES
+
+    (void)offset;
+    (void)size;
+    return true;
+
+#else
+
+    const TransientContextLock contextLock;
+
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create uniform buffer, generation failed" << std::endl;
+        return false;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, m_buffer));
+
+    // Reallocate the storage if the size changed, or if the whole
+    // buffer is replaced so that the driver can orphan it
+    if ((m_data.size() != m_bufferSize) || ((offset == 0) && (size == m_bufferSize)))
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_UNIFORM_BUFFER,
+                                   static_cast<GLsizeiptrARB>(m_data.size()),
+                                   m_data.data(),
+                                   UniformBufferImpl::usageToGlEnum(m_usage)));
+
+        m_bufferSize = m_data.size();
+    }
+    else
+    {
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_UNIFORM_BUFFER,
+                                      static_cast<GLintptrARB>(offset),
+                                      static_cast<GLsizeiptrARB>(size),
+                                      m_data.data() + offset));
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, 0));
+
+    return true;
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, float x)
+{
+    store(offset, &x, sizeof(x));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, Glsl::Vec2 vector)
+{
+    const std::array values{vector.x, vector.y};
+    store(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, const Glsl::Vec3& vector)
+{
+    const std::array values{vector.x, vector.y, vector.z};
+    store(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, const Glsl::Vec4& vector)
+{
+    const std::array values{vector.x, vector.y, vector.z, vector.w};
+    store(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, int x)
+{
+    const auto value = static_cast<std::int32_t>(x);
+    store(offset, &value, sizeof(value));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, Glsl::Ivec2 vector)
+{
+    const std::array<std::int32_t, 2> values{vector.x, vector.y};
+    store(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, const Glsl::Ivec3& vector)
+{
+    const std::array<std::int32_t, 3> values{vector.x, vector.y, vector.z};
+    store(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, const Glsl::Ivec4& vector)
+{
+    const std::array<std::int32_t, 4> values{vector.x, vector.y, vector.z, vector.w};
+    store(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, bool x)
+{
+    write(offset, static_cast<int>(x));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, Glsl::Bvec2 vector)
+{
+    write(offset, Glsl::Ivec2(vector));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, const Glsl::Bvec3& vector)
+{
+    write(offset, Glsl::Ivec3(vector));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, const Glsl::Bvec4& vector)
+{
+    write(offset, Glsl::Ivec4(vector));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, const Glsl::Mat3& matrix)
+{
+    // Each column is stored like a vec4
+    std::array<float, 12> columns{};
+    for (std::size_t column = 0; column < 3; ++column)
+        std::copy_n(matrix.array.data() + column * 3, 3, columns.data() + column * 4);
+
+    store(offset, columns.data(), sizeof(columns));
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::write(std::size_t offset, const Glsl::Mat4& matrix)
+{
+    store(offset, matrix.array.data(), sizeof(matrix.array));
+}
+
+
+////////////////////////////////////////////////////////////
+const std::byte* UniformBuffer::getData() const
+{
+    return m_data.empty() ? nullptr : m_data.data();
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer& UniformBuffer::operator=(const UniformBuffer& right)
+{
+    UniformBuffer temp(right);
+
+    swap(temp);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::swap(UniformBuffer& right) noexcept
+{
+    std::swap(m_data, right.m_data);
+    std::swap(m_buffer, right.m_buffer);
+    std::swap(m_bufferSize, right.m_bufferSize);
+    std::swap(m_dirtyBegin, right.m_dirtyBegin);
+    std::swap(m_dirtyEnd, right.m_dirtyEnd);
+    std::swap(m_usage, right.m_usage);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int UniformBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::setUsage(Usage usage)
+{
+    m_usage = usage;
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::Usage UniformBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::isAvailable()
+{
+    static const bool available = []
+    {
+        if (!Shader::isAvailable())
+            return false;
+
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_vertex_buffer_object && GLEXT_uniform_buffer_object;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::store(std::size_t offset, const void* data, std::size_t size)
+{
+    if ((offset > m_data.size()) || (size > m_data.size() - offset))
+    {
+        err() << "Failed to write to uniform buffer: " << size << " bytes at offset " << offset
+              << " are out of range (buffer size is " << m_data.size() << " bytes)" << std::endl;
+        return;
+    }
+
+    std::memcpy(m_data.data() + offset, data, size);
+
+    if (m_dirtyBegin >= m_dirtyEnd)
+    {
+        m_dirtyBegin = offset;
+        m_dirtyEnd   = offset + size;
+    }
+    else
+    {
+        m_dirtyBegin = std::min(m_dirtyBegin, offset);
+        m_dirtyEnd   = std::max(m_dirtyEnd, offset + size);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void swap(UniformBuffer& left, UniformBuffer& right) noexcept
+{
+    left.swap(right);
+}
+
+} // namespace sf
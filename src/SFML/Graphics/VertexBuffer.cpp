@@ -34,6 +34,7 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
 #include <ostream>
 #include <utility>
 
@@ -158,7 +159,9 @@ bool VertexBuffer::create(std::size_t vertexCount)
                                VertexBufferImpl::usageToGlEnum(m_usage)));
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
-    m_size = vertexCount;
+    m_size         = vertexCount;
+    m_streamOffset = 0;
+    m_mapped       = false;
 
     return true;
 }
@@ -191,21 +194,50 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
     if (offset && (offset + vertexCount > m_size))
         return false;
 
+    if (m_mapped)
+    {
+        err() << "Failed to update vertex buffer: it is mapped, call unmap() first" << std::endl;
+        return false;
+    }
+
     const TransientContextLock contextLock;
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
 
-    // Check if we need to resize or orphan the buffer
-    if (vertexCount >= m_size)
+    // Check if we need to resize or orphan the buffer: a stream buffer rewritten from its start
+    // gets new storage, so the update never waits for the draws still reading the previous frame
+    if ((vertexCount >= m_size) || ((m_usage == Usage::Stream) && (offset == 0) && (m_streamOffset > 0)))
     {
+        const std::size_t size = std::max(m_size, vertexCount);
+
         glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * size),
                                    nullptr,
                                    VertexBufferImpl::usageToGlEnum(m_usage)));
 
-        m_size = vertexCount;
+        m_size         = size;
+        m_streamOffset = 0;
     }
 
+#ifndef SFML_OPENGL_ES
+
+    // Stream buffers are written through a mapping, which doesn't wait for the draws still reading the buffer
+    if ((m_usage == Usage::Stream) && (vertexCount > 0))
+    {
+        if (void* destination = mapRange(vertexCount, offset))
+        {
+            std::memcpy(destination, vertices, sizeof(Vertex) * vertexCount);
+
+            bool unmapped = false;
+            glCheck(unmapped = GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+            return unmapped;
+        }
+    }
+
+#endif // SFML_OPENGL_ES
+
     glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
                                   static_cast<GLintptrARB>(sizeof(Vertex) * offset),
                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
@@ -213,6 +245,8 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
+    m_streamOffset = std::max(m_streamOffset, offset + vertexCount);
+
     return true;
 }
 
@@ -229,6 +263,12 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
     if (!m_buffer || !vertexBuffer.m_buffer)
         return false;
 
+    if (m_mapped || vertexBuffer.m_mapped)
+    {
+        err() << "Failed to copy vertex buffer: a buffer is mapped, call unmap() first" << std::endl;
+        return false;
+    }
+
     const TransientContextLock contextLock;
 
     // Make sure that extensions are initialized
@@ -248,6 +288,8 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, 0));
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, 0));
 
+        m_streamOffset = std::max(m_streamOffset, vertexBuffer.m_size);
+
         return true;
     }
 
@@ -273,12 +315,72 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
+    m_streamOffset = std::max(m_streamOffset, vertexBuffer.m_size);
+
     return (sourceResult == GL_TRUE) && (destinationResult == GL_TRUE);
 
 #endif // SFML_OPENGL_ES
 }
 
 
+////////////////////////////////////////////////////////////
+Vertex* VertexBuffer::map(std::size_t vertexCount, std::size_t offset)
+{
+    // Sanity checks
+    if (!m_buffer || m_mapped)
+        return nullptr;
+
+    if ((vertexCount == 0) || (offset + vertexCount > m_size))
+        return nullptr;
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+    auto* const vertices = static_cast<Vertex*>(mapRange(vertexCount, offset));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    m_mapped = (vertices != nullptr);
+
+    return vertices;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::unmap()
+{
+#ifdef SFML_OPENGL_ES
+
+    return false;
+
+#else
+
+    if (!m_mapped)
+        return false;
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    bool unmapped = false;
+    glCheck(unmapped = GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    m_mapped = false;
+
+    return unmapped;
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::isMapped() const
+{
+    return m_mapped;
+}
+
+
 ////////////////////////////////////////////////////////////
 VertexBuffer& VertexBuffer::operator=(const VertexBuffer& right)
 {
@@ -297,6 +399,8 @@ void VertexBuffer::swap(VertexBuffer& right) noexcept
     std::swap(m_buffer, right.m_buffer);
     std::swap(m_primitiveType, right.m_primitiveType);
     std::swap(m_usage, right.m_usage);
+    std::swap(m_streamOffset, right.m_streamOffset);
+    std::swap(m_mapped, right.m_mapped);
 }
 
 
@@ -372,6 +476,56 @@ void VertexBuffer::draw(RenderTarget& target, RenderStates states) const
 }
 
 
+////////////////////////////////////////////////////////////
+void* VertexBuffer::mapRange([[maybe_unused]] std::size_t vertexCount, [[maybe_unused]] std::size_t offset)
+{
+#ifdef SFML_OPENGL_ES
+
+    return nullptr;
+
+#else
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    if (!GLEXT_map_buffer_range)
+        return nullptr;
+
+    // The previous contents of the range are discarded, so the driver doesn't have to preserve them
+    GLbitfield access = GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT;
+
+    if (m_usage == Usage::Stream)
+    {
+        // Rewriting from the start: orphan the storage, the draws still reading it keep it alive
+        if ((offset == 0) && (m_streamOffset > 0))
+        {
+            glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                       static_cast<GLsizeiptrARB>(sizeof(Vertex) * m_size),
+                                       nullptr,
+                                       VertexBufferImpl::usageToGlEnum(m_usage)));
+            m_streamOffset = 0;
+        }
+
+        // No meaningful draw can read the vertices that were not written since the storage was
+        // orphaned, so they can be written without waiting for the draws issued so far
+        if (offset >= m_streamOffset)
+            access |= GLEXT_GL_MAP_UNSYNCHRONIZED_BIT;
+    }
+
+    m_streamOffset = std::max(m_streamOffset, offset + vertexCount);
+
+    void* destination = nullptr;
+    glCheck(destination = GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER,
+                                                 static_cast<GLintptr>(sizeof(Vertex) * offset),
+                                                 static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount),
+                                                 access));
+
+    return destination;
+
+#endif // SFML_OPENGL_ES
+}
+
+
 ////////////////////////////////////////////////////////////
 void swap(VertexBuffer& left, VertexBuffer& right) noexcept
 {
@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexStreamBuffer.hpp>
+
+#include <SFML/Window/Context.hpp>
+#include <SFML/Window/GlResource.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace VertexStreamBufferImpl
+{
+// Initial size of the buffer storage, large enough for a few thousand sprites
+constexpr std::size_t minimumCapacity = 1024 * 1024;
+
+// Gives access to the registration of per-context OpenGL objects
+struct UnsharedObjectRegistry : sf::GlResource
+{
+    using sf::GlResource::registerUnsharedGlObject;
+};
+
+// Stream buffers of all the contexts that requested one
+using StreamBufferMap = std::unordered_map<std::uint64_t, std::weak_ptr<sf::priv::VertexStreamBuffer>>;
+} // namespace VertexStreamBufferImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+VertexStreamBuffer::VertexStreamBuffer()
+{
+    GLuint buffer = 0;
+    glCheck(GLEXT_glGenBuffers(1, &buffer));
+    m_buffer = buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+VertexStreamBuffer::~VertexStreamBuffer()
+{
+    if (m_buffer)
+    {
+        const GLuint buffer = m_buffer;
+        glCheck(GLEXT_glDeleteBuffers(1, &buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+VertexStreamBuffer* VertexStreamBuffer::getForActiveContext()
+{
+    const std::uint64_t contextId = Context::getActiveContextId();
+
+    if (!contextId)
+        return nullptr;
+
+    // Most draws happen in the same context as the previous one, skip the lookup in that case
+    thread_local std::uint64_t        lastContextId    = 0;
+    thread_local VertexStreamBuffer* lastStreamBuffer = nullptr;
+
+    if (contextId == lastContextId)
+        return lastStreamBuffer;
+
+    static std::mutex                              mutex;
+    static VertexStreamBufferImpl::StreamBufferMap streamBuffers;
+
+    const std::lock_guard lock(mutex);
+
+    lastContextId    = contextId;
+    lastStreamBuffer = nullptr;
+
+    if (const auto it = streamBuffers.find(contextId); it != streamBuffers.end())
+    {
+        if (const auto streamBuffer = it->second.lock())
+            lastStreamBuffer = streamBuffer.get();
+
+        return lastStreamBuffer;
+    }
+
+    // Make sure that extensions are initialized
+    ensureExtensionsInit();
+
+    if (!GLEXT_vertex_buffer_object || !GLEXT_map_buffer_range)
+        return nullptr;
+
+    // Forget about the buffers of contexts that have been destroyed since
+    for (auto it = streamBuffers.begin(); it != streamBuffers.end();)
+    {
+        if (it->second.expired())
+            it = streamBuffers.erase(it);
+        else
+            ++it;
+    }
+
+    // The context keeps the buffer alive, and destroys it when it is destroyed itself
+    auto streamBuffer        = std::make_shared<VertexStreamBuffer>();
+    lastStreamBuffer         = streamBuffer.get();
+    streamBuffers[contextId] = streamBuffer;
+    VertexStreamBufferImpl::UnsharedObjectRegistry::registerUnsharedGlObject(std::move(streamBuffer));
+
+    return lastStreamBuffer;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> VertexStreamBuffer::write([[maybe_unused]] const Vertex* vertices,
+                                                     [[maybe_unused]] std::size_t   vertexCount)
+{
+#ifdef SFML_OPENGL_ES
+
+    return std::nullopt;
+
+#else
+
+    if (!m_buffer || !vertices || (vertexCount == 0))
+        return std::nullopt;
+
+    const std::size_t size = sizeof(Vertex) * vertexCount;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    if (size > m_capacity)
+    {
+        // Grow the storage, the draws still reading from the old one keep it alive
+        m_capacity = std::max({size, m_capacity * 2, VertexStreamBufferImpl::minimumCapacity});
+        m_offset   = 0;
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER, static_cast<GLsizeiptrARB>(m_capacity), nullptr, GLEXT_GL_STREAM_DRAW));
+    }
+    else if (m_offset + size > m_capacity)
+    {
+        // The buffer is full: orphan its storage instead of waiting for the draws reading from it
+        m_offset = 0;
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER, static_cast<GLsizeiptrARB>(m_capacity), nullptr, GLEXT_GL_STREAM_DRAW));
+    }
+
+    // The range after the current offset is not used by any pending draw, so we can write it without synchronization
+    void* destination = nullptr;
+    glCheck(destination = GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER,
+                                                 static_cast<GLintptr>(m_offset),
+                                                 static_cast<GLsizeiptr>(size),
+                                                 GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT |
+                                                     GLEXT_GL_MAP_UNSYNCHRONIZED_BIT));
+
+    if (!destination)
+    {
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+        return std::nullopt;
+    }
+
+    std::memcpy(destination, vertices, size);
+
+    bool unmapped = false;
+    glCheck(unmapped = GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
+
+    // The contents of the buffer may have been lost, write to a fresh storage next time
+    if (!unmapped)
+    {
+        m_offset = m_capacity;
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+        return std::nullopt;
+    }
+
+    const std::size_t firstVertex = m_offset / sizeof(Vertex);
+    m_offset += size;
+
+    return firstVertex;
+
+#endif // SFML_OPENGL_ES
+}
+
+} // namespace sf::priv
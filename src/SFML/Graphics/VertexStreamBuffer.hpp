@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <optional>
+
+#include <cstddef>
+
+
+namespace sf
+{
+struct Vertex;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Ring buffer used to stream immediate-mode vertices to the graphics card
+///
+/// Each OpenGL context owns its own stream buffer, which is
+/// destroyed together with the context. Vertices are appended
+/// with unsynchronized writes, and the buffer storage is
+/// orphaned once it is full so that the driver never has to
+/// wait for pending draws that still read from it.
+///
+////////////////////////////////////////////////////////////
+class VertexStreamBuffer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates the buffer object in the active context.
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexStreamBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~VertexStreamBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexStreamBuffer(const VertexStreamBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexStreamBuffer& operator=(const VertexStreamBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the stream buffer of the active context
+    ///
+    /// The buffer is created the first time it is requested
+    /// in a given context.
+    ///
+    /// \return Stream buffer of the active context, or a null pointer
+    ///         if no context is active or streaming is not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static VertexStreamBuffer* getForActiveContext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append vertices to the buffer
+    ///
+    /// On success, the buffer is left bound to `GL_ARRAY_BUFFER`
+    /// so that the vertices can be drawn right away.
+    ///
+    /// \param vertices    Pointer to the vertices to write
+    /// \param vertexCount Number of vertices to write
+    ///
+    /// \return Index of the first written vertex in the buffer,
+    ///         or `std::nullopt` if the vertices could not be written
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> write(const Vertex* vertices, std::size_t vertexCount);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{};   //!< Internal buffer identifier
+    std::size_t  m_capacity{}; //!< Size of the buffer storage, in bytes
+    std::size_t  m_offset{};   //!< Offset of the first free byte in the buffer storage
+};
+
+} // namespace priv
+
+} // namespace sf
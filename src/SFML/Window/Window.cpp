@@ -192,6 +192,9 @@ bool Window::setActive(bool active) const
 ////////////////////////////////////////////////////////////
 void Window::display()
 {
+    // Let derived classes finish the frame
+    onDisplay();
+
     // Display the backbuffer on screen
     if (setActive())
         m_context->display();
@@ -205,6 +208,13 @@ void Window::display()
 }
 
 
+////////////////////////////////////////////////////////////
+void Window::onDisplay()
+{
+    // Nothing by default
+}
+
+
 ////////////////////////////////////////////////////////////
 void Window::initialize()
 {
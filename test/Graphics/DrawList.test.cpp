@@ -0,0 +1,97 @@
+#include <SFML/Graphics/DrawList.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <thread>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::DrawList")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::DrawList>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::DrawList>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::DrawList>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::DrawList>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::DrawList drawList;
+        CHECK(drawList.isEmpty());
+        CHECK(drawList.getCommandCount() == 0);
+    }
+
+    const std::array<sf::Vertex, 6> vertices{};
+
+    SECTION("append()")
+    {
+        sf::DrawList drawList;
+
+        SECTION("Nothing to draw")
+        {
+            drawList.append(nullptr, 3, sf::PrimitiveType::Triangles);
+            drawList.append(vertices.data(), 0, sf::PrimitiveType::Triangles);
+            drawList.append(vertices.data(), 2, sf::PrimitiveType::Triangles);
+            CHECK(drawList.isEmpty());
+        }
+
+        SECTION("Merge draws with the same render states")
+        {
+            drawList.append(vertices.data(), 6, sf::PrimitiveType::Triangles);
+            drawList.append(vertices.data(), 3, sf::PrimitiveType::Triangles, sf::Transform().translate({10, 10}));
+            CHECK(drawList.getCommandCount() == 1);
+        }
+
+        SECTION("Split draws with different render states")
+        {
+            drawList.append(vertices.data(), 6, sf::PrimitiveType::Triangles);
+            drawList.append(vertices.data(), 6, sf::PrimitiveType::Triangles, sf::BlendAdd);
+            drawList.append(vertices.data(), 6, sf::PrimitiveType::Lines, sf::BlendAdd);
+            CHECK(drawList.getCommandCount() == 3);
+        }
+
+        SECTION("Never merge strips and fans")
+        {
+            drawList.append(vertices.data(), 4, sf::PrimitiveType::TriangleStrip);
+            drawList.append(vertices.data(), 4, sf::PrimitiveType::TriangleStrip);
+            CHECK(drawList.getCommandCount() == 2);
+        }
+
+        SECTION("Indexed")
+        {
+            const std::array<std::uint16_t, 6> indices = {0, 1, 2, 2, 1, 3};
+            drawList.append(vertices.data(), 4, indices.data(), indices.size(), sf::PrimitiveType::Triangles);
+            drawList.append(vertices.data(), 4, indices.data(), indices.size(), sf::PrimitiveType::Triangles);
+            CHECK(drawList.getCommandCount() == 2);
+        }
+
+        SECTION("Draw list")
+        {
+            sf::DrawList other;
+            other.append(vertices.data(), 3, sf::PrimitiveType::Points);
+            other.append(vertices.data(), 3, sf::PrimitiveType::Lines);
+
+            drawList.append(vertices.data(), 3, sf::PrimitiveType::Points);
+            drawList.append(other);
+            CHECK(drawList.getCommandCount() == 3);
+        }
+    }
+
+    SECTION("clear()")
+    {
+        sf::DrawList drawList;
+        drawList.append(vertices.data(), 6, sf::PrimitiveType::Triangles);
+        drawList.clear();
+        CHECK(drawList.isEmpty());
+    }
+
+    SECTION("Recording on another thread")
+    {
+        sf::DrawList drawList;
+        std::thread  thread([&] { drawList.append(vertices.data(), 6, sf::PrimitiveType::Triangles); });
+        thread.join();
+        CHECK(drawList.getCommandCount() == 1);
+    }
+}
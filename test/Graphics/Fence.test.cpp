@@ -0,0 +1,35 @@
+#include <SFML/Graphics/Fence.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::Fence", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::Fence>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::Fence>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::Fence>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::Fence>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::Fence fence;
+        CHECK(fence.isSignaled());
+        CHECK(fence.wait(sf::Time::Zero));
+    }
+
+    SECTION("insert()")
+    {
+        const sf::Fence fence = sf::Fence::insert();
+        CHECK(fence.wait(sf::seconds(1)));
+        CHECK(fence.isSignaled());
+
+        const sf::Fence copy = fence; // NOLINT(performance-unnecessary-copy-initialization)
+        CHECK(copy.isSignaled());
+    }
+}
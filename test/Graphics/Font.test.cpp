@@ -53,6 +53,10 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
                 CHECK(glyph.rsbDelta == 16);
                 CHECK(glyph.bounds == sf::FloatRect({0, -12}, {8, 12}));
                 CHECK(glyph.textureRect == sf::IntRect({2, 5}, {8, 12}));
+                const sf::Glyph metrics = font.getGlyphMetrics(0x45, 16, false);
+                CHECK(metrics.advance == glyph.advance);
+                CHECK(metrics.bounds == glyph.bounds);
+                CHECK(metrics.textureRect == sf::IntRect());
                 CHECK(font.hasGlyph(0x41));
                 CHECK(font.hasGlyph(0xC0));
                 CHECK(font.getKerning(0x41, 0x42, 12) == -1);
@@ -254,4 +258,139 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
         font.setSmooth(false);
         CHECK(!font.isSmooth());
     }
+
+    SECTION("getGlyphMetrics() of many glyphs")
+    {
+        // Enough large glyphs for their pixels to exceed what is kept for getGlyph
+        const sf::Font font("Graphics/tuffy.ttf");
+        for (unsigned int characterSize = 200; characterSize < 205; ++characterSize)
+            for (char32_t codePoint = U'A'; codePoint <= U'Z'; ++codePoint)
+                CHECK(font.getGlyphMetrics(codePoint, characterSize, false).advance > 0);
+
+        for (const unsigned int characterSize : {200u, 204u})
+        {
+            const sf::Glyph  metrics = font.getGlyphMetrics(U'W', characterSize, false);
+            const sf::Glyph& glyph   = font.getGlyph(U'W', characterSize, false);
+            CHECK(glyph.bounds == metrics.bounds);
+            CHECK(glyph.textureRect.size == sf::Vector2i(metrics.bounds.size));
+        }
+    }
+
+    SECTION("preloadGlyphs()")
+    {
+        const sf::Font font("Graphics/tuffy.ttf");
+
+        SECTION("Load glyphs")
+        {
+            CHECK(font.preloadGlyphs({{U'A', U'Z'}, {U'a', U'z'}}, {16, 24}, {{false, 0.f}, {true, 0.f}}, 4) == 208);
+            CHECK(font.preloadGlyphs({{U'A', U'Z'}}, {16}) == 0);
+
+            const sf::Glyph  metrics = font.getGlyphMetrics(U'E', 16, false);
+            const sf::Glyph& glyph   = font.getGlyph(U'E', 16, false);
+            CHECK(glyph.advance == metrics.advance);
+            CHECK(glyph.bounds == metrics.bounds);
+            CHECK(glyph.textureRect.size == sf::Vector2i(metrics.bounds.size));
+        }
+
+        SECTION("Single thread")
+        {
+            CHECK(font.preloadGlyphs({{U'0', U'9'}}, {20}, {{false, 1.f}}, 1) == 10);
+        }
+
+        SECTION("Duplicate character sizes")
+        {
+            CHECK(font.preloadGlyphs({{U'a', U'z'}}, {18, 18, 30, 18}, {{false, 0.f}}, 2) == 52);
+            CHECK(font.getStatistics().glyphCount == 52);
+        }
+
+        SECTION("Empty font")
+        {
+            CHECK(sf::Font().preloadGlyphs({{U'A', U'Z'}}, {16}) == 0);
+        }
+    }
+
+    SECTION("getStatistics()")
+    {
+        SECTION("Empty font")
+        {
+            const sf::Font::Statistics statistics = sf::Font().getStatistics();
+            CHECK(statistics.pageCount == 0);
+            CHECK(statistics.glyphCount == 0);
+            CHECK(statistics.textureBytes == 0);
+            CHECK(statistics.occupancy == 0.f);
+            CHECK(statistics.glyphEvictions == 0);
+            CHECK(statistics.pageEvictions == 0);
+        }
+
+        SECTION("Loaded glyphs")
+        {
+            const sf::Font font("Graphics/tuffy.ttf");
+            CHECK(font.getGlyph(U'E', 16, false).advance > 0);
+            CHECK(font.getGlyph(U'F', 16, false).advance > 0);
+            CHECK(font.getGlyph(U'E', 24, false).advance > 0);
+
+            const sf::Font::Statistics statistics = font.getStatistics();
+            CHECK(statistics.pageCount == 2);
+            CHECK(statistics.glyphCount == 3);
+            CHECK(statistics.textureBytes == 2 * 128 * 128 * 4);
+            CHECK(statistics.occupancy > 0.f);
+            CHECK(statistics.occupancy < 1.f);
+            CHECK(statistics.glyphEvictions == 0);
+            CHECK(statistics.pageEvictions == 0);
+        }
+    }
+
+    SECTION("Set/get memory budget")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        CHECK(font.getMemoryBudget() == 0);
+
+        font.setMemoryBudget(128 * 128 * 4);
+        CHECK(font.getMemoryBudget() == 128 * 128 * 4);
+
+        SECTION("Page eviction")
+        {
+            font.setMemoryBudget(0);
+            for (char32_t codePoint = U'A'; codePoint <= U'T'; ++codePoint)
+                CHECK(font.getGlyph(codePoint, 64, false).advance > 0);
+
+            const sf::Texture& texture = font.getTexture(64);
+            CHECK(texture.getSize() != sf::Vector2u(128, 128));
+
+            // Leave room for one more page only: creating a third one releases the least recently used page
+            font.setMemoryBudget(font.getStatistics().textureBytes + 128 * 128 * 4);
+            CHECK(font.getGlyph(U'E', 16, false).advance > 0);
+            CHECK(font.getGlyph(U'E', 24, false).advance > 0);
+
+            const sf::Font::Statistics statistics = font.getStatistics();
+            CHECK(statistics.pageCount == 3);
+            CHECK(statistics.glyphCount == 2);
+            CHECK(statistics.textureBytes == 3 * 128 * 128 * 4);
+            CHECK(statistics.glyphEvictions == 20);
+            CHECK(statistics.pageEvictions == 1);
+
+            // The released page keeps its texture object, back to its initial size
+            CHECK(&font.getTexture(64) == &texture);
+            CHECK(texture.getSize() == sf::Vector2u(128, 128));
+        }
+
+        SECTION("Glyph eviction")
+        {
+            for (char32_t codePoint = U'A'; codePoint <= U'Z'; ++codePoint)
+                CHECK(font.getGlyph(codePoint, 64, false).advance > 0);
+
+            const sf::Font::Statistics statistics = font.getStatistics();
+            CHECK(statistics.pageCount == 1);
+            CHECK(statistics.glyphCount < 26);
+            CHECK(statistics.textureBytes == 128 * 128 * 4);
+            CHECK(statistics.glyphEvictions == 26 - statistics.glyphCount);
+            CHECK(statistics.pageEvictions == 0);
+
+            // The most recently used glyph is always kept
+            const sf::Glyph  metrics = font.getGlyphMetrics(U'Z', 64, false);
+            const sf::Glyph& glyph   = font.getGlyph(U'Z', 64, false);
+            CHECK(glyph.textureRect.size == sf::Vector2i(metrics.bounds.size));
+            CHECK(font.getStatistics().glyphCount == statistics.glyphCount);
+        }
+    }
 }
@@ -0,0 +1,113 @@
+#include <SFML/Graphics/FrameRecorder.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::FrameRecorder", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::FrameRecorder>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::FrameRecorder>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::FrameRecorder recorder;
+        CHECK(!recorder.isRecording());
+        CHECK(recorder.getFrameCount() == 0);
+    }
+
+    SECTION("start()")
+    {
+        sf::FrameRecorder recorder;
+        sf::RenderTexture renderTexture;
+        std::ostringstream stream;
+
+        SECTION("Empty target")
+        {
+            CHECK(!recorder.start(renderTexture, stream));
+            CHECK(!recorder.isRecording());
+        }
+
+        SECTION("Valid target")
+        {
+            REQUIRE(renderTexture.resize({8, 4}));
+            CHECK(recorder.start(renderTexture, stream, 30));
+            CHECK(recorder.isRecording());
+
+            recorder.stop();
+            CHECK(!recorder.isRecording());
+            CHECK(stream.str() == "YUV4MPEG2 W8 H4 F30:1 Ip A1:1 C420jpeg\n");
+        }
+    }
+
+    SECTION("capture()")
+    {
+        sf::FrameRecorder recorder;
+        sf::RenderTexture renderTexture;
+        std::ostringstream stream;
+        REQUIRE(renderTexture.resize({20, 3}));
+
+        const auto frameSize = std::string::size_type{20 * 3 + 10 * 2 * 2};
+
+        SECTION("Y4M")
+        {
+            REQUIRE(recorder.start(renderTexture, stream));
+            const auto headerSize = stream.str().size();
+
+            renderTexture.clear(sf::Color::White);
+            recorder.capture();
+            renderTexture.clear(sf::Color::Red);
+            recorder.capture();
+            recorder.stop();
+
+            CHECK(recorder.getFrameCount() == 2);
+
+            const std::string output = stream.str();
+            REQUIRE(output.size() == headerSize + 2 * (6 + frameSize));
+            CHECK(output.compare(headerSize, 6, "FRAME\n") == 0);
+
+            const std::string white = output.substr(headerSize + 6, frameSize);
+            CHECK(white == std::string(20 * 3, '\xFF') + std::string(10 * 2 * 2, '\x80'));
+
+            const std::string red = output.substr(headerSize + 12 + frameSize, frameSize);
+            CHECK(red == std::string(20 * 3, '\x4D') + std::string(10 * 2, '\x55') + std::string(10 * 2, '\xFF'));
+        }
+
+        SECTION("NV12")
+        {
+            REQUIRE(recorder.start(renderTexture, stream, 60, sf::FrameRecorder::Format::Nv12));
+            renderTexture.clear(sf::Color::Red);
+            recorder.capture();
+            recorder.stop();
+
+            CHECK(recorder.getFrameCount() == 1);
+
+            std::string uv;
+            for (int i = 0; i < 10 * 2; ++i)
+                uv += "\x55\xFF";
+
+            CHECK(stream.str() == std::string(20 * 3, '\x4D') + uv);
+        }
+
+        SECTION("Resized target")
+        {
+            REQUIRE(recorder.start(renderTexture, stream, 60, sf::FrameRecorder::Format::I420));
+            REQUIRE(renderTexture.resize({4, 4}));
+            recorder.capture();
+            recorder.stop();
+
+            CHECK(recorder.getFrameCount() == 0);
+            CHECK(stream.str().empty());
+        }
+    }
+}
@@ -0,0 +1,24 @@
+#include <SFML/Graphics/ImageRequest.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ImageRequest")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::ImageRequest>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::ImageRequest>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::ImageRequest>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::ImageRequest>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::ImageRequest request;
+        CHECK(request.isReady());
+        CHECK(request.wait(sf::Time::Zero));
+        CHECK(request.getImage().getSize() == sf::Vector2u());
+    }
+}
@@ -0,0 +1,124 @@
+#include <SFML/Graphics/InstanceBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <type_traits>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::InstanceBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::InstanceBuffer>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::InstanceBuffer>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::InstanceBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::InstanceBuffer>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::InstanceBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::InstanceBuffer>);
+        STATIC_CHECK(std::is_nothrow_swappable_v<sf::InstanceBuffer>);
+    }
+
+    SECTION("Instance")
+    {
+        const sf::InstanceBuffer::Instance instance;
+        CHECK(instance.transform == sf::Transform::Identity);
+        CHECK(instance.color == sf::Color::White);
+        CHECK(instance.textureRect == sf::FloatRect({0, 0}, {1, 1}));
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::InstanceBuffer instanceBuffer;
+            CHECK(instanceBuffer.getInstanceCount() == 0);
+            CHECK(instanceBuffer.getInstances() == nullptr);
+            CHECK(instanceBuffer.getNativeHandle() == 0);
+            CHECK(instanceBuffer.getUsage() == sf::InstanceBuffer::Usage::Stream);
+        }
+
+        SECTION("Usage constructor")
+        {
+            const sf::InstanceBuffer instanceBuffer(sf::InstanceBuffer::Usage::Static);
+            CHECK(instanceBuffer.getInstanceCount() == 0);
+            CHECK(instanceBuffer.getInstances() == nullptr);
+            CHECK(instanceBuffer.getNativeHandle() == 0);
+            CHECK(instanceBuffer.getUsage() == sf::InstanceBuffer::Usage::Static);
+        }
+    }
+
+    SECTION("create()")
+    {
+        sf::InstanceBuffer instanceBuffer;
+        CHECK(instanceBuffer.create(100));
+        CHECK(instanceBuffer.getInstanceCount() == 100);
+        CHECK(instanceBuffer.getInstances()[99].color == sf::Color::White);
+        CHECK((instanceBuffer.getNativeHandle() != 0) == sf::InstanceBuffer::isAvailable());
+    }
+
+    SECTION("update()")
+    {
+        sf::InstanceBuffer                          instanceBuffer;
+        std::array<sf::InstanceBuffer::Instance, 8> instances{};
+        instances[7].color = sf::Color::Red;
+
+        SECTION("Null instances")
+        {
+            CHECK(!instanceBuffer.update(nullptr, 8, 0));
+        }
+
+        SECTION("Instances, count, and offset")
+        {
+            CHECK(instanceBuffer.update(instances.data(), instances.size(), 0));
+            CHECK(instanceBuffer.getInstanceCount() == 8);
+            CHECK(instanceBuffer.getInstances()[7].color == sf::Color::Red);
+
+            SECTION("Count + offset too large")
+            {
+                CHECK(!instanceBuffer.update(instances.data(), 6, 6));
+            }
+
+            CHECK(instanceBuffer.update(instances.data() + 7, 1, 0));
+            CHECK(instanceBuffer.getInstanceCount() == 8);
+            CHECK(instanceBuffer.getInstances()[0].color == sf::Color::Red);
+        }
+    }
+
+    SECTION("Copy semantics")
+    {
+        sf::InstanceBuffer instanceBuffer(sf::InstanceBuffer::Usage::Dynamic);
+        CHECK(instanceBuffer.create(4));
+
+        const sf::InstanceBuffer instanceBufferCopy(instanceBuffer); // NOLINT(performance-unnecessary-copy-initialization)
+        CHECK(instanceBufferCopy.getInstanceCount() == 4);
+        CHECK(instanceBufferCopy.getUsage() == sf::InstanceBuffer::Usage::Dynamic);
+        if (sf::InstanceBuffer::isAvailable())
+            CHECK(instanceBufferCopy.getNativeHandle() != instanceBuffer.getNativeHandle());
+    }
+
+    SECTION("swap()")
+    {
+        sf::InstanceBuffer instanceBuffer1(sf::InstanceBuffer::Usage::Dynamic);
+        CHECK(instanceBuffer1.create(50));
+
+        sf::InstanceBuffer instanceBuffer2(sf::InstanceBuffer::Usage::Stream);
+        CHECK(instanceBuffer2.create(60));
+
+        sf::swap(instanceBuffer1, instanceBuffer2);
+
+        CHECK(instanceBuffer1.getInstanceCount() == 60);
+        CHECK(instanceBuffer1.getUsage() == sf::InstanceBuffer::Usage::Stream);
+
+        CHECK(instanceBuffer2.getInstanceCount() == 50);
+        CHECK(instanceBuffer2.getUsage() == sf::InstanceBuffer::Usage::Dynamic);
+    }
+
+    SECTION("Set/get usage")
+    {
+        sf::InstanceBuffer instanceBuffer;
+        instanceBuffer.setUsage(sf::InstanceBuffer::Usage::Dynamic);
+        CHECK(instanceBuffer.getUsage() == sf::InstanceBuffer::Usage::Dynamic);
+    }
+}
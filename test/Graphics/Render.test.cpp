@@ -1,13 +1,24 @@
+#include <SFML/Graphics/DrawList.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/InstanceBuffer.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderQueue.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
 
+#include <array>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+
 TEST_CASE("[Graphics] Render Tests", runDisplayTests())
 {
     SECTION("Stencil Tests")
@@ -237,4 +248,291 @@ TEST_CASE("[Graphics] Render Tests", runDisplayTests())
             }
         }
     }
+
+    SECTION("Batching")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.setBatchingEnabled(true);
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape shape({50, 100});
+        shape.setFillColor(sf::Color::Green);
+        renderTexture.draw(shape);
+        shape.setPosition({50, 0});
+        shape.setFillColor(sf::Color::Blue);
+        renderTexture.draw(shape);
+
+        SECTION("Display")
+        {
+            renderTexture.display();
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+            CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+        }
+
+        SECTION("Clear")
+        {
+            renderTexture.clear(sf::Color::Red);
+            renderTexture.display();
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({25, 50}) == sf::Color::Red);
+            CHECK(image.getPixel({75, 50}) == sf::Color::Red);
+        }
+
+        SECTION("Disable")
+        {
+            renderTexture.setBatchingEnabled(false);
+            renderTexture.display();
+            CHECK(renderTexture.getTexture().copyToImage().getPixel({75, 50}) == sf::Color::Blue);
+        }
+    }
+
+    SECTION("Indexed drawing")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        // Left half of the target as a quad made of 4 vertices and 6 indices
+        const std::array vertices = {sf::Vertex{{0, 0}, sf::Color::Green},
+                                     sf::Vertex{{50, 0}, sf::Color::Green},
+                                     sf::Vertex{{0, 100}, sf::Color::Green},
+                                     sf::Vertex{{50, 100}, sf::Color::Green}};
+        const std::array<std::uint16_t, 6> indices = {0, 1, 2, 2, 1, 3};
+
+        SECTION("Vertex array")
+        {
+            renderTexture.draw(vertices.data(), vertices.size(), indices.data(), indices.size(), sf::PrimitiveType::Triangles);
+            renderTexture.display();
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+            CHECK(image.getPixel({75, 50}) == sf::Color::Red);
+        }
+
+        SECTION("Vertex buffer")
+        {
+            if (!sf::IndexBuffer::isAvailable())
+                return;
+
+            sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static);
+            REQUIRE(vertexBuffer.create(vertices.size()));
+            REQUIRE(vertexBuffer.update(vertices.data()));
+
+            sf::IndexBuffer indexBuffer(sf::IndexBuffer::Usage::Static);
+            REQUIRE(indexBuffer.create(indices.size()));
+            REQUIRE(indexBuffer.update(indices.data()));
+
+            SECTION("All indices")
+            {
+                renderTexture.draw(vertexBuffer, indexBuffer);
+                renderTexture.display();
+                const sf::Image image = renderTexture.getTexture().copyToImage();
+                CHECK(image.getPixel({10, 10}) == sf::Color::Green);
+                CHECK(image.getPixel({40, 90}) == sf::Color::Green);
+                CHECK(image.getPixel({75, 50}) == sf::Color::Red);
+            }
+
+            SECTION("Index range")
+            {
+                // Only the first triangle, covering the top left corner
+                renderTexture.draw(vertexBuffer, indexBuffer, 0, 3);
+                renderTexture.display();
+                const sf::Image image = renderTexture.getTexture().copyToImage();
+                CHECK(image.getPixel({10, 10}) == sf::Color::Green);
+                CHECK(image.getPixel({40, 90}) == sf::Color::Red);
+            }
+        }
+    }
+
+    SECTION("Instanced drawing")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        // Unit quad, scaled and colored by each instance
+        const std::array mesh = {sf::Vertex{{0, 0}}, sf::Vertex{{1, 0}}, sf::Vertex{{0, 1}}, sf::Vertex{{1, 1}}};
+
+        sf::VertexBuffer vertexBuffer(sf::PrimitiveType::TriangleStrip, sf::VertexBuffer::Usage::Static);
+        REQUIRE(vertexBuffer.create(mesh.size()));
+        REQUIRE(vertexBuffer.update(mesh.data()));
+
+        std::array<sf::InstanceBuffer::Instance, 2> instances;
+        instances[0].transform.scale({50, 100});
+        instances[0].color = sf::Color::Green;
+        instances[1].transform.translate({50, 0}).scale({50, 100});
+        instances[1].color = sf::Color::Blue;
+
+        sf::InstanceBuffer instanceBuffer;
+        REQUIRE(instanceBuffer.update(instances.data(), instances.size(), 0));
+
+        SECTION("All instances")
+        {
+            renderTexture.drawInstanced(vertexBuffer, instanceBuffer, instances.size());
+            renderTexture.display();
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+            CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+        }
+
+        SECTION("Instance count")
+        {
+            renderTexture.drawInstanced(vertexBuffer, instanceBuffer, 1);
+            renderTexture.display();
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+            CHECK(image.getPixel({75, 50}) == sf::Color::Red);
+        }
+    }
+
+    SECTION("Draw list")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        const std::array quad = {sf::Vertex{{0, 0}, sf::Color::Green},
+                                 sf::Vertex{{50, 0}, sf::Color::Green},
+                                 sf::Vertex{{0, 100}, sf::Color::Green},
+                                 sf::Vertex{{50, 100}, sf::Color::Green}};
+
+        // Record the left half of the target on another thread, and the right half with a transform
+        sf::DrawList drawList;
+        std::thread  thread(
+            [&]
+            {
+                drawList.append(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip);
+                drawList.append(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip, sf::Transform().translate({50, 0}));
+            });
+        thread.join();
+
+        renderTexture.draw(drawList);
+        renderTexture.display();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Green);
+    }
+
+    SECTION("Render queue")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        const auto makeQuad = [](sf::Vector2f position, sf::Color color)
+        {
+            return std::array{sf::Vertex{position, color},
+                              sf::Vertex{position + sf::Vector2f(50, 0), color},
+                              sf::Vertex{position + sf::Vector2f(0, 50), color},
+                              sf::Vertex{position + sf::Vector2f(0, 50), color},
+                              sf::Vertex{position + sf::Vector2f(50, 0), color},
+                              sf::Vertex{position + sf::Vector2f(50, 50), color}};
+        };
+
+        // Alternate between two blend modes on disjoint quads, then cover a quad in layer 1
+        const auto topLeft     = makeQuad({0, 0}, sf::Color::Green);
+        const auto topRight    = makeQuad({50, 0}, sf::Color::Blue);
+        const auto bottomLeft  = makeQuad({0, 50}, sf::Color::Green);
+        const auto bottomRight = makeQuad({50, 50}, sf::Color::Blue);
+        const auto cover       = makeQuad({50, 50}, sf::Color::Yellow);
+
+        sf::RenderQueue queue;
+        queue.submit(1, cover.data(), cover.size(), sf::PrimitiveType::Triangles);
+        queue.submit(0, topLeft.data(), topLeft.size(), sf::PrimitiveType::Triangles, sf::BlendNone);
+        queue.submit(0, topRight.data(), topRight.size(), sf::PrimitiveType::Triangles);
+        queue.submit(0, bottomLeft.data(), bottomLeft.size(), sf::PrimitiveType::Triangles, sf::BlendNone);
+        queue.submit(0, bottomRight.data(), bottomRight.size(), sf::PrimitiveType::Triangles);
+
+        renderTexture.resetStatistics();
+        queue.flush(renderTexture);
+        CHECK(queue.isEmpty());
+        CHECK(renderTexture.getStatistics().drawCalls == 3);
+
+        renderTexture.display();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 25}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 25}) == sf::Color::Blue);
+        CHECK(image.getPixel({25, 75}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 75}) == sf::Color::Yellow);
+    }
+
+    SECTION("Render queue with many draws")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        const auto makeQuad = [](sf::Vector2f position, sf::Vector2f size, sf::Color color)
+        {
+            return std::array{sf::Vertex{position, color},
+                              sf::Vertex{position + sf::Vector2f(size.x, 0), color},
+                              sf::Vertex{position + sf::Vector2f(0, size.y), color},
+                              sf::Vertex{position + sf::Vector2f(0, size.y), color},
+                              sf::Vertex{position + sf::Vector2f(size.x, 0), color},
+                              sf::Vertex{position + size, color}};
+        };
+
+        // Alternate between two blend modes on 1000 disjoint pixels, then cover the first ones
+        std::vector<std::array<sf::Vertex, 6>> pixels;
+        for (int i = 0; i < 1000; ++i)
+        {
+            const sf::Color color = (i % 2 == 0) ? sf::Color::Green : sf::Color::Blue;
+            pixels.push_back(makeQuad({static_cast<float>(i % 100), static_cast<float>(i / 100)}, {1, 1}, color));
+        }
+
+        const auto cover = makeQuad({0, 0}, {2, 1}, sf::Color::Yellow);
+
+        sf::RenderQueue queue;
+        for (std::size_t i = 0; i < pixels.size(); ++i)
+        {
+            const sf::BlendMode blendMode = (i % 2 == 0) ? sf::BlendNone : sf::BlendAlpha;
+            queue.submit(0, pixels[i].data(), pixels[i].size(), sf::PrimitiveType::Triangles, blendMode);
+        }
+        queue.submit(0, cover.data(), cover.size(), sf::PrimitiveType::Triangles, sf::BlendNone);
+
+        renderTexture.resetStatistics();
+        queue.flush(renderTexture);
+        CHECK(renderTexture.getStatistics().drawCalls < 20);
+
+        renderTexture.display();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({0, 0}) == sf::Color::Yellow);
+        CHECK(image.getPixel({1, 0}) == sf::Color::Yellow);
+        CHECK(image.getPixel({2, 0}) == sf::Color::Green);
+        CHECK(image.getPixel({99, 9}) == sf::Color::Blue);
+        CHECK(image.getPixel({0, 10}) == sf::Color::Red);
+    }
+
+    SECTION("Asynchronous read back")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape rectangle({100, 50});
+        rectangle.setFillColor(sf::Color::Green);
+        renderTexture.setBatchingEnabled(true);
+        renderTexture.draw(rectangle);
+
+        const sf::ImageRequest request = renderTexture.requestImageAsync();
+        CHECK(request.wait(sf::seconds(1)));
+
+        const sf::Image image = request.getImage();
+        CHECK(image.getSize() == sf::Vector2u(100, 100));
+        CHECK(image.getPixel({50, 25}) == sf::Color::Green);
+        CHECK(image.getPixel({50, 75}) == sf::Color::Red);
+    }
+
+    SECTION("Statistics")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.resetStatistics();
+
+        const std::array quad = {sf::Vertex{{0, 0}}, sf::Vertex{{100, 0}}, sf::Vertex{{0, 100}}, sf::Vertex{{100, 100}}};
+        renderTexture.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip);
+        renderTexture.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip);
+
+        const sf::RenderTarget::Statistics& statistics = renderTexture.getStatistics();
+        CHECK(statistics.drawCalls == 2);
+        CHECK(statistics.vertices == 8);
+        CHECK(statistics.cacheHits > 0);
+
+        renderTexture.resetStatistics();
+        CHECK(renderTexture.getStatistics().drawCalls == 0);
+        CHECK(renderTexture.getStatistics().cacheHits == 0);
+    }
 }
@@ -0,0 +1,50 @@
+#include <SFML/Graphics/RenderQueue.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::RenderQueue")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::RenderQueue>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::RenderQueue>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::RenderQueue>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::RenderQueue>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::RenderQueue queue;
+        CHECK(queue.isEmpty());
+        CHECK(queue.getDrawCount() == 0);
+    }
+
+    SECTION("submit()")
+    {
+        const std::array<sf::Vertex, 6> vertices{};
+        sf::RenderQueue                 queue;
+
+        SECTION("Nothing to draw")
+        {
+            queue.submit(0, nullptr, 3, sf::PrimitiveType::Triangles);
+            queue.submit(0, vertices.data(), 0, sf::PrimitiveType::Triangles);
+            queue.submit(0, vertices.data(), 2, sf::PrimitiveType::Triangles);
+            CHECK(queue.isEmpty());
+        }
+
+        SECTION("Draws")
+        {
+            queue.submit(1, vertices.data(), 6, sf::PrimitiveType::Triangles);
+            queue.submit(0, vertices.data(), 4, sf::PrimitiveType::TriangleStrip, sf::BlendAdd);
+            CHECK(!queue.isEmpty());
+            CHECK(queue.getDrawCount() == 2);
+
+            queue.clear();
+            CHECK(queue.isEmpty());
+            CHECK(queue.getDrawCount() == 0);
+        }
+    }
+}
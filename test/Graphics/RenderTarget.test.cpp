@@ -53,6 +53,36 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.getView().getSize() == sf::Vector2f(3, 4));
     }
 
+    SECTION("Set/get batching enabled")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isBatchingEnabled());
+        renderTarget.setBatchingEnabled(true);
+        CHECK(renderTarget.isBatchingEnabled());
+        renderTarget.setBatchingEnabled(false);
+        CHECK(!renderTarget.isBatchingEnabled());
+    }
+
+    SECTION("Statistics")
+    {
+        RenderTarget renderTarget;
+        const auto&  statistics = renderTarget.getStatistics();
+        CHECK(statistics.drawCalls == 0);
+        CHECK(statistics.vertices == 0);
+        CHECK(statistics.streamedVertexBytes == 0);
+        CHECK(statistics.textureBinds == 0);
+        CHECK(statistics.shaderBinds == 0);
+        CHECK(statistics.blendModeChanges == 0);
+        CHECK(statistics.stencilModeChanges == 0);
+        CHECK(statistics.viewApplications == 0);
+        CHECK(statistics.glStateResets == 0);
+        CHECK(statistics.cacheHits == 0);
+        CHECK(statistics.cacheMisses == 0);
+
+        renderTarget.resetStatistics();
+        CHECK(renderTarget.getStatistics().drawCalls == 0);
+    }
+
     SECTION("setActive()")
     {
         RenderTarget renderTarget;
@@ -2,6 +2,7 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <SFML/Window/VideoMode.hpp>
@@ -89,4 +90,19 @@ TEST_CASE("[Graphics] sf::RenderWindow", runDisplayTests())
         texture.update(window);
         CHECK(texture.copyToImage().getPixel(sf::Vector2u(196, 196)) == sf::Color::Blue);
     }
+
+    SECTION("Display flushes the batch")
+    {
+        sf::RenderWindow window(sf::VideoMode(sf::Vector2u(256, 256), 24), "Window Title");
+        window.setBatchingEnabled(true);
+
+        const sf::RectangleShape rectangle({100, 100});
+        window.resetStatistics();
+        window.draw(rectangle);
+        CHECK(window.getStatistics().drawCalls == 0);
+
+        // The batch is submitted even when displaying through the base class
+        static_cast<sf::Window&>(window).display();
+        CHECK(window.getStatistics().drawCalls == 1);
+    }
 }
@@ -1,12 +1,33 @@
 #include <SFML/Graphics/Shader.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/ShaderRequest.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+#include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
 #include <type_traits>
+#include <utility>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+#define GLAPI __stdcall
+#else
+#define GLAPI
+#endif
 
 namespace
 {
@@ -167,6 +188,27 @@ TEST_CASE("[Graphics] sf::Shader (Dummy Implementation)", skipShaderDummyTests()
         CHECK_FALSE(shader.loadFromMemory(vertexSource, fragmentSource));
         CHECK_FALSE(shader.loadFromMemory(vertexSource, geometrySource, fragmentSource));
     }
+
+    SECTION("loadFromMemoryAsync()")
+    {
+        auto request = sf::Shader::loadFromMemoryAsync(vertexSource, fragmentSource);
+        CHECK(request.isReady());
+        CHECK(!request.takeShader());
+    }
+
+    SECTION("getUniformHandle()")
+    {
+        sf::Shader shader;
+        CHECK_FALSE(shader.getUniformHandle("blink_alpha").isValid());
+    }
+
+    SECTION("Deferred uniforms")
+    {
+        sf::Shader shader;
+        CHECK_FALSE(shader.isDeferredUniformsEnabled());
+        shader.setDeferredUniformsEnabled(true);
+        CHECK(shader.isDeferredUniformsEnabled());
+    }
 }
 
 TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
@@ -435,6 +477,54 @@ TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
         CHECK(static_cast<bool>(shader.getNativeHandle()) == sf::Shader::isAvailable());
     }
 
+    SECTION("loadFromFileAsync()")
+    {
+        SECTION("Two shaders")
+        {
+            CHECK(!sf::Shader::loadFromFileAsync("does-not-exist.vert", "Graphics/shader.frag").takeShader());
+            CHECK(!sf::Shader::loadFromFileAsync("Graphics/shader.vert", "does-not-exist.frag").takeShader());
+
+            auto request = sf::Shader::loadFromFileAsync("Graphics/shader.vert", "Graphics/shader.frag");
+            CHECK(request.wait(sf::seconds(10)));
+            CHECK(request.isReady());
+            const std::optional<sf::Shader> shader = request.takeShader();
+            CHECK(shader.has_value() == sf::Shader::isAvailable());
+            CHECK(!request.takeShader());
+        }
+
+        SECTION("Three shaders")
+        {
+            CHECK(!sf::Shader::loadFromFileAsync("does-not-exist.vert", "Graphics/shader.geom", "Graphics/shader.frag")
+                       .takeShader());
+
+            auto request = sf::Shader::loadFromFileAsync("Graphics/shader.vert",
+                                                         "Graphics/shader.geom",
+                                                         "Graphics/shader.frag");
+            CHECK(request.takeShader().has_value() == sf::Shader::isGeometryAvailable());
+        }
+    }
+
+    SECTION("loadFromMemoryAsync()")
+    {
+        auto request = sf::Shader::loadFromMemoryAsync(vertexSource, fragmentSource);
+        CHECK(request.wait(sf::seconds(10)));
+        std::optional<sf::Shader> shader = request.takeShader();
+        CHECK(shader.has_value() == sf::Shader::isAvailable());
+        if (shader)
+        {
+            CHECK(shader->getNativeHandle() != 0);
+            CHECK(shader->getUniformHandle("storm_position").isValid());
+        }
+
+        CHECK(!sf::Shader::loadFromMemoryAsync("invalid", fragmentSource).takeShader());
+
+        // Copies share the compilation, the shader can only be taken once
+        auto       original = sf::Shader::loadFromMemoryAsync(vertexSource, geometrySource, fragmentSource);
+        const auto copy     = original;
+        CHECK(original.takeShader().has_value() == sf::Shader::isGeometryAvailable());
+        CHECK(copy.isReady());
+    }
+
     SECTION("loadFromStream()")
     {
         sf::Shader          shader;
@@ -473,4 +563,200 @@ TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
             CHECK(static_cast<bool>(shader.getNativeHandle()) == sf::Shader::isGeometryAvailable());
         }
     }
+
+    SECTION("getUniformHandle()")
+    {
+        sf::Shader shader;
+        CHECK(!sf::Shader::UniformHandle().isValid());
+        CHECK(!shader.getUniformHandle("blink_alpha").isValid());
+
+        REQUIRE(shader.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+        const sf::Shader::UniformHandle alpha    = shader.getUniformHandle("blink_alpha");
+        const sf::Shader::UniformHandle position = shader.getUniformHandle("storm_position");
+        const sf::Shader::UniformHandle missing  = shader.getUniformHandle("missing");
+        CHECK(alpha.isValid() == sf::Shader::isAvailable());
+        CHECK(position.isValid() == sf::Shader::isAvailable());
+        CHECK(!missing.isValid());
+
+        shader.setUniform(alpha, 0.5f);
+        shader.setUniform(position, sf::Glsl::Vec2(1.f, 2.f));
+        shader.setUniform(missing, 1.f);
+        shader.setUniform(sf::Shader::UniformHandle(), 1.f);
+
+        // Handles follow their program when the shader is moved
+        sf::Shader movedShader = std::move(shader);
+        movedShader.setUniform(alpha, 0.25f);
+    }
+
+    SECTION("Uniform handle from a previous load")
+    {
+        sf::Shader shader;
+        REQUIRE(shader.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+        const sf::Shader::UniformHandle alpha = shader.getUniformHandle("blink_alpha");
+        REQUIRE(shader.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+
+        std::stringstream stream;
+        auto* const       defaultStreamBuffer = sf::err().rdbuf(stream.rdbuf());
+
+        // Every overload rejects the handle, whether updates are deferred or not
+        shader.setUniform(alpha, 0.5f);
+        shader.setUniformArray(alpha, std::array{0.5f}.data(), 1);
+        shader.setUniform(alpha, sf::Shader::CurrentTexture);
+        shader.setDeferredUniformsEnabled(true);
+        shader.setUniform(alpha, 0.5f);
+
+        // A handle retrieved from the current program is accepted
+        shader.setUniform(shader.getUniformHandle("blink_alpha"), 0.5f);
+        sf::err().rdbuf(defaultStreamBuffer);
+
+        const std::string log        = stream.str();
+        const std::string message    = "not retrieved from the current program";
+        std::size_t       rejections = 0;
+        std::size_t       position   = log.find(message);
+        while (position != std::string::npos)
+        {
+            ++rejections;
+            position = log.find(message, position + 1);
+        }
+
+        CHECK(rejections == (sf::Shader::isAvailable() ? 4 : 0));
+    }
+
+    SECTION("setUniformBlock()")
+    {
+        sf::Shader        shader;
+        sf::UniformBuffer buffer;
+        CHECK(!shader.setUniformBlock("Frame", buffer));
+
+        REQUIRE(shader.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+        CHECK(!shader.setUniformBlock("Frame", buffer));
+    }
+
+    SECTION("Deferred uniforms")
+    {
+        sf::Shader shader;
+        CHECK(!shader.isDeferredUniformsEnabled());
+        shader.setDeferredUniformsEnabled(true);
+        CHECK(shader.isDeferredUniformsEnabled());
+
+        REQUIRE(shader.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+        const sf::Shader::UniformHandle alpha = shader.getUniformHandle("blink_alpha");
+        shader.setUniform(alpha, 0.5f);
+        shader.setUniform(alpha, 0.5f);
+        shader.setUniform("storm_position", sf::Glsl::Vec2(1.f, 2.f));
+        const std::array<float, 3> radii{1.f, 2.f, 3.f};
+        shader.setUniformArray("storm_total_radius", radii.data(), 1);
+
+        if (sf::Shader::isAvailable())
+        {
+            sf::Shader::bind(&shader);
+            sf::Shader::bind(nullptr);
+        }
+
+        shader.setUniform(alpha, 0.25f);
+        shader.setDeferredUniformsEnabled(false);
+        CHECK(!shader.isDeferredUniformsEnabled());
+        shader.setUniform(alpha, 1.f);
+    }
+
+    SECTION("Deferred uniforms rendering")
+    {
+        sf::Shader shader;
+        REQUIRE(shader.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+
+        if (sf::Shader::isAvailable())
+        {
+            sf::RenderTexture        renderTexture({10, 10});
+            const sf::RectangleShape quad({10, 10});
+            sf::RenderStates         states(&shader);
+            states.blendMode = sf::BlendNone;
+
+            // The fragment shader writes blink_alpha to the alpha channel
+            const auto drawAlpha = [&]
+            {
+                renderTexture.clear(sf::Color::Transparent);
+                renderTexture.draw(quad, states);
+                renderTexture.display();
+                return renderTexture.getTexture().copyToImage().getPixel({5, 5}).a;
+            };
+
+            const sf::Shader::UniformHandle alpha = shader.getUniformHandle("blink_alpha");
+            shader.setDeferredUniformsEnabled(true);
+
+            // Staged values are uploaded when the shader is bound to draw
+            shader.setUniform(alpha, 1.f);
+            CHECK(drawAlpha() == 255);
+            shader.setUniform(alpha, 0.f);
+            shader.setUniform(alpha, 1.f);
+            shader.setUniform(alpha, 0.f);
+            CHECK(drawAlpha() == 0);
+
+            // Change the value behind the shader's back: setting the value it already holds must not upload anything
+            using glUseProgramFuncType         = void(GLAPI*)(unsigned int);
+            using glGetUniformLocationFuncType = int(GLAPI*)(unsigned int, const char*);
+            using glUniform1fFuncType          = void(GLAPI*)(int, float);
+            const auto glUseProgramFunc         = reinterpret_cast<glUseProgramFuncType>(
+                sf::Context::getFunction("glUseProgram"));
+            const auto glGetUniformLocationFunc = reinterpret_cast<glGetUniformLocationFuncType>(
+                sf::Context::getFunction("glGetUniformLocation"));
+            const auto glUniform1fFunc          = reinterpret_cast<glUniform1fFuncType>(
+                sf::Context::getFunction("glUniform1f"));
+            REQUIRE(glUseProgramFunc);
+            REQUIRE(glGetUniformLocationFunc);
+            REQUIRE(glUniform1fFunc);
+
+            REQUIRE(renderTexture.setActive());
+            glUseProgramFunc(shader.getNativeHandle());
+            glUniform1fFunc(glGetUniformLocationFunc(shader.getNativeHandle(), "blink_alpha"), 1.f);
+            glUseProgramFunc(0);
+
+            shader.setUniform(alpha, 0.f);
+            CHECK(drawAlpha() == 255);
+
+            // Disabling deferred updates uploads the pending values right away
+            shader.setUniform(alpha, 1.f);
+            shader.setUniform(alpha, 0.f);
+            shader.setDeferredUniformsEnabled(false);
+            CHECK(drawAlpha() == 0);
+        }
+    }
+
+    SECTION("Program cache")
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "sfml-shader-program-cache";
+        std::filesystem::remove_all(directory);
+
+        sf::Shader::setProgramCacheDirectory(directory);
+        sf::Shader::resetProgramCacheStatistics();
+        CHECK(sf::Shader::getProgramCacheDirectory() == directory);
+
+        sf::Shader first;
+        CHECK(first.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+        sf::Shader second;
+        CHECK(second.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+        CHECK(static_cast<bool>(second.getNativeHandle()) == sf::Shader::isAvailable());
+
+        // Hits are only possible when the driver supports program binaries
+        const sf::Shader::ProgramCacheStatistics statistics = sf::Shader::getProgramCacheStatistics();
+        CHECK(statistics.hits <= 1);
+        CHECK(statistics.invalidations == 0);
+
+        if (statistics.hits == 1)
+        {
+            CHECK(statistics.misses == 1);
+
+            // Corrupted entries are discarded and the program is compiled again
+            for (const auto& entry : std::filesystem::directory_iterator(directory))
+                std::ofstream(entry.path(), std::ios_base::binary | std::ios_base::trunc) << "garbage";
+
+            sf::Shader third;
+            CHECK(third.loadFromMemory(vertexSource, fragmentSource));
+            CHECK(sf::Shader::getProgramCacheStatistics().misses == 2);
+            CHECK(sf::Shader::getProgramCacheStatistics().invalidations == 1);
+        }
+
+        sf::Shader::setProgramCacheDirectory({});
+        CHECK(sf::Shader::getProgramCacheDirectory().empty());
+        std::filesystem::remove_all(directory);
+    }
 }
@@ -0,0 +1,24 @@
+#include <SFML/Graphics/ShaderRequest.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ShaderRequest")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::ShaderRequest>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::ShaderRequest>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::ShaderRequest>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::ShaderRequest>);
+    }
+
+    SECTION("Default constructor")
+    {
+        sf::ShaderRequest request;
+        CHECK(request.isReady());
+        CHECK(request.wait(sf::Time::Zero));
+        CHECK(!request.takeShader());
+    }
+}
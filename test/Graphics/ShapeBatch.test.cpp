@@ -0,0 +1,91 @@
+#include <SFML/Graphics/ShapeBatch.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ShapeBatch")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::ShapeBatch>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::ShapeBatch>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::ShapeBatch>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::ShapeBatch>);
+        STATIC_CHECK(std::has_virtual_destructor_v<sf::ShapeBatch>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::ShapeBatch batch;
+        CHECK(batch.getShapeCount() == 0);
+        CHECK(batch.getLocalBounds() == sf::FloatRect());
+        CHECK(batch.getGlobalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Add shapes")
+    {
+        sf::ShapeBatch batch;
+        CHECK(batch.addCircle({0, 0}, 10, 4) == 0);
+        CHECK(batch.addRectangle({{10, 20}, {30, 40}}) == 1);
+        CHECK(batch.getShapeCount() == 2);
+
+        CHECK(batch.getCenter(0) == sf::Vector2f(0, 0));
+        CHECK(batch.getSize(0) == sf::Vector2f(20, 20));
+        CHECK(batch.getPointCount(0) == 4);
+        CHECK(batch.getCenter(1) == sf::Vector2f(25, 40));
+        CHECK(batch.getSize(1) == sf::Vector2f(30, 40));
+        CHECK(batch.getPointCount(1) == 4);
+
+        CHECK(batch.getRotation(1) == sf::Angle::Zero);
+        CHECK(batch.getFillColor(1) == sf::Color::White);
+        CHECK(batch.getOutlineColor(1) == sf::Color::White);
+        CHECK(batch.getOutlineThickness(1) == 0);
+
+        CHECK(batch.getLocalBounds() == Approx(sf::FloatRect({-10, -10}, {50, 70})));
+
+        batch.clear();
+        CHECK(batch.getShapeCount() == 0);
+        CHECK(batch.getLocalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Set shape properties")
+    {
+        sf::ShapeBatch    batch;
+        const std::size_t index = batch.addRectangle({{10, 20}, {30, 40}});
+
+        batch.setFillColor(index, sf::Color::Red);
+        batch.setOutlineColor(index, sf::Color::Blue);
+        CHECK(batch.getFillColor(index) == sf::Color::Red);
+        CHECK(batch.getOutlineColor(index) == sf::Color::Blue);
+
+        batch.setOutlineThickness(index, 1);
+        CHECK(batch.getOutlineThickness(index) == 1);
+        CHECK(batch.getLocalBounds() == Approx(sf::FloatRect({9, 19}, {32, 42})));
+
+        batch.setCenter(index, {0, 0});
+        batch.setSize(index, {10, 20});
+        CHECK(batch.getCenter(index) == sf::Vector2f(0, 0));
+        CHECK(batch.getSize(index) == sf::Vector2f(10, 20));
+        CHECK(batch.getLocalBounds() == Approx(sf::FloatRect({-6, -11}, {12, 22})));
+
+        batch.setRotation(index, sf::degrees(90));
+        CHECK(batch.getRotation(index) == sf::degrees(90));
+        CHECK(batch.getLocalBounds() == Approx(sf::FloatRect({-11, -6}, {22, 12})));
+
+        batch.setOutlineThickness(index, 0);
+        CHECK(batch.getLocalBounds() == Approx(sf::FloatRect({-10, -5}, {20, 10})));
+
+        batch.setRotation(index, sf::degrees(-90));
+        CHECK(batch.getRotation(index) == sf::degrees(270));
+    }
+
+    SECTION("Global bounds")
+    {
+        sf::ShapeBatch batch;
+        batch.addCircle({0, 0}, 10, 4);
+        batch.setPosition({100, 50});
+        CHECK(batch.getGlobalBounds() == Approx(sf::FloatRect({90, 40}, {20, 20})));
+    }
+}
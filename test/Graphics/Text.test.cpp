@@ -2,6 +2,7 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -9,6 +10,8 @@
 #include <WindowUtil.hpp>
 #include <type_traits>
 
+#include <cstdint>
+
 TEST_CASE("[Graphics] sf::Text", runDisplayTests())
 {
     SECTION("Type traits")
@@ -183,4 +186,124 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
             CHECK(text.getGlobalBounds() == Approx(sf::FloatRect({66, 182}, {33, 13})));
         }
     }
+
+    SECTION("Incremental geometry update")
+    {
+        sf::Text text(font, "First line\nSecond", 18);
+        text.setStyle(sf::Text::Underlined);
+        text.setOutlineThickness(1.5f);
+        CHECK(text.getLocalBounds() != sf::FloatRect());
+
+        SECTION("Append characters")
+        {
+            text.setString("First line\nSecond line\nThird line");
+            sf::Text expected(font, "First line\nSecond line\nThird line", 18);
+            expected.setStyle(sf::Text::Underlined);
+            expected.setOutlineThickness(1.5f);
+            CHECK(text.getLocalBounds() == expected.getLocalBounds());
+        }
+
+        SECTION("Modify a line")
+        {
+            text.setString("First line\nSecond line\nThird line");
+            CHECK(text.getLocalBounds().size.y > 0);
+            text.setString("First\nSecond line\nThird line");
+            sf::Text expected(font, "First\nSecond line\nThird line", 18);
+            expected.setStyle(sf::Text::Underlined);
+            expected.setOutlineThickness(1.5f);
+            CHECK(text.getLocalBounds() == expected.getLocalBounds());
+        }
+
+        SECTION("Remove characters")
+        {
+            text.setString("First");
+            sf::Text expected(font, "First", 18);
+            expected.setStyle(sf::Text::Underlined);
+            expected.setOutlineThickness(1.5f);
+            CHECK(text.getLocalBounds() == expected.getLocalBounds());
+        }
+
+        SECTION("Change style after appending")
+        {
+            text.setString("First line\nSecond line");
+            text.setCharacterSize(24);
+            sf::Text expected(font, "First line\nSecond line", 24);
+            expected.setStyle(sf::Text::Underlined);
+            expected.setOutlineThickness(1.5f);
+            CHECK(text.getLocalBounds() == expected.getLocalBounds());
+        }
+    }
+
+    SECTION("drawVisible()")
+    {
+        sf::String string;
+        for (int i = 0; i < 100; ++i)
+            string += "Line of text\n";
+
+        sf::Text            text(font, string, 20);
+        sf::RenderTexture   renderTexture({100, 100});
+        const std::uint64_t allVertices = [&]
+        {
+            renderTexture.resetStatistics();
+            renderTexture.draw(text);
+            return renderTexture.getStatistics().vertices;
+        }();
+
+        SECTION("Current view")
+        {
+            renderTexture.resetStatistics();
+            text.drawVisible(renderTexture);
+            CHECK(renderTexture.getStatistics().vertices > 0);
+            CHECK(renderTexture.getStatistics().vertices < allVertices / 10);
+        }
+
+        SECTION("Explicit area")
+        {
+            renderTexture.resetStatistics();
+            text.drawVisible(renderTexture, sf::FloatRect({0, 0}, {100, 1'000'000}));
+            CHECK(renderTexture.getStatistics().vertices == allVertices);
+
+            renderTexture.resetStatistics();
+            text.drawVisible(renderTexture, sf::FloatRect({0, -200}, {100, 100}));
+            CHECK(renderTexture.getStatistics().vertices == 0);
+        }
+
+        SECTION("Transformed text")
+        {
+            text.setPosition({0, -1'000});
+            renderTexture.resetStatistics();
+            text.drawVisible(renderTexture);
+            CHECK(renderTexture.getStatistics().vertices > 0);
+            CHECK(renderTexture.getStatistics().vertices < allVertices / 10);
+        }
+    }
+
+    SECTION("Page eviction between batched draws")
+    {
+        sf::Font          pageFont("Graphics/tuffy.ttf");
+        const sf::Text    largeText(pageFont, "ABCDEFGHIJKLMNOPQRST", 64);
+        const sf::Text    smallText(pageFont, "E", 16);
+        const sf::Text    mediumText(pageFont, "E", 24);
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.setBatchingEnabled(true);
+
+        const sf::Texture& largeTexture = pageFont.getTexture(64);
+        renderTexture.draw(largeText);
+
+        // Leave room for one more page only: drawing the medium text releases the page of the large text
+        pageFont.setMemoryBudget(pageFont.getStatistics().textureBytes + 128 * 128 * 4);
+        renderTexture.draw(smallText);
+        renderTexture.draw(mediumText);
+        CHECK(pageFont.getStatistics().pageEvictions == 1);
+        CHECK(&pageFont.getTexture(64) == &largeTexture);
+
+        renderTexture.resetStatistics();
+        renderTexture.flush();
+        CHECK(renderTexture.getStatistics().drawCalls > 0);
+
+        renderTexture.resetStatistics();
+        renderTexture.draw(largeText);
+        renderTexture.flush();
+        CHECK(renderTexture.getStatistics().vertices > 0);
+    }
 }
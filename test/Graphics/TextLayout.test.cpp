@@ -0,0 +1,145 @@
+#include <SFML/Graphics/TextLayout.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <array>
+#include <thread>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TextLayout")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_constructible_v<sf::TextLayout, sf::Font&&, sf::String, unsigned int>);
+        STATIC_CHECK(!std::is_constructible_v<sf::TextLayout, const sf::Font&&, sf::String, unsigned int>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TextLayout>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TextLayout>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextLayout>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextLayout>);
+    }
+
+    const sf::Font font("Graphics/tuffy.ttf");
+
+    SECTION("Construction")
+    {
+        const sf::TextLayout layout(font);
+        CHECK(layout.getString() == "");
+        CHECK(&layout.getFont() == &font);
+        CHECK(layout.getCharacterSize() == 30);
+        CHECK(layout.getLetterSpacing() == 1.f);
+        CHECK(layout.getLineSpacing() == 1.f);
+        CHECK(layout.getStyle() == sf::Text::Regular);
+        CHECK(layout.getOutlineThickness() == 0.f);
+        CHECK(layout.getGlyphs().empty());
+        CHECK(layout.getLines().empty());
+        CHECK(layout.getLocalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Set/get properties")
+    {
+        sf::TextLayout layout(font);
+        layout.setString("abc");
+        layout.setCharacterSize(18);
+        layout.setLetterSpacing(2.f);
+        layout.setLineSpacing(1.5f);
+        layout.setStyle(sf::Text::Bold | sf::Text::Italic);
+        layout.setOutlineThickness(2.f);
+        CHECK(layout.getString() == "abc");
+        CHECK(layout.getCharacterSize() == 18);
+        CHECK(layout.getLetterSpacing() == 2.f);
+        CHECK(layout.getLineSpacing() == 1.5f);
+        CHECK(layout.getStyle() == (sf::Text::Bold | sf::Text::Italic));
+        CHECK(layout.getOutlineThickness() == 2.f);
+    }
+
+    SECTION("Layout")
+    {
+        const sf::TextLayout layout(font, "Test", 18);
+        CHECK(layout.getLocalBounds() == sf::FloatRect({1, 5}, {33, 13}));
+
+        const auto& glyphs = layout.getGlyphs();
+        REQUIRE(glyphs.size() == 4);
+        CHECK(glyphs[0].codePoint == U'T');
+        CHECK(glyphs[0].index == 0);
+        CHECK(glyphs[0].position == sf::Vector2f(0, 18));
+        CHECK(glyphs[3].index == 3);
+        CHECK(glyphs[3].position.x > glyphs[2].position.x);
+
+        REQUIRE(layout.getLines().size() == 1);
+        CHECK(layout.getLines()[0].glyphCount == 4);
+        CHECK(layout.getLines()[0].baseline == 18);
+    }
+
+    SECTION("Line breaks")
+    {
+        const sf::TextLayout layout(font, "ab cd\r\n\nef", 24);
+        const auto&          lines = layout.getLines();
+        REQUIRE(lines.size() == 3);
+        CHECK(lines[0].firstGlyph == 0);
+        CHECK(lines[0].glyphCount == 4);
+        CHECK(lines[1].glyphCount == 0);
+        CHECK(lines[2].firstGlyph == 4);
+        CHECK(lines[2].glyphCount == 2);
+        CHECK(lines[1].baseline == lines[0].baseline + font.getLineSpacing(24));
+        CHECK(lines[2].baseline == lines[1].baseline + font.getLineSpacing(24));
+        CHECK(layout.getGlyphs()[4].index == 8);
+        CHECK(layout.getGlyphs()[4].position.y == lines[2].baseline);
+    }
+
+    SECTION("Worker threads")
+    {
+        std::array<sf::FloatRect, 4> bounds;
+        std::array<std::thread, 4>   threads;
+        for (std::size_t i = 0; i < threads.size(); ++i)
+        {
+            threads[i] = std::thread(
+                [&font, &bounds, i]
+                {
+                    const sf::TextLayout layout(font, "The quick brown fox\njumps over the lazy dog", 20);
+                    bounds[i] = layout.getLocalBounds();
+                });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        const sf::TextLayout layout(font, "The quick brown fox\njumps over the lazy dog", 20);
+        for (const sf::FloatRect& threadBounds : bounds)
+            CHECK(threadBounds == layout.getLocalBounds());
+    }
+}
+
+TEST_CASE("[Graphics] sf::TextLayout geometry", runDisplayTests())
+{
+    const sf::Font font("Graphics/tuffy.ttf");
+
+    sf::TextLayout layout(font, "Test\nText", 18);
+    sf::VertexArray fill;
+    sf::VertexArray outline;
+
+    SECTION("Fill only")
+    {
+        layout.createGeometry(fill, sf::Color::White, outline, sf::Color::Black);
+        CHECK(fill.getPrimitiveType() == sf::PrimitiveType::Triangles);
+        CHECK(fill.getVertexCount() == 8 * 6);
+        CHECK(outline.getVertexCount() == 0);
+        CHECK(fill[0].color == sf::Color::White);
+        CHECK(fill[0].texCoords != sf::Vector2f());
+    }
+
+    SECTION("Outline and decorations")
+    {
+        layout.setOutlineThickness(1.f);
+        layout.setStyle(sf::Text::Underlined | sf::Text::StrikeThrough);
+        layout.createGeometry(fill, sf::Color::White, outline, sf::Color::Black);
+        CHECK(fill.getVertexCount() == (8 + 2 * 2) * 6);
+        CHECK(outline.getVertexCount() == (8 + 2 * 2) * 6);
+        CHECK(outline[0].color == sf::Color::Black);
+    }
+}
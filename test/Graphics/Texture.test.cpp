@@ -11,7 +11,9 @@
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
 #include <array>
+#include <initializer_list>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
 {
@@ -272,6 +274,96 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         }
     }
 
+    SECTION("loadFromCompressedMemory()")
+    {
+        std::vector<std::uint8_t> file;
+
+        const auto write = [&file](std::initializer_list<std::uint32_t> values)
+        {
+            for (const std::uint32_t value : values)
+                for (int i = 0; i < 4; ++i)
+                    file.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+        };
+
+        sf::Texture texture;
+
+        SECTION("Invalid data")
+        {
+            CHECK(!texture.loadFromCompressedMemory(nullptr, 0));
+
+            static constexpr std::array<std::uint8_t, 4> garbage = {'D', 'D', 'S', ' '};
+            CHECK(!texture.loadFromCompressedMemory(garbage.data(), garbage.size()));
+            CHECK(texture.getSize() == sf::Vector2u());
+        }
+
+        SECTION("DDS with BC1 blocks")
+        {
+            // Header of an 8x4 image with a single level
+            file = {'D', 'D', 'S', ' '};
+            write({124, 0x1007, 4, 8, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
+            write({32, 0x4, 0x31545844, 0, 0, 0, 0, 0, 0x1000, 0, 0, 0, 0});
+
+            // A red block and a blue block
+            file.insert(file.end(), {0x00, 0xF8, 0x00, 0xF8, 0, 0, 0, 0});
+            file.insert(file.end(), {0x1F, 0x00, 0x1F, 0x00, 0, 0, 0, 0});
+
+            REQUIRE(texture.loadFromCompressedMemory(file.data(), file.size()));
+            CHECK(texture.getSize() == sf::Vector2u(8, 4));
+            CHECK(!texture.isSrgb());
+
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+            CHECK(image.getPixel({7, 3}) == sf::Color::Blue);
+        }
+
+        SECTION("DDS with an oversized width")
+        {
+            // Header of a 0xFFFFFFFDx4 image, whose block count would wrap around in 32 bits
+            file = {'D', 'D', 'S', ' '};
+            write({124, 0x1007, 4, 0xFFFFFFFD, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
+            write({32, 0x4, 0x31545844, 0, 0, 0, 0, 0, 0x1000, 0, 0, 0, 0});
+            file.insert(file.end(), {0x00, 0xF8, 0x00, 0xF8, 0, 0, 0, 0});
+
+            CHECK(!texture.loadFromCompressedMemory(file.data(), file.size()));
+            CHECK(texture.getSize() == sf::Vector2u());
+        }
+
+        SECTION("KTX with ETC2 blocks")
+        {
+            // Header of a 5x3 image with a single level
+            file = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+            write({0x04030201, 0, 1, 0, 0x9274, 0x1907, 5, 3, 0, 0, 1, 1, 0, 16});
+
+            // Two blocks of ETC1 compatible data, decoding to (255, 2, 2)
+            for (int i = 0; i < 2; ++i)
+                file.insert(file.end(), {0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+
+            REQUIRE(texture.loadFromCompressedMemory(file.data(), file.size()));
+            CHECK(texture.getSize() == sf::Vector2u(5, 3));
+            CHECK(texture.copyToImage().getPixel({4, 2}) == sf::Color(255, 2, 2));
+        }
+
+        SECTION("KTX with BC1 blocks in three colors mode")
+        {
+            // A 4x4 black block whose pixels all use the fourth color
+            const auto writeFile = [&](std::uint32_t internalFormat)
+            {
+                file = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+                write({0x04030201, 0, 1, 0, internalFormat, 0x1907, 4, 4, 0, 0, 1, 1, 0, 8});
+                file.insert(file.end(), {0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF});
+            };
+
+            // The fourth color is only transparent when the format has alpha
+            writeFile(0x83F0);
+            REQUIRE(texture.loadFromCompressedMemory(file.data(), file.size()));
+            CHECK(texture.copyToImage().getPixel({3, 3}) == sf::Color::Black);
+
+            writeFile(0x83F1);
+            REQUIRE(texture.loadFromCompressedMemory(file.data(), file.size()));
+            CHECK(texture.copyToImage().getPixel({3, 3}) == sf::Color::Transparent);
+        }
+    }
+
     SECTION("Copy semantics")
     {
         static constexpr std::array<std::uint8_t, 8> red = {0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF};
@@ -359,6 +451,61 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         }
     }
 
+    SECTION("requestImageAsync()")
+    {
+        SECTION("Empty texture")
+        {
+            const sf::Texture        texture;
+            const sf::ImageRequest request = texture.requestImageAsync();
+            CHECK(request.isReady());
+            CHECK(request.getImage().getSize() == sf::Vector2u());
+        }
+
+        SECTION("Pixels")
+        {
+            sf::Texture texture(sf::Vector2u(16, 32));
+            texture.update(sf::Image(sf::Vector2u(16, 16), sf::Color::Red), sf::Vector2u(0, 0));
+            texture.update(sf::Image(sf::Vector2u(16, 16), sf::Color::Green), sf::Vector2u(0, 16));
+
+            const sf::ImageRequest request = texture.requestImageAsync();
+            CHECK(request.wait(sf::seconds(1)));
+            CHECK(request.isReady());
+
+            const sf::Image image = request.getImage();
+            CHECK(image.getSize() == sf::Vector2u(16, 32));
+            CHECK(image.getPixel(sf::Vector2u(7, 7)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(7, 22)) == sf::Color::Green);
+            CHECK(request.getImage().getPixel(sf::Vector2u(7, 22)) == sf::Color::Green);
+        }
+    }
+
+    SECTION("updateAsync()")
+    {
+        SECTION("Pixels, size and destination")
+        {
+            std::array<std::uint8_t, 4> pixels = {0xFF, 0xFF, 0x00, 0xFF};
+            sf::Texture                 texture(sf::Vector2u(2, 1));
+            const sf::Fence             fence1 = texture.updateAsync(pixels.data(), sf::Vector2u(1, 1), sf::Vector2u(0, 0));
+
+            // The source pixels can be reused right away
+            pixels = {0x00, 0xFF, 0xFF, 0xFF};
+            const sf::Fence fence2 = texture.updateAsync(pixels.data(), sf::Vector2u(1, 1), sf::Vector2u(1, 0));
+
+            CHECK(fence1.wait(sf::seconds(1)));
+            CHECK(fence2.wait(sf::seconds(1)));
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(0, 0)) == sf::Color::Yellow);
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(1, 0)) == sf::Color::Cyan);
+        }
+
+        SECTION("Image")
+        {
+            sf::Texture     texture(sf::Vector2u(16, 32));
+            const sf::Image image(sf::Vector2u(16, 16), sf::Color::Green);
+            CHECK(texture.updateAsync(image, sf::Vector2u(0, 16)).wait(sf::seconds(1)));
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u(7, 22)) == sf::Color::Green);
+        }
+    }
+
     SECTION("Set/get smooth")
     {
         sf::Texture texture(sf::Vector2u(64, 64));
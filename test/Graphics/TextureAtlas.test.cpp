@@ -0,0 +1,101 @@
+#include <SFML/Graphics/TextureAtlas.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Graphics] sf::TextureAtlas", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureAtlas>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureAtlas>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TextureAtlas atlas({256, 128});
+        CHECK(atlas.getPageCount() == 0);
+        CHECK(atlas.getPageSize() == sf::Vector2u(256, 128));
+        CHECK(!atlas.isSmooth());
+        CHECK(atlas.getEfficiency() == 0.f);
+    }
+
+    SECTION("add()")
+    {
+        sf::TextureAtlas atlas({64, 64}, 0);
+
+        SECTION("Invalid images")
+        {
+            CHECK(!atlas.add(sf::Image()));
+            CHECK(!atlas.add(sf::Image({65, 1})));
+            CHECK(!atlas.add("does/not/exist.png"));
+            CHECK(atlas.getPageCount() == 0);
+        }
+
+        SECTION("Single image")
+        {
+            const auto region = atlas.add(sf::Image({16, 8}, sf::Color::Red));
+            REQUIRE(region);
+            CHECK(region->texture == &atlas.getTexture(0));
+            CHECK(region->page == 0);
+            CHECK(region->rect == sf::IntRect({0, 0}, {16, 8}));
+            CHECK(atlas.getPageCount() == 1);
+            CHECK(atlas.getEfficiency() == 128.f / (64 * 64));
+
+            const sf::Image page = atlas.getTexture(0).copyToImage();
+            CHECK(page.getPixel({15, 7}) == sf::Color::Red);
+            CHECK(page.getPixel({16, 0}) == sf::Color::Transparent);
+            CHECK(page.getPixel({0, 8}) == sf::Color::Transparent);
+            CHECK(page.getPixel({16, 8}) == sf::Color::Transparent);
+        }
+
+        SECTION("Several images")
+        {
+            const std::vector images(8, sf::Image({32, 32}, sf::Color::Green));
+            const auto        regions = atlas.add(images);
+            REQUIRE(regions.size() == 8);
+            CHECK(atlas.getPageCount() == 2);
+            CHECK(atlas.getEfficiency() == 1.f);
+
+            for (std::size_t i = 0; i < regions.size(); ++i)
+            {
+                REQUIRE(regions[i]);
+                CHECK(regions[i]->page == i / 4);
+                CHECK(regions[i]->rect.size == sf::Vector2i(32, 32));
+                for (std::size_t j = 0; j < i; ++j)
+                    CHECK((regions[i]->page != regions[j]->page ||
+                           !regions[i]->rect.findIntersection(regions[j]->rect).has_value()));
+            }
+        }
+    }
+
+    SECTION("setSmooth()")
+    {
+        sf::TextureAtlas atlas({64, 64});
+        REQUIRE(atlas.add(sf::Image({8, 8})));
+        atlas.setSmooth(true);
+        CHECK(atlas.isSmooth());
+        CHECK(atlas.getTexture(0).isSmooth());
+        REQUIRE(atlas.add(sf::Image({64, 64})));
+        CHECK(atlas.getTexture(1).isSmooth());
+    }
+
+    SECTION("clear()")
+    {
+        sf::TextureAtlas atlas({64, 64});
+        REQUIRE(atlas.add(sf::Image({8, 8})));
+        atlas.clear();
+        CHECK(atlas.getPageCount() == 0);
+        CHECK(atlas.getEfficiency() == 0.f);
+    }
+}
@@ -1,4 +1,5 @@
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 
 #include <SFML/System/Angle.hpp>
 
@@ -69,6 +70,47 @@ TEST_CASE("[Graphics] sf::Transform")
         STATIC_CHECK(transform.transformPoint({1.0f, 1.0f}) == sf::Vector2f(6.0f, 13.0f));
     }
 
+    SECTION("transformPoints()")
+    {
+        constexpr sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+
+        // Use an odd count so that both the vectorized and the scalar paths are exercised
+        std::vector<sf::Vector2f> points;
+        for (int i = 0; i < 11; ++i)
+            points.emplace_back(static_cast<float>(i) - 5.0f, static_cast<float>(i * 2) - 3.0f);
+
+        SECTION("Points")
+        {
+            std::vector<sf::Vector2f> transformedPoints(points.size());
+            transform.transformPoints(points.data(), transformedPoints.data(), points.size());
+            for (std::size_t i = 0; i < points.size(); ++i)
+                CHECK(transformedPoints[i] == transform.transformPoint(points[i]));
+        }
+
+        SECTION("Points in place")
+        {
+            std::vector<sf::Vector2f> transformedPoints = points;
+            transform.transformPoints(transformedPoints.data(), transformedPoints.data(), transformedPoints.size());
+            for (std::size_t i = 0; i < points.size(); ++i)
+                CHECK(transformedPoints[i] == transform.transformPoint(points[i]));
+        }
+
+        SECTION("Vertices")
+        {
+            std::vector<sf::Vertex> vertices(points.size());
+            for (std::size_t i = 0; i < points.size(); ++i)
+                vertices[i] = {points[i], sf::Color::Red, {1.0f, 2.0f}};
+
+            transform.transformPoints(vertices.data(), vertices.size());
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                CHECK(vertices[i].position == transform.transformPoint(points[i]));
+                CHECK(vertices[i].color == sf::Color::Red);
+                CHECK(vertices[i].texCoords == sf::Vector2f(1.0f, 2.0f));
+            }
+        }
+    }
+
     SECTION("transformRect()")
     {
         STATIC_CHECK(sf::Transform::Identity.transformRect({{-200.0f, -200.0f}, {-100.0f, -100.0f}}) ==
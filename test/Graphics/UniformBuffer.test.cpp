@@ -0,0 +1,204 @@
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <limits>
+#include <type_traits>
+
+#include <cstring>
+
+TEST_CASE("[Graphics] sf::UniformBuffer::Layout")
+{
+    using Type = sf::UniformBuffer::Layout::Type;
+
+    SECTION("Default constructor")
+    {
+        const sf::UniformBuffer::Layout layout;
+        CHECK(layout.getSize() == 0);
+    }
+
+    SECTION("add()")
+    {
+        sf::UniformBuffer::Layout layout;
+        CHECK(layout.add(Type::Float) == 0);
+        CHECK(layout.add(Type::Vec2) == 8);
+        CHECK(layout.add(Type::Vec3) == 16);
+        CHECK(layout.add(Type::Int) == 28);
+        CHECK(layout.add(Type::Mat4) == 32);
+        CHECK(layout.add(Type::Bool) == 96);
+        CHECK(layout.add(Type::Mat3) == 112);
+        CHECK(layout.add(Type::Float, 3) == 160);
+        CHECK(layout.add(Type::Ivec2) == 208);
+        CHECK(layout.getSize() == 224);
+    }
+
+    SECTION("getArrayStride()")
+    {
+        CHECK(sf::UniformBuffer::Layout::getArrayStride(Type::Float) == 16);
+        CHECK(sf::UniformBuffer::Layout::getArrayStride(Type::Vec3) == 16);
+        CHECK(sf::UniformBuffer::Layout::getArrayStride(Type::Vec4) == 16);
+        CHECK(sf::UniformBuffer::Layout::getArrayStride(Type::Mat3) == 48);
+        CHECK(sf::UniformBuffer::Layout::getArrayStride(Type::Mat4) == 64);
+    }
+}
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::UniformBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_swappable_v<sf::UniformBuffer>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::UniformBuffer uniformBuffer;
+            CHECK(uniformBuffer.getSize() == 0);
+            CHECK(uniformBuffer.getData() == nullptr);
+            CHECK(uniformBuffer.getNativeHandle() == 0);
+            CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Dynamic);
+        }
+
+        SECTION("Usage constructor")
+        {
+            const sf::UniformBuffer uniformBuffer(sf::UniformBuffer::Usage::Stream);
+            CHECK(uniformBuffer.getSize() == 0);
+            CHECK(uniformBuffer.getData() == nullptr);
+            CHECK(uniformBuffer.getNativeHandle() == 0);
+            CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Stream);
+        }
+    }
+
+    SECTION("create()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.create(64));
+        CHECK(uniformBuffer.getSize() == 64);
+        CHECK(uniformBuffer.getData()[63] == std::byte{0});
+        CHECK((uniformBuffer.getNativeHandle() != 0) == sf::UniformBuffer::isAvailable());
+    }
+
+    SECTION("update()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.create(32));
+
+        const std::array<float, 4> values{1.f, 2.f, 3.f, 4.f};
+        CHECK(!uniformBuffer.update(nullptr, sizeof(values), 0));
+        CHECK(!uniformBuffer.update(values.data(), sizeof(values), 24));
+        CHECK(uniformBuffer.update(values.data(), sizeof(values), 16));
+
+        float value = 0;
+        std::memcpy(&value, uniformBuffer.getData() + 28, sizeof(value));
+        CHECK(value == 4.f);
+        CHECK(uniformBuffer.update());
+    }
+
+    SECTION("write()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.create(64));
+
+        const auto readFloat = [&uniformBuffer](std::size_t offset)
+        {
+            float value = 0;
+            std::memcpy(&value, uniformBuffer.getData() + offset, sizeof(value));
+            return value;
+        };
+
+        const auto readInt = [&uniformBuffer](std::size_t offset)
+        {
+            int value = 0;
+            std::memcpy(&value, uniformBuffer.getData() + offset, sizeof(value));
+            return value;
+        };
+
+        SECTION("Scalars and vectors")
+        {
+            uniformBuffer.write(0, 0.5f);
+            uniformBuffer.write(8, sf::Glsl::Vec2(1.f, 2.f));
+            uniformBuffer.write(16, sf::Glsl::Ivec3(3, 4, 5));
+            uniformBuffer.write(28, true);
+            uniformBuffer.write(32, sf::Glsl::Bvec4(false, true, false, true));
+            CHECK(uniformBuffer.update());
+
+            CHECK(readFloat(0) == 0.5f);
+            CHECK(readFloat(12) == 2.f);
+            CHECK(readInt(24) == 5);
+            CHECK(readInt(28) == 1);
+            CHECK(readInt(32) == 0);
+            CHECK(readInt(44) == 1);
+        }
+
+        SECTION("Matrices")
+        {
+            const std::array<float, 9> matrix{1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f};
+            uniformBuffer.write(0, sf::Glsl::Mat3(matrix.data()));
+            CHECK(uniformBuffer.update());
+
+            CHECK(readFloat(0) == 1.f);
+            CHECK(readFloat(8) == 3.f);
+            CHECK(readFloat(16) == 4.f);
+            CHECK(readFloat(32) == 7.f);
+            CHECK(readFloat(40) == 9.f);
+        }
+
+        SECTION("Out of range")
+        {
+            uniformBuffer.write(60, sf::Glsl::Vec4(1.f, 2.f, 3.f, 4.f));
+            uniformBuffer.write(64, 1.f);
+            uniformBuffer.write(std::numeric_limits<std::size_t>::max() - 2, 1.f);
+            CHECK(uniformBuffer.update());
+
+            CHECK(readFloat(60) == 0.f);
+        }
+    }
+
+    SECTION("Copy semantics")
+    {
+        sf::UniformBuffer uniformBuffer(sf::UniformBuffer::Usage::Static);
+        CHECK(uniformBuffer.create(16));
+        uniformBuffer.write(4, 2.f);
+
+        const sf::UniformBuffer uniformBufferCopy(uniformBuffer); // NOLINT(performance-unnecessary-copy-initialization)
+        CHECK(uniformBufferCopy.getSize() == 16);
+        CHECK(uniformBufferCopy.getUsage() == sf::UniformBuffer::Usage::Static);
+        CHECK(std::memcmp(uniformBufferCopy.getData(), uniformBuffer.getData(), 16) == 0);
+        if (sf::UniformBuffer::isAvailable())
+            CHECK(uniformBufferCopy.getNativeHandle() != uniformBuffer.getNativeHandle());
+    }
+
+    SECTION("swap()")
+    {
+        sf::UniformBuffer uniformBuffer1(sf::UniformBuffer::Usage::Dynamic);
+        CHECK(uniformBuffer1.create(32));
+
+        sf::UniformBuffer uniformBuffer2(sf::UniformBuffer::Usage::Stream);
+        CHECK(uniformBuffer2.create(48));
+
+        sf::swap(uniformBuffer1, uniformBuffer2);
+
+        CHECK(uniformBuffer1.getSize() == 48);
+        CHECK(uniformBuffer1.getUsage() == sf::UniformBuffer::Usage::Stream);
+
+        CHECK(uniformBuffer2.getSize() == 32);
+        CHECK(uniformBuffer2.getUsage() == sf::UniformBuffer::Usage::Dynamic);
+    }
+
+    SECTION("Set/get usage")
+    {
+        sf::UniformBuffer uniformBuffer;
+        uniformBuffer.setUsage(sf::UniformBuffer::Usage::Stream);
+        CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Stream);
+    }
+}
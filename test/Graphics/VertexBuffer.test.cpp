@@ -134,6 +134,26 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
             CHECK(vertexBuffer.getVertexCount() == 128);
         }
 
+        SECTION("Streaming")
+        {
+            CHECK(vertexBuffer.getUsage() == sf::VertexBuffer::Usage::Stream);
+            CHECK(vertexBuffer.create(128));
+
+            // Append ranges, then overwrite one and start over with a whole update
+            CHECK(vertexBuffer.update(vertices.data(), 32, 0));
+            CHECK(vertexBuffer.update(vertices.data(), 32, 32));
+            CHECK(vertexBuffer.update(vertices.data(), 64, 64));
+            CHECK(vertexBuffer.update(vertices.data(), 16, 16));
+            CHECK(vertexBuffer.update(vertices.data()));
+            CHECK(vertexBuffer.update(vertices.data(), 32, 96));
+            CHECK(vertexBuffer.getVertexCount() == 128);
+
+            // Starting over with a partial update keeps the size of the buffer
+            CHECK(vertexBuffer.update(vertices.data(), 16, 0));
+            CHECK(vertexBuffer.update(vertices.data(), 16, 16));
+            CHECK(vertexBuffer.getVertexCount() == 128);
+        }
+
         SECTION("Another buffer")
         {
             sf::VertexBuffer otherVertexBuffer;
@@ -144,6 +164,45 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         }
     }
 
+    SECTION("map()")
+    {
+        sf::VertexBuffer vertexBuffer;
+        CHECK(vertexBuffer.map(16) == nullptr);
+        CHECK(!vertexBuffer.isMapped());
+        CHECK(!vertexBuffer.unmap());
+
+        CHECK(vertexBuffer.create(64));
+        CHECK(vertexBuffer.map(0) == nullptr);
+        CHECK(vertexBuffer.map(32, 40) == nullptr);
+        CHECK(!vertexBuffer.isMapped());
+
+        // Mapping is not supported by every system
+        if (sf::Vertex* vertices = vertexBuffer.map(32, 32))
+        {
+            CHECK(vertexBuffer.isMapped());
+            CHECK(vertexBuffer.map(16) == nullptr);
+
+            // The buffer can't be written in another way until it is unmapped
+            const std::array<sf::Vertex, 16> otherVertices{};
+            CHECK(!vertexBuffer.update(otherVertices.data(), otherVertices.size(), 0));
+            CHECK(!vertexBuffer.update(vertexBuffer));
+
+            for (std::size_t i = 0; i < 32; ++i)
+                vertices[i] = sf::Vertex{{static_cast<float>(i), 0}, sf::Color::Red};
+
+            CHECK(vertexBuffer.unmap());
+            CHECK(!vertexBuffer.isMapped());
+            CHECK(!vertexBuffer.unmap());
+
+            CHECK(vertexBuffer.map(64) != nullptr);
+            CHECK(vertexBuffer.unmap());
+        }
+        else
+        {
+            CHECK(!vertexBuffer.isMapped());
+        }
+    }
+
     SECTION("swap()")
     {
         sf::VertexBuffer vertexBuffer1(sf::PrimitiveType::LineStrip, sf::VertexBuffer::Usage::Dynamic);